@@ -0,0 +1,73 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal.
+//
+// Measures the throughput of the transfer CRC implementation selected by CANARD_CRC_BACKEND over contiguous buffers
+// of typical transfer sizes. The library is included directly to reach the internal CRC routine, so the benchmark is
+// built once per backend; compare the outputs of the bench_crc_* executables.
+//
+// Usage: bench_crc_<backend> [megabytes per size]
+
+#define _POSIX_C_SOURCE 199309L // For clock_gettime; _DEFAULT_SOURCE would clash with canard.c internals.
+#include "canard.c"             // NOLINT(bugprone-suspicious-include)
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_SIZE      4096U
+#define DEFAULT_MEGAS 256U
+
+static int64_t get_monotonic_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000LL) + (int64_t)ts.tv_nsec;
+}
+
+static const char* backend_name(void)
+{
+    switch (CANARD_CRC_BACKEND) {
+        case CANARD_CRC_BACKEND_BITWISE:
+            return "bitwise";
+        case CANARD_CRC_BACKEND_TABLE:
+            return "table";
+        case CANARD_CRC_BACKEND_SLICE4:
+            return "slice-by-4";
+        case CANARD_CRC_BACKEND_SLICE8:
+            return "slice-by-8";
+        case CANARD_CRC_BACKEND_CLMUL:
+            return "clmul";
+        default:
+            return "?";
+    }
+}
+
+static byte_t g_data[MAX_SIZE];
+
+int main(const int argc, const char* const argv[])
+{
+    const size_t megas = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_MEGAS;
+    if (megas == 0) {
+        (void)fprintf(stderr, "Usage: %s [megabytes per size]\n", argv[0]);
+        return 1;
+    }
+    for (size_t i = 0; i < MAX_SIZE; i++) {
+        g_data[i] = (byte_t)((i * 31U) ^ (i >> 3U));
+    }
+    static const size_t sizes[] = { 64U, 256U, 1024U, MAX_SIZE };
+    (void)printf("backend: %s, %zu MiB per size\n", backend_name(), megas);
+    uint16_t crc = CRC_INITIAL;
+    for (size_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        const size_t  calls   = (megas * 1024U * 1024U) / sizes[s];
+        const int64_t started = get_monotonic_ns();
+        for (size_t i = 0; i < calls; i++) {
+            crc = crc_add(crc, sizes[s], g_data); // Chained to keep the calls from being optimized away.
+        }
+        const int64_t elapsed = get_monotonic_ns() - started;
+        (void)printf("%5zu bytes: %8.1f ns/call %8.2f GB/s\n",
+                     sizes[s],
+                     (double)elapsed / (double)calls,
+                     (double)(calls * sizes[s]) / (double)elapsed);
+    }
+    (void)printf("(checksum %04x)\n", (unsigned)crc);
+    return 0;
+}
@@ -0,0 +1,199 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal.
+//
+// Compares the per-frame RX ingestion API against batch ingestion on a synthetic Classic CAN workload.
+// The workload consists of back-to-back multi-frame Cyphal v1.1 message transfers from several remote nodes,
+// which is the case where consecutive frames share the CAN ID and the batch API can reuse the routing decisions.
+//
+// Usage: bench_rx_ingest [iterations]
+
+#define _DEFAULT_SOURCE // For clock_gettime, struct timespec, etc.
+#include <canard.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SUBJECT_ID       1000U
+#define PAYLOAD_SIZE     62U // Classic CAN: 62 bytes of payload + 2 bytes of CRC occupy 10 frames with 7 bytes each.
+#define NODE_COUNT       8U
+#define FRAMES_PER_XFER  ((PAYLOAD_SIZE + 2U + 6U) / 7U)
+#define TRANSFERS        32U // Per node per batch; transfer-IDs wrap modulo 32.
+#define FRAME_COUNT      (NODE_COUNT * TRANSFERS * FRAMES_PER_XFER)
+#define FRAME_MTU        8U
+#define DEFAULT_ITERS    200U
+#define SOURCE_NODE_BASE 10U
+
+static int64_t get_monotonic_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000LL) + (int64_t)ts.tv_nsec;
+}
+
+static void mem_free(const canard_mem_t mem, const size_t size, void* const ptr)
+{
+    (void)mem;
+    (void)size;
+    free(ptr);
+}
+static void* mem_alloc(const canard_mem_t mem, const size_t size)
+{
+    (void)mem;
+    return malloc(size);
+}
+static const canard_mem_vtable_t g_mem_vtable = { .free = mem_free, .alloc = mem_alloc };
+
+static canard_us_t g_now = 0;
+static canard_us_t vtable_now(const canard_t* const self)
+{
+    (void)self;
+    return g_now;
+}
+static bool vtable_tx(canard_t* const      self,
+                      void* const          user_context,
+                      const canard_us_t    deadline,
+                      const uint_least8_t  iface_index,
+                      const bool           fd,
+                      const uint32_t       extended_can_id,
+                      const canard_bytes_t can_data)
+{
+    (void)self;
+    (void)user_context;
+    (void)deadline;
+    (void)iface_index;
+    (void)fd;
+    (void)extended_can_id;
+    (void)can_data;
+    return false;
+}
+static const canard_vtable_t g_vtable = { .now = vtable_now, .tx = vtable_tx, .filter = NULL };
+
+static size_t g_received = 0;
+static void   on_message(canard_subscription_t* const self,
+                         const canard_us_t            timestamp,
+                         const canard_prio_t          priority,
+                         const uint_least8_t          source_node_id,
+                         const uint_least8_t          transfer_id,
+                         const canard_payload_t       payload)
+{
+    (void)self;
+    (void)timestamp;
+    (void)priority;
+    (void)source_node_id;
+    (void)transfer_id;
+    g_received++;
+    if ((payload.origin.size > 0) && (payload.origin.data != NULL)) {
+        free(payload.origin.data);
+    }
+}
+static const canard_subscription_vtable_t g_sub_vtable = { .on_message = on_message };
+
+static uint16_t crc16_ccitt(const uint_least8_t* const data, const size_t size)
+{
+    uint32_t crc = 0xFFFFU;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= (uint32_t)data[i] << 8U;
+        for (size_t k = 0; k < 8; k++) {
+            crc = (((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U)) & 0xFFFFU;
+        }
+    }
+    return (uint16_t)crc;
+}
+
+static uint_least8_t  g_storage[FRAME_COUNT][FRAME_MTU];
+static canard_frame_t g_frames[FRAME_COUNT];
+
+// Fills g_frames with TRANSFERS consecutive transfers from each node, with the nodes taking turns.
+static void make_workload(void)
+{
+    uint_least8_t payload[PAYLOAD_SIZE + 2U];
+    for (size_t i = 0; i < PAYLOAD_SIZE; i++) {
+        payload[i] = (uint_least8_t)(i * 7U);
+    }
+    const uint16_t crc         = crc16_ccitt(payload, PAYLOAD_SIZE);
+    payload[PAYLOAD_SIZE]      = (uint_least8_t)(crc >> 8U);
+    payload[PAYLOAD_SIZE + 1U] = (uint_least8_t)(crc & 0xFFU);
+    size_t n                   = 0;
+    for (size_t tid = 0; tid < TRANSFERS; tid++) {
+        for (size_t node = 0; node < NODE_COUNT; node++) {
+            const uint32_t can_id = ((uint32_t)canard_prio_nominal << 26U) | ((uint32_t)SUBJECT_ID << 8U) |
+                                    (1UL << 7U) | (uint32_t)(SOURCE_NODE_BASE + node);
+            size_t offset = 0;
+            for (size_t f = 0; f < FRAMES_PER_XFER; f++) {
+                const size_t chunk = ((sizeof(payload) - offset) < 7U) ? (sizeof(payload) - offset) : 7U;
+                (void)memcpy(g_storage[n], &payload[offset], chunk);
+                offset += chunk;
+                const bool sot              = f == 0U;
+                const bool eot              = f == (FRAMES_PER_XFER - 1U);
+                const bool toggle           = (f % 2U) == 0U;
+                g_storage[n][chunk]         = (uint_least8_t)((sot ? 0x80U : 0U) | (eot ? 0x40U : 0U) |
+                                                      (toggle ? 0x20U : 0U) | (tid & 0x1FU));
+                g_frames[n].iface_index     = 0;
+                g_frames[n].extended_can_id = can_id;
+                g_frames[n].can_data        = (canard_bytes_t){ .size = chunk + 1U, .data = g_storage[n] };
+                n++;
+            }
+        }
+    }
+}
+
+static void stamp(const canard_us_t base)
+{
+    for (size_t i = 0; i < FRAME_COUNT; i++) {
+        g_frames[i].timestamp = base + (canard_us_t)i;
+    }
+    g_now = base + FRAME_COUNT;
+}
+
+static double run(const bool batch, const size_t iterations)
+{
+    const canard_mem_t     r   = { .vtable = &g_mem_vtable, .context = NULL };
+    const canard_mem_set_t mem = { .tx_transfer = r, .tx_frame = r, .rx_session = r, .rx_payload = r, .rx_filters = r };
+    canard_t               canard;
+    canard_subscription_t  sub;
+    if (!canard_new(&canard, &g_vtable, mem, 1U, 16U, 1234U, 0U) || !canard_set_node_id(&canard, 42U) ||
+        (canard_subscribe_16b(&canard, &sub, SUBJECT_ID, PAYLOAD_SIZE, 1000000, &g_sub_vtable) == NULL)) {
+        (void)fprintf(stderr, "Initialization failed\n");
+        exit(1);
+    }
+    g_received      = 0;
+    int64_t elapsed = 0;
+    for (size_t it = 0; it < iterations; it++) {
+        stamp((canard_us_t)(it * 10000000U));
+        const int64_t started = get_monotonic_ns();
+        if (batch) {
+            (void)canard_ingest_frames(&canard, FRAME_COUNT, g_frames);
+        } else {
+            for (size_t i = 0; i < FRAME_COUNT; i++) {
+                const canard_frame_t* const fr = &g_frames[i];
+                (void)canard_ingest_frame(&canard, fr->timestamp, fr->iface_index, fr->extended_can_id, fr->can_data);
+            }
+        }
+        elapsed += get_monotonic_ns() - started;
+    }
+    if (g_received != (iterations * NODE_COUNT * TRANSFERS)) {
+        (void)fprintf(stderr, "Unexpected transfer count %zu\n", g_received);
+        exit(1);
+    }
+    canard_unsubscribe(&canard, &sub);
+    canard_destroy(&canard);
+    return (double)elapsed / (double)(iterations * FRAME_COUNT);
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const size_t iterations = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_ITERS;
+    if (iterations == 0) {
+        (void)fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+    make_workload();
+    (void)run(true, 1U); // Warm up the caches and the allocator.
+    const double single = run(false, iterations);
+    const double batch  = run(true, iterations);
+    (void)printf("frames per iteration: %u, iterations: %zu\n", (unsigned)FRAME_COUNT, iterations);
+    (void)printf("canard_ingest_frame : %8.1f ns/frame\n", single);
+    (void)printf("canard_ingest_frames: %8.1f ns/frame\n", batch);
+    return 0;
+}
@@ -0,0 +1,166 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal.
+//
+// Measures the cost of the per-remote RX session lookup as a function of the number of active remote nodes.
+// The workload consists of single-frame Cyphal v1.1 message transfers on one subject with the remote nodes taking
+// turns, so that every frame requires a session lookup for a different node than the previous frame.
+// The node-IDs are spread over the whole range to exercise both limbs of the session bitmap. The local node takes
+// node-ID 0, so at most 127 remotes can be active; this is used in place of 128 to avoid node-ID collisions.
+//
+// Usage: bench_rx_sessions [iterations]
+
+#define _DEFAULT_SOURCE // For clock_gettime, struct timespec, etc.
+#include <canard.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SUBJECT_ID    1000U
+#define TRANSFERS     32U // Per node per iteration; transfer-IDs wrap modulo 32.
+#define MAX_NODES     127U // Node-IDs 1..127; 0 is the local node.
+#define FRAME_MTU     8U
+#define DEFAULT_ITERS 200U
+
+static int64_t get_monotonic_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000LL) + (int64_t)ts.tv_nsec;
+}
+
+static void mem_free(const canard_mem_t mem, const size_t size, void* const ptr)
+{
+    (void)mem;
+    (void)size;
+    free(ptr);
+}
+static void* mem_alloc(const canard_mem_t mem, const size_t size)
+{
+    (void)mem;
+    return malloc(size);
+}
+static const canard_mem_vtable_t g_mem_vtable = { .free = mem_free, .alloc = mem_alloc };
+
+static canard_us_t g_now = 0;
+static canard_us_t vtable_now(const canard_t* const self)
+{
+    (void)self;
+    return g_now;
+}
+static bool vtable_tx(canard_t* const      self,
+                      void* const          user_context,
+                      const canard_us_t    deadline,
+                      const uint_least8_t  iface_index,
+                      const bool           fd,
+                      const uint32_t       extended_can_id,
+                      const canard_bytes_t can_data)
+{
+    (void)self;
+    (void)user_context;
+    (void)deadline;
+    (void)iface_index;
+    (void)fd;
+    (void)extended_can_id;
+    (void)can_data;
+    return false;
+}
+static const canard_vtable_t g_vtable = { .now = vtable_now, .tx = vtable_tx, .filter = NULL };
+
+static size_t g_received = 0;
+static void   on_message(canard_subscription_t* const self,
+                         const canard_us_t            timestamp,
+                         const canard_prio_t          priority,
+                         const uint_least8_t          source_node_id,
+                         const uint_least8_t          transfer_id,
+                         const canard_payload_t       payload)
+{
+    (void)self;
+    (void)timestamp;
+    (void)priority;
+    (void)source_node_id;
+    (void)transfer_id;
+    g_received++;
+    if ((payload.origin.size > 0) && (payload.origin.data != NULL)) {
+        free(payload.origin.data);
+    }
+}
+static const canard_subscription_vtable_t g_sub_vtable = { .on_message = on_message };
+
+static uint_least8_t  g_storage[MAX_NODES * TRANSFERS][FRAME_MTU];
+static canard_frame_t g_frames[MAX_NODES * TRANSFERS];
+
+// Fills g_frames with TRANSFERS single-frame transfers from each of the node_count nodes, with the nodes taking turns.
+// Returns the number of frames.
+static size_t make_workload(const size_t node_count)
+{
+    const size_t stride = MAX_NODES / node_count;
+    size_t       n      = 0;
+    for (size_t tid = 0; tid < TRANSFERS; tid++) {
+        for (size_t node = 0; node < node_count; node++) {
+            const size_t   node_id = 1U + (node * stride);
+            const uint32_t can_id  = ((uint32_t)canard_prio_nominal << 26U) | ((uint32_t)SUBJECT_ID << 8U) |
+                                    (1UL << 7U) | (uint32_t)node_id;
+            (void)memset(g_storage[n], (int)node_id, FRAME_MTU - 1U);
+            g_storage[n][FRAME_MTU - 1U] = (uint_least8_t)(0xE0U | (tid & 0x1FU)); // SOT, EOT, toggle.
+            g_frames[n].iface_index      = 0;
+            g_frames[n].extended_can_id  = can_id;
+            g_frames[n].can_data         = (canard_bytes_t){ .size = FRAME_MTU, .data = g_storage[n] };
+            n++;
+        }
+    }
+    return n;
+}
+
+static double run(const size_t node_count, const size_t iterations)
+{
+    const canard_mem_t     r   = { .vtable = &g_mem_vtable, .context = NULL };
+    const canard_mem_set_t mem = { .tx_transfer = r, .tx_frame = r, .rx_session = r, .rx_payload = r, .rx_filters = r };
+    canard_t               canard;
+    canard_subscription_t  sub;
+    if (!canard_new(&canard, &g_vtable, mem, 1U, 16U, 1234U, 0U) || !canard_set_node_id(&canard, 0U) ||
+        (canard_subscribe_16b(&canard, &sub, SUBJECT_ID, 16U, 0, &g_sub_vtable) == NULL)) {
+        (void)fprintf(stderr, "Initialization failed\n");
+        exit(1);
+    }
+    const size_t frame_count = make_workload(node_count);
+    g_received               = 0;
+    int64_t elapsed          = 0;
+    for (size_t it = 0; it < iterations; it++) {
+        const canard_us_t base = (canard_us_t)(it * 10000000U);
+        for (size_t i = 0; i < frame_count; i++) {
+            g_frames[i].timestamp = base + (canard_us_t)i;
+        }
+        g_now                 = base + (canard_us_t)frame_count;
+        const int64_t started = get_monotonic_ns();
+        for (size_t i = 0; i < frame_count; i++) {
+            const canard_frame_t* const fr = &g_frames[i];
+            (void)canard_ingest_frame(&canard, fr->timestamp, fr->iface_index, fr->extended_can_id, fr->can_data);
+        }
+        elapsed += get_monotonic_ns() - started;
+    }
+    if (g_received != (iterations * frame_count)) {
+        (void)fprintf(stderr, "Unexpected transfer count %zu\n", g_received);
+        exit(1);
+    }
+    canard_unsubscribe(&canard, &sub);
+    canard_destroy(&canard);
+    return (double)elapsed / (double)(iterations * frame_count);
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const size_t iterations = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_ITERS;
+    if (iterations == 0) {
+        (void)fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+    static const size_t node_counts[] = { 8U, 32U, MAX_NODES };
+    (void)run(MAX_NODES, 1U); // Warm up the caches and the allocator.
+    (void)printf("iterations: %zu\n", iterations);
+    for (size_t i = 0; i < (sizeof(node_counts) / sizeof(node_counts[0])); i++) {
+        const double ns = run(node_counts[i], iterations);
+        (void)printf("%3zu remote nodes: %8.1f ns/frame\n", node_counts[i], ns);
+    }
+    return 0;
+}
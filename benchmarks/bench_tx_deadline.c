@@ -0,0 +1,141 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal.
+//
+// Measures the cost of the TX deadline index maintenance as a function of the queue depth.
+// The queue is kept at a constant depth of short-deadline single-frame transfers that are never transmitted:
+// every publication advances the time such that exactly one queued transfer expires, so each operation consists of
+// one insertion into and one removal from the deadline index, plus the constant overheads of the TX pipeline.
+// The subject-IDs are scrambled to avoid a degenerate insertion pattern in the pending queue.
+// The deadline index is selected at build time via CANARD_TX_DEADLINE_WHEEL_SIZE, so this benchmark is built once
+// per index implementation; compare the outputs of the builds.
+//
+// Usage: bench_tx_deadline [iterations]
+
+#define _DEFAULT_SOURCE // For clock_gettime, struct timespec, etc.
+#include <canard.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TIME_STEP_us  10 // Between publications; the deadline horizon is the queue depth times this.
+#define DEFAULT_ITERS 1000000U
+
+static int64_t get_monotonic_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000LL) + (int64_t)ts.tv_nsec;
+}
+
+static void mem_free(const canard_mem_t mem, const size_t size, void* const ptr)
+{
+    (void)mem;
+    (void)size;
+    free(ptr);
+}
+static void* mem_alloc(const canard_mem_t mem, const size_t size)
+{
+    (void)mem;
+    return malloc(size);
+}
+static const canard_mem_vtable_t g_mem_vtable = { .free = mem_free, .alloc = mem_alloc };
+
+static canard_us_t g_now = 0;
+static canard_us_t vtable_now(const canard_t* const self)
+{
+    (void)self;
+    return g_now;
+}
+static bool vtable_tx(canard_t* const      self,
+                      void* const          user_context,
+                      const canard_us_t    deadline,
+                      const uint_least8_t  iface_index,
+                      const bool           fd,
+                      const uint32_t       extended_can_id,
+                      const canard_bytes_t can_data)
+{
+    (void)self;
+    (void)user_context;
+    (void)deadline;
+    (void)iface_index;
+    (void)fd;
+    (void)extended_can_id;
+    (void)can_data;
+    return false;
+}
+static const canard_vtable_t g_vtable = { .now = vtable_now, .tx = vtable_tx, .filter = NULL };
+
+static uint16_t scramble_subject_id(const size_t i) { return (uint16_t)((i * 40503U) & 0x1FFFU); }
+
+static void publish(canard_t* const canard, const size_t i, const canard_us_t deadline)
+{
+    static const uint_least8_t        data[]  = { 1, 2, 3, 4 };
+    static const canard_bytes_chain_t payload = { .bytes = { .size = sizeof(data), .data = data }, .next = NULL };
+    if (!canard_publish_16b(canard,
+                            deadline,
+                            1U,
+                            canard_prio_nominal,
+                            scramble_subject_id(i),
+                            (uint_least8_t)(i & CANARD_TRANSFER_ID_MAX),
+                            payload,
+                            NULL)) {
+        (void)fprintf(stderr, "Publication failed\n");
+        exit(1);
+    }
+}
+
+static double run(const size_t depth, const size_t iterations)
+{
+    const canard_mem_t     r   = { .vtable = &g_mem_vtable, .context = NULL };
+    const canard_mem_set_t mem = { .tx_transfer = r, .tx_frame = r, .rx_session = r, .rx_payload = r, .rx_filters = r };
+    canard_t               canard;
+    if (!canard_new(&canard, &g_vtable, mem, 1U, depth + 1U, 1234U, 0U) || !canard_set_node_id(&canard, 42U)) {
+        (void)fprintf(stderr, "Initialization failed\n");
+        exit(1);
+    }
+    const canard_us_t horizon = (canard_us_t)depth * TIME_STEP_us;
+    g_now                     = 0;
+    for (size_t i = 0; i < depth; i++) {
+        publish(&canard, i, horizon + ((canard_us_t)i * TIME_STEP_us));
+    }
+    const uint64_t expired_before = canard.err.tx_expiration;
+    const int64_t  started        = get_monotonic_ns();
+    for (size_t i = depth; i < (depth + iterations); i++) {
+        g_now = horizon + ((canard_us_t)(i - depth) * TIME_STEP_us) + 1;
+        publish(&canard, i, horizon + ((canard_us_t)i * TIME_STEP_us));
+    }
+    const int64_t elapsed = get_monotonic_ns() - started;
+    if (((canard.err.tx_expiration - expired_before) != iterations) || (canard.tx.queue_size != depth)) {
+        (void)fprintf(stderr,
+                      "Unexpected queue state: expired %llu, depth %zu\n",
+                      (unsigned long long)(canard.err.tx_expiration - expired_before),
+                      canard.tx.queue_size);
+        exit(1);
+    }
+    canard_destroy(&canard);
+    return (double)elapsed / (double)iterations;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const size_t iterations = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_ITERS;
+    if (iterations == 0) {
+        (void)fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+    static const size_t depths[] = { 100U, 1000U, 10000U };
+    (void)run(depths[0], (iterations / 10U) + 1U); // Warm up the caches and the allocator.
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+    (void)printf("deadline index: timer wheel, %u buckets of %ld us\n",
+                 (unsigned)CANARD_TX_DEADLINE_WHEEL_SIZE,
+                 (long)CANARD_TX_DEADLINE_WHEEL_TICK_us);
+#else
+    (void)printf("deadline index: AVL tree\n");
+#endif
+    (void)printf("iterations: %zu\n", iterations);
+    for (size_t i = 0; i < (sizeof(depths) / sizeof(depths[0])); i++) {
+        const double ns = run(depths[i], iterations);
+        (void)printf("%5zu queued transfers: %8.1f ns/publication\n", depths[i], ns);
+    }
+    return 0;
+}
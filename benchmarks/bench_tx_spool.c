@@ -0,0 +1,128 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal.
+//
+// Measures the allocator traffic and the time it takes to enqueue and transmit transfers of various sizes.
+// The spool layout is selected at build time via CANARD_TX_CONTIGUOUS_SPOOL and CANARD_TX_INLINE_FRAME_SIZE,
+// so this benchmark is built once per layout; compare the outputs of the builds.
+//
+// Usage: bench_tx_spool [iterations]
+
+#define _DEFAULT_SOURCE // For clock_gettime, struct timespec, etc.
+#include <canard.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DEFAULT_ITERS 100000U
+
+static int64_t get_monotonic_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000LL) + (int64_t)ts.tv_nsec;
+}
+
+static uint64_t g_alloc_count = 0;
+
+static void mem_free(const canard_mem_t mem, const size_t size, void* const ptr)
+{
+    (void)mem;
+    (void)size;
+    free(ptr);
+}
+static void* mem_alloc(const canard_mem_t mem, const size_t size)
+{
+    (void)mem;
+    g_alloc_count++;
+    return malloc(size);
+}
+static const canard_mem_vtable_t g_mem_vtable = { .free = mem_free, .alloc = mem_alloc };
+
+static canard_us_t vtable_now(const canard_t* const self)
+{
+    (void)self;
+    return 0;
+}
+static bool vtable_tx(canard_t* const      self,
+                      void* const          user_context,
+                      const canard_us_t    deadline,
+                      const uint_least8_t  iface_index,
+                      const bool           fd,
+                      const uint32_t       extended_can_id,
+                      const canard_bytes_t can_data)
+{
+    (void)self;
+    (void)user_context;
+    (void)deadline;
+    (void)iface_index;
+    (void)fd;
+    (void)extended_can_id;
+    (void)can_data;
+    return true;
+}
+static const canard_vtable_t g_vtable = { .now = vtable_now, .tx = vtable_tx, .filter = NULL };
+
+static uint_least8_t g_data[4096];
+
+// Returns the time per transfer; the number of allocations per transfer is stored into the output argument.
+static double run(const bool fd, const size_t size, const size_t iterations, double* const allocs)
+{
+    const canard_mem_t     r   = { .vtable = &g_mem_vtable, .context = NULL };
+    const canard_mem_set_t mem = { .tx_transfer = r, .tx_frame = r, .rx_session = r, .rx_payload = r, .rx_filters = r };
+    canard_t               canard;
+    if (!canard_new(&canard, &g_vtable, mem, 1U, 1000U, 1234U, 0U) || !canard_set_node_id(&canard, 42U)) {
+        (void)fprintf(stderr, "Initialization failed\n");
+        exit(1);
+    }
+    canard.tx.fd                       = fd;
+    const canard_bytes_chain_t payload = { .bytes = { .size = size, .data = g_data }, .next = NULL };
+    const uint64_t             before  = g_alloc_count;
+    const int64_t              started = get_monotonic_ns();
+    for (size_t i = 0; i < iterations; i++) {
+        const uint_least8_t tid = (uint_least8_t)(i & CANARD_TRANSFER_ID_MAX);
+        if (!canard_publish_16b(&canard, 1000000, 1U, canard_prio_nominal, 1000U, tid, payload, NULL)) {
+            (void)fprintf(stderr, "Publication failed\n");
+            exit(1);
+        }
+        canard_poll(&canard, 1U);
+    }
+    const int64_t elapsed = get_monotonic_ns() - started;
+    if (canard.tx.queue_size != 0U) {
+        (void)fprintf(stderr, "Unexpected queue state: %zu frames left\n", canard.tx.queue_size);
+        exit(1);
+    }
+    *allocs = (double)(g_alloc_count - before) / (double)iterations;
+    canard_destroy(&canard);
+    return (double)elapsed / (double)iterations;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const size_t iterations = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_ITERS;
+    if (iterations == 0) {
+        (void)fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+    double allocs = 0;
+    (void)run(false, 64U, (iterations / 10U) + 1U, &allocs); // Warm up the caches and the allocator.
+#if CANARD_TX_CONTIGUOUS_SPOOL
+    (void)printf("spool layout: contiguous, ");
+#else
+    (void)printf("spool layout: one allocation per frame, ");
+#endif
+    (void)printf("inline frame size: %u\n", (unsigned)CANARD_TX_INLINE_FRAME_SIZE);
+    (void)printf("iterations: %zu\n", iterations);
+    static const size_t sizes[] = { 7U, 64U, 512U, 4096U };
+    for (size_t f = 0; f < 2U; f++) {
+        for (size_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++) {
+            const double ns = run(f != 0U, sizes[s], iterations, &allocs);
+            (void)printf("%-7s %4zu bytes: %9.1f ns/transfer, %6.1f allocations/transfer, %6.2f allocations/KiB\n",
+                         (f != 0U) ? "CAN FD" : "Classic",
+                         sizes[s],
+                         ns,
+                         allocs,
+                         (allocs * 1024.0) / (double)sizes[s]);
+        }
+    }
+    return 0;
+}
@@ -25,6 +25,40 @@
 #define CANARD_ASSERT(x) assert(x) // NOSONAR
 #endif
 
+// Selects the transfer CRC implementation. The choice affects only the ROM footprint and the throughput:
+//  - BITWISE: no lookup tables; the smallest and the slowest option.
+//  - TABLE:   one byte per step using a 512-byte table; this is the default.
+//  - SLICE4:  slice-by-4 using 2 KiB of tables.
+//  - SLICE8:  slice-by-8 using 4 KiB of tables.
+//  - CLMUL:   carry-less multiplication folding of 64-byte blocks using x86 PCLMULQDQ or AArch64 PMULL, with SLICE8
+//             handling the short inputs. The target must support the instructions (e.g., -mpclmul -mssse3 on x86,
+//             -march=armv8-a+crypto on AArch64), otherwise the build fails.
+// For compatibility with older configurations, CANARD_CRC_TABLE=0 selects the bitwise implementation.
+#define CANARD_CRC_BACKEND_BITWISE 0
+#define CANARD_CRC_BACKEND_TABLE   1
+#define CANARD_CRC_BACKEND_SLICE4  4
+#define CANARD_CRC_BACKEND_SLICE8  8
+#define CANARD_CRC_BACKEND_CLMUL   16
+#ifndef CANARD_CRC_BACKEND
+#if defined(CANARD_CRC_TABLE) && !CANARD_CRC_TABLE
+#define CANARD_CRC_BACKEND CANARD_CRC_BACKEND_BITWISE
+#else
+#define CANARD_CRC_BACKEND CANARD_CRC_BACKEND_TABLE
+#endif
+#endif
+#if CANARD_CRC_BACKEND == CANARD_CRC_BACKEND_CLMUL
+#if defined(__PCLMUL__) && defined(__SSSE3__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#include <arm_neon.h>
+#else
+#error "CANARD_CRC_BACKEND_CLMUL requires PCLMULQDQ+SSSE3 (x86) or PMULL (AArch64) to be enabled for the target"
+#endif
+#elif (CANARD_CRC_BACKEND != CANARD_CRC_BACKEND_BITWISE) && (CANARD_CRC_BACKEND != CANARD_CRC_BACKEND_TABLE) && \
+  (CANARD_CRC_BACKEND != CANARD_CRC_BACKEND_SLICE4) && (CANARD_CRC_BACKEND != CANARD_CRC_BACKEND_SLICE8)
+#error "Unknown CANARD_CRC_BACKEND"
+#endif
+
 #if __STDC_VERSION__ < 201112L
 // Intentional violation of MISRA: static assertion macro cannot be replaced with a function definition.
 #define static_assert(x, ...)   typedef char _static_assert_gl(_static_assertion_, __LINE__)[(x) ? 1 : -1] // NOSONAR
@@ -47,6 +81,7 @@ typedef unsigned char byte_t;
 
 #define BYTE_MAX           0xFFU
 #define BIG_BANG           INT64_MIN
+#define HEAT_DEATH         INT64_MAX
 #define CAN_EXT_ID_MASK    ((UINT32_C(1) << 29U) - 1U)
 #define PADDING_BYTE_VALUE 0U
 #define PRIO_SHIFT         26U
@@ -89,6 +124,7 @@ const uint_least8_t canard_len_to_dlc[65] = {
 
 static size_t      smaller(const size_t a, const size_t b) { return (a < b) ? a : b; }
 static canard_us_t later(const canard_us_t a, const canard_us_t b) { return (a > b) ? a : b; }
+static canard_us_t sooner(const canard_us_t a, const canard_us_t b) { return (a < b) ? a : b; }
 
 // Used if intrinsics are not available.
 // http://en.wikipedia.org/wiki/Hamming_weight#Efficient_implementation
@@ -135,8 +171,18 @@ static uint64_t random(canard_t* const self, const uint64_t bound)
 // Returns true with a probability of approximately 1/p_reciprocal. If p_reciprocal<=1, result is always true.
 static bool chance(canard_t* const self, const uint64_t p_reciprocal) { return random(self, p_reciprocal) == 0; }
 
+// True if the protocol version is enabled both at build time and at runtime. The build-time part is a constant,
+// which allows the compiler to eliminate the code paths of the versions that are disabled at build time.
+static bool protocol_enabled(const canard_t* const self, const byte_t version)
+{
+    CANARD_ASSERT(version < 2U);
+    const unsigned bit = 1U << version;
+    return ((CANARD_PROTOCOL_ALL & bit) != 0U) && ((self->protocols_disabled & bit) == 0U);
+}
+
 // Least significant bit at limb #0, bit #0.
 static void bitmap_set(uint64_t* const b, const size_t i) { b[i / 64U] |= (UINT64_C(1) << (i % 64U)); }
+static void bitmap_clear(uint64_t* const b, const size_t i) { b[i / 64U] &= ~(UINT64_C(1) << (i % 64U)); }
 static bool bitmap_test(const uint64_t* const b, const size_t i) { return (b[i / 64U] & (1ULL << (i % 64U))) != 0; }
 
 static void* mem_alloc(const canard_mem_t memory, const size_t size) { return memory.vtable->alloc(memory, size); }
@@ -166,6 +212,26 @@ static bool mem_valid(const canard_mem_t memory)
 #define CRC_INITIAL 0xFFFFU
 #define CRC_RESIDUE 0x0000U
 #define CRC_BYTES   2U
+#define CRC_POLY    0x1021U
+
+#if CANARD_CRC_BACKEND == CANARD_CRC_BACKEND_CLMUL
+#define CRC_SLICE 8U
+#else
+#define CRC_SLICE CANARD_CRC_BACKEND // Bytes per table-driven step; 0 for the bitwise version.
+#endif
+
+#if CRC_SLICE == 0
+
+static uint16_t crc_add_byte(const uint16_t crc, const byte_t byte)
+{
+    uint16_t out = (uint16_t)(crc ^ (uint16_t)((uint16_t)byte << 8U));
+    for (size_t i = 0; i < 8U; i++) {
+        out = (uint16_t)(((out & 0x8000U) != 0U) ? (((unsigned)out << 1U) ^ CRC_POLY) : ((unsigned)out << 1U));
+    }
+    return out;
+}
+
+#else
 
 static const uint16_t crc_table[256] = {
     0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U, 0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU,
@@ -195,18 +261,374 @@ static uint16_t crc_add_byte(const uint16_t crc, const byte_t byte)
     return (uint16_t)((uint16_t)(crc << 8U) ^ crc_table[(uint16_t)((uint16_t)(crc >> 8U) ^ byte) & BYTE_MAX]);
 }
 
-static uint16_t crc_add(const uint16_t crc, const size_t size, const void* const data)
+#endif
+
+#if CRC_SLICE > 1
+
+// crc_table_slice[k-1][b] is the CRC of the byte b followed by k zero bytes computed from the zero initial value.
+// The CRC is linear, so the contributions of the bytes of a block can be looked up independently and XORed together,
+// with the current CRC value XORed into the first two bytes of the block.
+static const uint16_t crc_table_slice[CRC_SLICE - 1U][256] = {
+    {
+      0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U, 0x89A9U, 0xBA98U, 0xEFCBU, 0xDCFAU,
+      0x456DU, 0x765CU, 0x230FU, 0x103EU, 0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U,
+      0x8ADAU, 0xB9EBU, 0xECB8U, 0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU, 0x06E6U, 0x35D7U, 0x6084U, 0x53B5U,
+      0xCA22U, 0xF913U, 0xAC40U, 0x9F71U, 0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU, 0x70BAU, 0x25E9U, 0x16D8U,
+      0x0595U, 0x36A4U, 0x63F7U, 0x50C6U, 0xC951U, 0xFA60U, 0xAF33U, 0x9C02U, 0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU,
+      0x40F8U, 0x73C9U, 0x269AU, 0x15ABU, 0x0DCCU, 0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU,
+      0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U, 0x2EC3U, 0x1DF2U, 0x0EBFU, 0x3D8EU, 0x68DDU, 0x5BECU,
+      0xC27BU, 0xF14AU, 0xA419U, 0x9728U, 0x8716U, 0xB427U, 0xE174U, 0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U,
+      0x0B2AU, 0x381BU, 0x6D48U, 0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU, 0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U,
+      0x4E47U, 0x7D76U, 0x2825U, 0x1B14U, 0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU, 0xF7ACU, 0xA2FFU, 0x91CEU,
+      0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U, 0x2B56U, 0x1867U, 0x1B98U, 0x28A9U, 0x7DFAU, 0x4ECBU,
+      0xD75CU, 0xE46DU, 0xB13EU, 0x820FU, 0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U, 0x0BA6U,
+      0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU, 0x9142U, 0xA273U, 0xF720U, 0xC411U,
+      0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U, 0x1D7EU, 0x2E4FU, 0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U,
+      0x94D7U, 0xA7E6U, 0xF2B5U, 0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U, 0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU,
+      0xD2C9U, 0xE1F8U, 0xB4ABU, 0x879AU, 0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U, 0x6851U, 0x3D02U, 0x0E33U,
+      0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xDA90U, 0xE9A1U, 0xBCF2U, 0x8FC3U, 0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU,
+      0x5339U, 0x6008U, 0x355BU, 0x066AU, 0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U,
+      0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU, 0x637BU, 0x3628U, 0x0519U, 0x10B2U, 0x2383U, 0x76D0U, 0x45E1U,
+      0xDC76U, 0xEF47U, 0xBA14U, 0x8925U, 0x991BU, 0xAA2AU, 0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU,
+      0x13C1U, 0x20F0U, 0x75A3U, 0x4692U, 0xDF05U, 0xEC34U, 0xB967U, 0x8A56U, 0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU,
+      0x56ACU, 0x659DU, 0x30CEU, 0x03FFU,
+    },
+    {
+      0x0000U, 0x3730U, 0x6E60U, 0x5950U, 0xDCC0U, 0xEBF0U, 0xB2A0U, 0x8590U, 0xA9A1U, 0x9E91U, 0xC7C1U, 0xF0F1U,
+      0x7561U, 0x4251U, 0x1B01U, 0x2C31U, 0x4363U, 0x7453U, 0x2D03U, 0x1A33U, 0x9FA3U, 0xA893U, 0xF1C3U, 0xC6F3U,
+      0xEAC2U, 0xDDF2U, 0x84A2U, 0xB392U, 0x3602U, 0x0132U, 0x5862U, 0x6F52U, 0x86C6U, 0xB1F6U, 0xE8A6U, 0xDF96U,
+      0x5A06U, 0x6D36U, 0x3466U, 0x0356U, 0x2F67U, 0x1857U, 0x4107U, 0x7637U, 0xF3A7U, 0xC497U, 0x9DC7U, 0xAAF7U,
+      0xC5A5U, 0xF295U, 0xABC5U, 0x9CF5U, 0x1965U, 0x2E55U, 0x7705U, 0x4035U, 0x6C04U, 0x5B34U, 0x0264U, 0x3554U,
+      0xB0C4U, 0x87F4U, 0xDEA4U, 0xE994U, 0x1DADU, 0x2A9DU, 0x73CDU, 0x44FDU, 0xC16DU, 0xF65DU, 0xAF0DU, 0x983DU,
+      0xB40CU, 0x833CU, 0xDA6CU, 0xED5CU, 0x68CCU, 0x5FFCU, 0x06ACU, 0x319CU, 0x5ECEU, 0x69FEU, 0x30AEU, 0x079EU,
+      0x820EU, 0xB53EU, 0xEC6EU, 0xDB5EU, 0xF76FU, 0xC05FU, 0x990FU, 0xAE3FU, 0x2BAFU, 0x1C9FU, 0x45CFU, 0x72FFU,
+      0x9B6BU, 0xAC5BU, 0xF50BU, 0xC23BU, 0x47ABU, 0x709BU, 0x29CBU, 0x1EFBU, 0x32CAU, 0x05FAU, 0x5CAAU, 0x6B9AU,
+      0xEE0AU, 0xD93AU, 0x806AU, 0xB75AU, 0xD808U, 0xEF38U, 0xB668U, 0x8158U, 0x04C8U, 0x33F8U, 0x6AA8U, 0x5D98U,
+      0x71A9U, 0x4699U, 0x1FC9U, 0x28F9U, 0xAD69U, 0x9A59U, 0xC309U, 0xF439U, 0x3B5AU, 0x0C6AU, 0x553AU, 0x620AU,
+      0xE79AU, 0xD0AAU, 0x89FAU, 0xBECAU, 0x92FBU, 0xA5CBU, 0xFC9BU, 0xCBABU, 0x4E3BU, 0x790BU, 0x205BU, 0x176BU,
+      0x7839U, 0x4F09U, 0x1659U, 0x2169U, 0xA4F9U, 0x93C9U, 0xCA99U, 0xFDA9U, 0xD198U, 0xE6A8U, 0xBFF8U, 0x88C8U,
+      0x0D58U, 0x3A68U, 0x6338U, 0x5408U, 0xBD9CU, 0x8AACU, 0xD3FCU, 0xE4CCU, 0x615CU, 0x566CU, 0x0F3CU, 0x380CU,
+      0x143DU, 0x230DU, 0x7A5DU, 0x4D6DU, 0xC8FDU, 0xFFCDU, 0xA69DU, 0x91ADU, 0xFEFFU, 0xC9CFU, 0x909FU, 0xA7AFU,
+      0x223FU, 0x150FU, 0x4C5FU, 0x7B6FU, 0x575EU, 0x606EU, 0x393EU, 0x0E0EU, 0x8B9EU, 0xBCAEU, 0xE5FEU, 0xD2CEU,
+      0x26F7U, 0x11C7U, 0x4897U, 0x7FA7U, 0xFA37U, 0xCD07U, 0x9457U, 0xA367U, 0x8F56U, 0xB866U, 0xE136U, 0xD606U,
+      0x5396U, 0x64A6U, 0x3DF6U, 0x0AC6U, 0x6594U, 0x52A4U, 0x0BF4U, 0x3CC4U, 0xB954U, 0x8E64U, 0xD734U, 0xE004U,
+      0xCC35U, 0xFB05U, 0xA255U, 0x9565U, 0x10F5U, 0x27C5U, 0x7E95U, 0x49A5U, 0xA031U, 0x9701U, 0xCE51U, 0xF961U,
+      0x7CF1U, 0x4BC1U, 0x1291U, 0x25A1U, 0x0990U, 0x3EA0U, 0x67F0U, 0x50C0U, 0xD550U, 0xE260U, 0xBB30U, 0x8C00U,
+      0xE352U, 0xD462U, 0x8D32U, 0xBA02U, 0x3F92U, 0x08A2U, 0x51F2U, 0x66C2U, 0x4AF3U, 0x7DC3U, 0x2493U, 0x13A3U,
+      0x9633U, 0xA103U, 0xF853U, 0xCF63U,
+    },
+    {
+      0x0000U, 0x76B4U, 0xED68U, 0x9BDCU, 0xCAF1U, 0xBC45U, 0x2799U, 0x512DU, 0x85C3U, 0xF377U, 0x68ABU, 0x1E1FU,
+      0x4F32U, 0x3986U, 0xA25AU, 0xD4EEU, 0x1BA7U, 0x6D13U, 0xF6CFU, 0x807BU, 0xD156U, 0xA7E2U, 0x3C3EU, 0x4A8AU,
+      0x9E64U, 0xE8D0U, 0x730CU, 0x05B8U, 0x5495U, 0x2221U, 0xB9FDU, 0xCF49U, 0x374EU, 0x41FAU, 0xDA26U, 0xAC92U,
+      0xFDBFU, 0x8B0BU, 0x10D7U, 0x6663U, 0xB28DU, 0xC439U, 0x5FE5U, 0x2951U, 0x787CU, 0x0EC8U, 0x9514U, 0xE3A0U,
+      0x2CE9U, 0x5A5DU, 0xC181U, 0xB735U, 0xE618U, 0x90ACU, 0x0B70U, 0x7DC4U, 0xA92AU, 0xDF9EU, 0x4442U, 0x32F6U,
+      0x63DBU, 0x156FU, 0x8EB3U, 0xF807U, 0x6E9CU, 0x1828U, 0x83F4U, 0xF540U, 0xA46DU, 0xD2D9U, 0x4905U, 0x3FB1U,
+      0xEB5FU, 0x9DEBU, 0x0637U, 0x7083U, 0x21AEU, 0x571AU, 0xCCC6U, 0xBA72U, 0x753BU, 0x038FU, 0x9853U, 0xEEE7U,
+      0xBFCAU, 0xC97EU, 0x52A2U, 0x2416U, 0xF0F8U, 0x864CU, 0x1D90U, 0x6B24U, 0x3A09U, 0x4CBDU, 0xD761U, 0xA1D5U,
+      0x59D2U, 0x2F66U, 0xB4BAU, 0xC20EU, 0x9323U, 0xE597U, 0x7E4BU, 0x08FFU, 0xDC11U, 0xAAA5U, 0x3179U, 0x47CDU,
+      0x16E0U, 0x6054U, 0xFB88U, 0x8D3CU, 0x4275U, 0x34C1U, 0xAF1DU, 0xD9A9U, 0x8884U, 0xFE30U, 0x65ECU, 0x1358U,
+      0xC7B6U, 0xB102U, 0x2ADEU, 0x5C6AU, 0x0D47U, 0x7BF3U, 0xE02FU, 0x969BU, 0xDD38U, 0xAB8CU, 0x3050U, 0x46E4U,
+      0x17C9U, 0x617DU, 0xFAA1U, 0x8C15U, 0x58FBU, 0x2E4FU, 0xB593U, 0xC327U, 0x920AU, 0xE4BEU, 0x7F62U, 0x09D6U,
+      0xC69FU, 0xB02BU, 0x2BF7U, 0x5D43U, 0x0C6EU, 0x7ADAU, 0xE106U, 0x97B2U, 0x435CU, 0x35E8U, 0xAE34U, 0xD880U,
+      0x89ADU, 0xFF19U, 0x64C5U, 0x1271U, 0xEA76U, 0x9CC2U, 0x071EU, 0x71AAU, 0x2087U, 0x5633U, 0xCDEFU, 0xBB5BU,
+      0x6FB5U, 0x1901U, 0x82DDU, 0xF469U, 0xA544U, 0xD3F0U, 0x482CU, 0x3E98U, 0xF1D1U, 0x8765U, 0x1CB9U, 0x6A0DU,
+      0x3B20U, 0x4D94U, 0xD648U, 0xA0FCU, 0x7412U, 0x02A6U, 0x997AU, 0xEFCEU, 0xBEE3U, 0xC857U, 0x538BU, 0x253FU,
+      0xB3A4U, 0xC510U, 0x5ECCU, 0x2878U, 0x7955U, 0x0FE1U, 0x943DU, 0xE289U, 0x3667U, 0x40D3U, 0xDB0FU, 0xADBBU,
+      0xFC96U, 0x8A22U, 0x11FEU, 0x674AU, 0xA803U, 0xDEB7U, 0x456BU, 0x33DFU, 0x62F2U, 0x1446U, 0x8F9AU, 0xF92EU,
+      0x2DC0U, 0x5B74U, 0xC0A8U, 0xB61CU, 0xE731U, 0x9185U, 0x0A59U, 0x7CEDU, 0x84EAU, 0xF25EU, 0x6982U, 0x1F36U,
+      0x4E1BU, 0x38AFU, 0xA373U, 0xD5C7U, 0x0129U, 0x779DU, 0xEC41U, 0x9AF5U, 0xCBD8U, 0xBD6CU, 0x26B0U, 0x5004U,
+      0x9F4DU, 0xE9F9U, 0x7225U, 0x0491U, 0x55BCU, 0x2308U, 0xB8D4U, 0xCE60U, 0x1A8EU, 0x6C3AU, 0xF7E6U, 0x8152U,
+      0xD07FU, 0xA6CBU, 0x3D17U, 0x4BA3U,
+    },
+#if CRC_SLICE > 4
+    {
+      0x0000U, 0xAA51U, 0x4483U, 0xEED2U, 0x8906U, 0x2357U, 0xCD85U, 0x67D4U, 0x022DU, 0xA87CU, 0x46AEU, 0xECFFU,
+      0x8B2BU, 0x217AU, 0xCFA8U, 0x65F9U, 0x045AU, 0xAE0BU, 0x40D9U, 0xEA88U, 0x8D5CU, 0x270DU, 0xC9DFU, 0x638EU,
+      0x0677U, 0xAC26U, 0x42F4U, 0xE8A5U, 0x8F71U, 0x2520U, 0xCBF2U, 0x61A3U, 0x08B4U, 0xA2E5U, 0x4C37U, 0xE666U,
+      0x81B2U, 0x2BE3U, 0xC531U, 0x6F60U, 0x0A99U, 0xA0C8U, 0x4E1AU, 0xE44BU, 0x839FU, 0x29CEU, 0xC71CU, 0x6D4DU,
+      0x0CEEU, 0xA6BFU, 0x486DU, 0xE23CU, 0x85E8U, 0x2FB9U, 0xC16BU, 0x6B3AU, 0x0EC3U, 0xA492U, 0x4A40U, 0xE011U,
+      0x87C5U, 0x2D94U, 0xC346U, 0x6917U, 0x1168U, 0xBB39U, 0x55EBU, 0xFFBAU, 0x986EU, 0x323FU, 0xDCEDU, 0x76BCU,
+      0x1345U, 0xB914U, 0x57C6U, 0xFD97U, 0x9A43U, 0x3012U, 0xDEC0U, 0x7491U, 0x1532U, 0xBF63U, 0x51B1U, 0xFBE0U,
+      0x9C34U, 0x3665U, 0xD8B7U, 0x72E6U, 0x171FU, 0xBD4EU, 0x539CU, 0xF9CDU, 0x9E19U, 0x3448U, 0xDA9AU, 0x70CBU,
+      0x19DCU, 0xB38DU, 0x5D5FU, 0xF70EU, 0x90DAU, 0x3A8BU, 0xD459U, 0x7E08U, 0x1BF1U, 0xB1A0U, 0x5F72U, 0xF523U,
+      0x92F7U, 0x38A6U, 0xD674U, 0x7C25U, 0x1D86U, 0xB7D7U, 0x5905U, 0xF354U, 0x9480U, 0x3ED1U, 0xD003U, 0x7A52U,
+      0x1FABU, 0xB5FAU, 0x5B28U, 0xF179U, 0x96ADU, 0x3CFCU, 0xD22EU, 0x787FU, 0x22D0U, 0x8881U, 0x6653U, 0xCC02U,
+      0xABD6U, 0x0187U, 0xEF55U, 0x4504U, 0x20FDU, 0x8AACU, 0x647EU, 0xCE2FU, 0xA9FBU, 0x03AAU, 0xED78U, 0x4729U,
+      0x268AU, 0x8CDBU, 0x6209U, 0xC858U, 0xAF8CU, 0x05DDU, 0xEB0FU, 0x415EU, 0x24A7U, 0x8EF6U, 0x6024U, 0xCA75U,
+      0xADA1U, 0x07F0U, 0xE922U, 0x4373U, 0x2A64U, 0x8035U, 0x6EE7U, 0xC4B6U, 0xA362U, 0x0933U, 0xE7E1U, 0x4DB0U,
+      0x2849U, 0x8218U, 0x6CCAU, 0xC69BU, 0xA14FU, 0x0B1EU, 0xE5CCU, 0x4F9DU, 0x2E3EU, 0x846FU, 0x6ABDU, 0xC0ECU,
+      0xA738U, 0x0D69U, 0xE3BBU, 0x49EAU, 0x2C13U, 0x8642U, 0x6890U, 0xC2C1U, 0xA515U, 0x0F44U, 0xE196U, 0x4BC7U,
+      0x33B8U, 0x99E9U, 0x773BU, 0xDD6AU, 0xBABEU, 0x10EFU, 0xFE3DU, 0x546CU, 0x3195U, 0x9BC4U, 0x7516U, 0xDF47U,
+      0xB893U, 0x12C2U, 0xFC10U, 0x5641U, 0x37E2U, 0x9DB3U, 0x7361U, 0xD930U, 0xBEE4U, 0x14B5U, 0xFA67U, 0x5036U,
+      0x35CFU, 0x9F9EU, 0x714CU, 0xDB1DU, 0xBCC9U, 0x1698U, 0xF84AU, 0x521BU, 0x3B0CU, 0x915DU, 0x7F8FU, 0xD5DEU,
+      0xB20AU, 0x185BU, 0xF689U, 0x5CD8U, 0x3921U, 0x9370U, 0x7DA2U, 0xD7F3U, 0xB027U, 0x1A76U, 0xF4A4U, 0x5EF5U,
+      0x3F56U, 0x9507U, 0x7BD5U, 0xD184U, 0xB650U, 0x1C01U, 0xF2D3U, 0x5882U, 0x3D7BU, 0x972AU, 0x79F8U, 0xD3A9U,
+      0xB47DU, 0x1E2CU, 0xF0FEU, 0x5AAFU,
+    },
+    {
+      0x0000U, 0x45A0U, 0x8B40U, 0xCEE0U, 0x06A1U, 0x4301U, 0x8DE1U, 0xC841U, 0x0D42U, 0x48E2U, 0x8602U, 0xC3A2U,
+      0x0BE3U, 0x4E43U, 0x80A3U, 0xC503U, 0x1A84U, 0x5F24U, 0x91C4U, 0xD464U, 0x1C25U, 0x5985U, 0x9765U, 0xD2C5U,
+      0x17C6U, 0x5266U, 0x9C86U, 0xD926U, 0x1167U, 0x54C7U, 0x9A27U, 0xDF87U, 0x3508U, 0x70A8U, 0xBE48U, 0xFBE8U,
+      0x33A9U, 0x7609U, 0xB8E9U, 0xFD49U, 0x384AU, 0x7DEAU, 0xB30AU, 0xF6AAU, 0x3EEBU, 0x7B4BU, 0xB5ABU, 0xF00BU,
+      0x2F8CU, 0x6A2CU, 0xA4CCU, 0xE16CU, 0x292DU, 0x6C8DU, 0xA26DU, 0xE7CDU, 0x22CEU, 0x676EU, 0xA98EU, 0xEC2EU,
+      0x246FU, 0x61CFU, 0xAF2FU, 0xEA8FU, 0x6A10U, 0x2FB0U, 0xE150U, 0xA4F0U, 0x6CB1U, 0x2911U, 0xE7F1U, 0xA251U,
+      0x6752U, 0x22F2U, 0xEC12U, 0xA9B2U, 0x61F3U, 0x2453U, 0xEAB3U, 0xAF13U, 0x7094U, 0x3534U, 0xFBD4U, 0xBE74U,
+      0x7635U, 0x3395U, 0xFD75U, 0xB8D5U, 0x7DD6U, 0x3876U, 0xF696U, 0xB336U, 0x7B77U, 0x3ED7U, 0xF037U, 0xB597U,
+      0x5F18U, 0x1AB8U, 0xD458U, 0x91F8U, 0x59B9U, 0x1C19U, 0xD2F9U, 0x9759U, 0x525AU, 0x17FAU, 0xD91AU, 0x9CBAU,
+      0x54FBU, 0x115BU, 0xDFBBU, 0x9A1BU, 0x459CU, 0x003CU, 0xCEDCU, 0x8B7CU, 0x433DU, 0x069DU, 0xC87DU, 0x8DDDU,
+      0x48DEU, 0x0D7EU, 0xC39EU, 0x863EU, 0x4E7FU, 0x0BDFU, 0xC53FU, 0x809FU, 0xD420U, 0x9180U, 0x5F60U, 0x1AC0U,
+      0xD281U, 0x9721U, 0x59C1U, 0x1C61U, 0xD962U, 0x9CC2U, 0x5222U, 0x1782U, 0xDFC3U, 0x9A63U, 0x5483U, 0x1123U,
+      0xCEA4U, 0x8B04U, 0x45E4U, 0x0044U, 0xC805U, 0x8DA5U, 0x4345U, 0x06E5U, 0xC3E6U, 0x8646U, 0x48A6U, 0x0D06U,
+      0xC547U, 0x80E7U, 0x4E07U, 0x0BA7U, 0xE128U, 0xA488U, 0x6A68U, 0x2FC8U, 0xE789U, 0xA229U, 0x6CC9U, 0x2969U,
+      0xEC6AU, 0xA9CAU, 0x672AU, 0x228AU, 0xEACBU, 0xAF6BU, 0x618BU, 0x242BU, 0xFBACU, 0xBE0CU, 0x70ECU, 0x354CU,
+      0xFD0DU, 0xB8ADU, 0x764DU, 0x33EDU, 0xF6EEU, 0xB34EU, 0x7DAEU, 0x380EU, 0xF04FU, 0xB5EFU, 0x7B0FU, 0x3EAFU,
+      0xBE30U, 0xFB90U, 0x3570U, 0x70D0U, 0xB891U, 0xFD31U, 0x33D1U, 0x7671U, 0xB372U, 0xF6D2U, 0x3832U, 0x7D92U,
+      0xB5D3U, 0xF073U, 0x3E93U, 0x7B33U, 0xA4B4U, 0xE114U, 0x2FF4U, 0x6A54U, 0xA215U, 0xE7B5U, 0x2955U, 0x6CF5U,
+      0xA9F6U, 0xEC56U, 0x22B6U, 0x6716U, 0xAF57U, 0xEAF7U, 0x2417U, 0x61B7U, 0x8B38U, 0xCE98U, 0x0078U, 0x45D8U,
+      0x8D99U, 0xC839U, 0x06D9U, 0x4379U, 0x867AU, 0xC3DAU, 0x0D3AU, 0x489AU, 0x80DBU, 0xC57BU, 0x0B9BU, 0x4E3BU,
+      0x91BCU, 0xD41CU, 0x1AFCU, 0x5F5CU, 0x971DU, 0xD2BDU, 0x1C5DU, 0x59FDU, 0x9CFEU, 0xD95EU, 0x17BEU, 0x521EU,
+      0x9A5FU, 0xDFFFU, 0x111FU, 0x54BFU,
+    },
+    {
+      0x0000U, 0xB861U, 0x60E3U, 0xD882U, 0xC1C6U, 0x79A7U, 0xA125U, 0x1944U, 0x93ADU, 0x2BCCU, 0xF34EU, 0x4B2FU,
+      0x526BU, 0xEA0AU, 0x3288U, 0x8AE9U, 0x377BU, 0x8F1AU, 0x5798U, 0xEFF9U, 0xF6BDU, 0x4EDCU, 0x965EU, 0x2E3FU,
+      0xA4D6U, 0x1CB7U, 0xC435U, 0x7C54U, 0x6510U, 0xDD71U, 0x05F3U, 0xBD92U, 0x6EF6U, 0xD697U, 0x0E15U, 0xB674U,
+      0xAF30U, 0x1751U, 0xCFD3U, 0x77B2U, 0xFD5BU, 0x453AU, 0x9DB8U, 0x25D9U, 0x3C9DU, 0x84FCU, 0x5C7EU, 0xE41FU,
+      0x598DU, 0xE1ECU, 0x396EU, 0x810FU, 0x984BU, 0x202AU, 0xF8A8U, 0x40C9U, 0xCA20U, 0x7241U, 0xAAC3U, 0x12A2U,
+      0x0BE6U, 0xB387U, 0x6B05U, 0xD364U, 0xDDECU, 0x658DU, 0xBD0FU, 0x056EU, 0x1C2AU, 0xA44BU, 0x7CC9U, 0xC4A8U,
+      0x4E41U, 0xF620U, 0x2EA2U, 0x96C3U, 0x8F87U, 0x37E6U, 0xEF64U, 0x5705U, 0xEA97U, 0x52F6U, 0x8A74U, 0x3215U,
+      0x2B51U, 0x9330U, 0x4BB2U, 0xF3D3U, 0x793AU, 0xC15BU, 0x19D9U, 0xA1B8U, 0xB8FCU, 0x009DU, 0xD81FU, 0x607EU,
+      0xB31AU, 0x0B7BU, 0xD3F9U, 0x6B98U, 0x72DCU, 0xCABDU, 0x123FU, 0xAA5EU, 0x20B7U, 0x98D6U, 0x4054U, 0xF835U,
+      0xE171U, 0x5910U, 0x8192U, 0x39F3U, 0x8461U, 0x3C00U, 0xE482U, 0x5CE3U, 0x45A7U, 0xFDC6U, 0x2544U, 0x9D25U,
+      0x17CCU, 0xAFADU, 0x772FU, 0xCF4EU, 0xD60AU, 0x6E6BU, 0xB6E9U, 0x0E88U, 0xABF9U, 0x1398U, 0xCB1AU, 0x737BU,
+      0x6A3FU, 0xD25EU, 0x0ADCU, 0xB2BDU, 0x3854U, 0x8035U, 0x58B7U, 0xE0D6U, 0xF992U, 0x41F3U, 0x9971U, 0x2110U,
+      0x9C82U, 0x24E3U, 0xFC61U, 0x4400U, 0x5D44U, 0xE525U, 0x3DA7U, 0x85C6U, 0x0F2FU, 0xB74EU, 0x6FCCU, 0xD7ADU,
+      0xCEE9U, 0x7688U, 0xAE0AU, 0x166BU, 0xC50FU, 0x7D6EU, 0xA5ECU, 0x1D8DU, 0x04C9U, 0xBCA8U, 0x642AU, 0xDC4BU,
+      0x56A2U, 0xEEC3U, 0x3641U, 0x8E20U, 0x9764U, 0x2F05U, 0xF787U, 0x4FE6U, 0xF274U, 0x4A15U, 0x9297U, 0x2AF6U,
+      0x33B2U, 0x8BD3U, 0x5351U, 0xEB30U, 0x61D9U, 0xD9B8U, 0x013AU, 0xB95BU, 0xA01FU, 0x187EU, 0xC0FCU, 0x789DU,
+      0x7615U, 0xCE74U, 0x16F6U, 0xAE97U, 0xB7D3U, 0x0FB2U, 0xD730U, 0x6F51U, 0xE5B8U, 0x5DD9U, 0x855BU, 0x3D3AU,
+      0x247EU, 0x9C1FU, 0x449DU, 0xFCFCU, 0x416EU, 0xF90FU, 0x218DU, 0x99ECU, 0x80A8U, 0x38C9U, 0xE04BU, 0x582AU,
+      0xD2C3U, 0x6AA2U, 0xB220U, 0x0A41U, 0x1305U, 0xAB64U, 0x73E6U, 0xCB87U, 0x18E3U, 0xA082U, 0x7800U, 0xC061U,
+      0xD925U, 0x6144U, 0xB9C6U, 0x01A7U, 0x8B4EU, 0x332FU, 0xEBADU, 0x53CCU, 0x4A88U, 0xF2E9U, 0x2A6BU, 0x920AU,
+      0x2F98U, 0x97F9U, 0x4F7BU, 0xF71AU, 0xEE5EU, 0x563FU, 0x8EBDU, 0x36DCU, 0xBC35U, 0x0454U, 0xDCD6U, 0x64B7U,
+      0x7DF3U, 0xC592U, 0x1D10U, 0xA571U,
+    },
+    {
+      0x0000U, 0x47D3U, 0x8FA6U, 0xC875U, 0x0F6DU, 0x48BEU, 0x80CBU, 0xC718U, 0x1EDAU, 0x5909U, 0x917CU, 0xD6AFU,
+      0x11B7U, 0x5664U, 0x9E11U, 0xD9C2U, 0x3DB4U, 0x7A67U, 0xB212U, 0xF5C1U, 0x32D9U, 0x750AU, 0xBD7FU, 0xFAACU,
+      0x236EU, 0x64BDU, 0xACC8U, 0xEB1BU, 0x2C03U, 0x6BD0U, 0xA3A5U, 0xE476U, 0x7B68U, 0x3CBBU, 0xF4CEU, 0xB31DU,
+      0x7405U, 0x33D6U, 0xFBA3U, 0xBC70U, 0x65B2U, 0x2261U, 0xEA14U, 0xADC7U, 0x6ADFU, 0x2D0CU, 0xE579U, 0xA2AAU,
+      0x46DCU, 0x010FU, 0xC97AU, 0x8EA9U, 0x49B1U, 0x0E62U, 0xC617U, 0x81C4U, 0x5806U, 0x1FD5U, 0xD7A0U, 0x9073U,
+      0x576BU, 0x10B8U, 0xD8CDU, 0x9F1EU, 0xF6D0U, 0xB103U, 0x7976U, 0x3EA5U, 0xF9BDU, 0xBE6EU, 0x761BU, 0x31C8U,
+      0xE80AU, 0xAFD9U, 0x67ACU, 0x207FU, 0xE767U, 0xA0B4U, 0x68C1U, 0x2F12U, 0xCB64U, 0x8CB7U, 0x44C2U, 0x0311U,
+      0xC409U, 0x83DAU, 0x4BAFU, 0x0C7CU, 0xD5BEU, 0x926DU, 0x5A18U, 0x1DCBU, 0xDAD3U, 0x9D00U, 0x5575U, 0x12A6U,
+      0x8DB8U, 0xCA6BU, 0x021EU, 0x45CDU, 0x82D5U, 0xC506U, 0x0D73U, 0x4AA0U, 0x9362U, 0xD4B1U, 0x1CC4U, 0x5B17U,
+      0x9C0FU, 0xDBDCU, 0x13A9U, 0x547AU, 0xB00CU, 0xF7DFU, 0x3FAAU, 0x7879U, 0xBF61U, 0xF8B2U, 0x30C7U, 0x7714U,
+      0xAED6U, 0xE905U, 0x2170U, 0x66A3U, 0xA1BBU, 0xE668U, 0x2E1DU, 0x69CEU, 0xFD81U, 0xBA52U, 0x7227U, 0x35F4U,
+      0xF2ECU, 0xB53FU, 0x7D4AU, 0x3A99U, 0xE35BU, 0xA488U, 0x6CFDU, 0x2B2EU, 0xEC36U, 0xABE5U, 0x6390U, 0x2443U,
+      0xC035U, 0x87E6U, 0x4F93U, 0x0840U, 0xCF58U, 0x888BU, 0x40FEU, 0x072DU, 0xDEEFU, 0x993CU, 0x5149U, 0x169AU,
+      0xD182U, 0x9651U, 0x5E24U, 0x19F7U, 0x86E9U, 0xC13AU, 0x094FU, 0x4E9CU, 0x8984U, 0xCE57U, 0x0622U, 0x41F1U,
+      0x9833U, 0xDFE0U, 0x1795U, 0x5046U, 0x975EU, 0xD08DU, 0x18F8U, 0x5F2BU, 0xBB5DU, 0xFC8EU, 0x34FBU, 0x7328U,
+      0xB430U, 0xF3E3U, 0x3B96U, 0x7C45U, 0xA587U, 0xE254U, 0x2A21U, 0x6DF2U, 0xAAEAU, 0xED39U, 0x254CU, 0x629FU,
+      0x0B51U, 0x4C82U, 0x84F7U, 0xC324U, 0x043CU, 0x43EFU, 0x8B9AU, 0xCC49U, 0x158BU, 0x5258U, 0x9A2DU, 0xDDFEU,
+      0x1AE6U, 0x5D35U, 0x9540U, 0xD293U, 0x36E5U, 0x7136U, 0xB943U, 0xFE90U, 0x3988U, 0x7E5BU, 0xB62EU, 0xF1FDU,
+      0x283FU, 0x6FECU, 0xA799U, 0xE04AU, 0x2752U, 0x6081U, 0xA8F4U, 0xEF27U, 0x7039U, 0x37EAU, 0xFF9FU, 0xB84CU,
+      0x7F54U, 0x3887U, 0xF0F2U, 0xB721U, 0x6EE3U, 0x2930U, 0xE145U, 0xA696U, 0x618EU, 0x265DU, 0xEE28U, 0xA9FBU,
+      0x4D8DU, 0x0A5EU, 0xC22BU, 0x85F8U, 0x42E0U, 0x0533U, 0xCD46U, 0x8A95U, 0x5357U, 0x1484U, 0xDCF1U, 0x9B22U,
+      0x5C3AU, 0x1BE9U, 0xD39CU, 0x944FU,
+    },
+#endif
+};
+
+// Adds exactly CRC_SLICE bytes.
+static uint16_t crc_add_slice(const uint16_t crc, const byte_t* const data)
+{
+    const unsigned head = (unsigned)crc ^ (((unsigned)data[0] << 8U) | data[1]);
+    unsigned       acc  = crc_table_slice[CRC_SLICE - 2U][head >> 8U];
+    acc ^= crc_table_slice[CRC_SLICE - 3U][head & BYTE_MAX];
+    for (size_t i = 2; i < (CRC_SLICE - 1U); i++) {
+        acc ^= crc_table_slice[CRC_SLICE - 2U - i][data[i]];
+    }
+    return (uint16_t)(acc ^ crc_table[data[CRC_SLICE - 1U]]);
+}
+
+#endif
+
+static uint16_t crc_add_bytes(const uint16_t crc, const size_t size, const byte_t* const data)
 {
-    CANARD_ASSERT((data != NULL) || (size == 0U));
     uint16_t      out = crc;
-    const byte_t* p   = (const byte_t*)data;
-    for (size_t i = 0; i < size; i++) {
+    const byte_t* p   = data;
+    size_t        rem = size;
+#if CRC_SLICE > 1
+    while (rem >= CRC_SLICE) {
+        out = crc_add_slice(out, p);
+        p += CRC_SLICE;
+        rem -= CRC_SLICE;
+    }
+#endif
+    while (rem > 0U) {
         out = crc_add_byte(out, *p);
         ++p;
+        --rem;
     }
     return out;
 }
 
+#if CANARD_CRC_BACKEND == CANARD_CRC_BACKEND_CLMUL
+
+// The data is viewed as a polynomial over GF(2) where the first byte holds the highest powers and the MSb of each byte
+// comes first. The 128-bit vectors hold 16-byte blocks in this order, so that bit N of the vector is the coefficient
+// of x^N. A block multiplied by x^128 is congruent modulo the CRC polynomial to hi*(x^192 mod P) + lo*(x^128 mod P),
+// where hi and lo are its 64-bit halves; the products of 64-bit halves by 16-bit constants fit into 128 bits.
+// Folding the blocks this way preserves the remainder of the message; the final vector is reduced byte-wise.
+#define CRC_CLMUL_BLOCK  16U
+#define CRC_CLMUL_LANES  4U
+#define CRC_CLMUL_STRIDE (CRC_CLMUL_BLOCK * CRC_CLMUL_LANES)
+#define CRC_X128         0xAEFCU // x^128 mod P
+#define CRC_X192         0x650BU // x^192 mod P
+#define CRC_X512         0x13FCU // x^512 mod P
+#define CRC_X576         0x8832U // x^576 mod P
+
+#if defined(__PCLMUL__)
+
+typedef __m128i crc_vec_t;
+
+static crc_vec_t crc_vec_const(const uint16_t hi, const uint16_t lo) { return _mm_set_epi64x(hi, lo); }
+
+static crc_vec_t crc_vec_load(const byte_t* const data)
+{
+    __m128i out;
+    (void)memcpy(&out, data, sizeof(out));
+    return _mm_shuffle_epi8(out, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+static void crc_vec_store(byte_t* const data, const crc_vec_t vec)
+{
+    const __m128i out = _mm_shuffle_epi8(vec, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    (void)memcpy(data, &out, sizeof(out));
+}
+
+// Returns acc*x^(8*distance) + next modulo P where the constants k are (x^(8*distance+64), x^(8*distance)) mod P.
+static crc_vec_t crc_vec_fold(const crc_vec_t acc, const crc_vec_t k, const crc_vec_t next)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00)), next);
+}
+
+#else
+
+typedef uint64x2_t crc_vec_t;
+
+static crc_vec_t crc_vec_const(const uint16_t hi, const uint16_t lo)
+{
+    return vcombine_u64(vcreate_u64(lo), vcreate_u64(hi));
+}
+
+static crc_vec_t crc_vec_load(const byte_t* const data)
+{
+    const uint8x16_t out = vrev64q_u8(vld1q_u8(data));
+    return vreinterpretq_u64_u8(vextq_u8(out, out, 8));
+}
+
+static void crc_vec_store(byte_t* const data, const crc_vec_t vec)
+{
+    const uint8x16_t out = vrev64q_u8(vreinterpretq_u8_u64(vec));
+    vst1q_u8(data, vextq_u8(out, out, 8));
+}
+
+// Returns acc*x^(8*distance) + next modulo P where the constants k are (x^(8*distance+64), x^(8*distance)) mod P.
+static crc_vec_t crc_vec_fold(const crc_vec_t acc, const crc_vec_t k, const crc_vec_t next)
+{
+    const poly128_t hi = vmull_p64((poly64_t)vgetq_lane_u64(acc, 1), (poly64_t)vgetq_lane_u64(k, 1));
+    const poly128_t lo = vmull_p64((poly64_t)vgetq_lane_u64(acc, 0), (poly64_t)vgetq_lane_u64(k, 0));
+    return veorq_u64(veorq_u64(vreinterpretq_u64_p128(hi), vreinterpretq_u64_p128(lo)), next);
+}
+
+#endif
+
+// Requires at least CRC_CLMUL_STRIDE bytes. Independent lanes hide the latency of the multiplication.
+static uint16_t crc_add_clmul(const uint16_t crc, const size_t size, const byte_t* const data)
+{
+    CANARD_ASSERT(size >= CRC_CLMUL_STRIDE);
+    byte_t head[CRC_CLMUL_BLOCK];
+    (void)memcpy(head, data, CRC_CLMUL_BLOCK);
+    head[0] ^= (byte_t)(crc >> 8U); // The initial value is equivalent to XORing it into the first two bytes.
+    head[1] ^= (byte_t)(crc & BYTE_MAX);
+    const crc_vec_t k_stride              = crc_vec_const(CRC_X576, CRC_X512);
+    crc_vec_t       lane[CRC_CLMUL_LANES] = { crc_vec_load(head),
+                                              crc_vec_load(&data[CRC_CLMUL_BLOCK * 1U]),
+                                              crc_vec_load(&data[CRC_CLMUL_BLOCK * 2U]),
+                                              crc_vec_load(&data[CRC_CLMUL_BLOCK * 3U]) };
+    size_t          offset                = CRC_CLMUL_STRIDE;
+    while ((size - offset) >= CRC_CLMUL_STRIDE) {
+        for (size_t i = 0; i < CRC_CLMUL_LANES; i++) {
+            lane[i] = crc_vec_fold(lane[i], k_stride, crc_vec_load(&data[offset + (CRC_CLMUL_BLOCK * i)]));
+        }
+        offset += CRC_CLMUL_STRIDE;
+    }
+    const crc_vec_t k_block = crc_vec_const(CRC_X192, CRC_X128);
+    crc_vec_t       acc     = lane[0];
+    for (size_t i = 1; i < CRC_CLMUL_LANES; i++) {
+        acc = crc_vec_fold(acc, k_block, lane[i]);
+    }
+    while ((size - offset) >= CRC_CLMUL_BLOCK) {
+        acc = crc_vec_fold(acc, k_block, crc_vec_load(&data[offset]));
+        offset += CRC_CLMUL_BLOCK;
+    }
+    byte_t tail[CRC_CLMUL_BLOCK];
+    crc_vec_store(tail, acc);
+    return crc_add_bytes(crc_add_bytes(0U, CRC_CLMUL_BLOCK, tail), size - offset, &data[offset]);
+}
+
+#endif
+
+static uint16_t crc_add(const uint16_t crc, const size_t size, const void* const data)
+{
+    CANARD_ASSERT((data != NULL) || (size == 0U));
+#if CANARD_CRC_BACKEND == CANARD_CRC_BACKEND_CLMUL
+    if (size >= CRC_CLMUL_STRIDE) {
+        return crc_add_clmul(crc, size, (const byte_t*)data);
+    }
+#endif
+    return crc_add_bytes(crc, size, (const byte_t*)data);
+}
+
+// Copies the first copy_size bytes of src into dst while adding all size bytes of src to the CRC, reading the data
+// only once. The copy may be shorter than the CRC input to support implicit truncation of received transfers.
+static uint16_t crc_add_copy(const uint16_t    crc,
+                             const size_t      size,
+                             const void* const src,
+                             const size_t      copy_size,
+                             void* const       dst)
+{
+    CANARD_ASSERT(copy_size <= size);
+    CANARD_ASSERT(((src != NULL) || (size == 0U)) && ((dst != NULL) || (copy_size == 0U)));
+    uint16_t      out = crc;
+    const byte_t* s   = (const byte_t*)src;
+    byte_t*       d   = (byte_t*)dst;
+    size_t        rem = copy_size;
+#if CRC_SLICE > 1
+    while (rem >= CRC_SLICE) {
+        byte_t block[CRC_SLICE];
+        (void)memcpy(block, s, CRC_SLICE);
+        (void)memcpy(d, block, CRC_SLICE);
+        out = crc_add_slice(out, block);
+        s += CRC_SLICE;
+        d += CRC_SLICE;
+        rem -= CRC_SLICE;
+    }
+#endif
+    while (rem > 0U) {
+        const byte_t b = *s;
+        *d             = b;
+        out            = crc_add_byte(out, b);
+        ++s;
+        ++d;
+        --rem;
+    }
+    return crc_add(out, size - copy_size, s);
+}
+
 static uint16_t crc_add_chain(uint16_t crc, const canard_bytes_chain_t chain) // NOLINT(*-no-recursion)
 {
     crc = crc_add(crc, chain.bytes.size, chain.bytes.data);
@@ -215,6 +637,11 @@ static uint16_t crc_add_chain(uint16_t crc, const canard_bytes_chain_t chain) //
 
 // ---------------------------------------------      LIST CONTAINER       ---------------------------------------------
 
+static bool is_listed(const canard_list_t* const list, const canard_listed_t* const member)
+{
+    return (member->next != NULL) || (member->prev != NULL) || (list->head == member);
+}
+
 // No effect if not in the list.
 static void delist(canard_list_t* const list, canard_listed_t* const member)
 {
@@ -316,6 +743,26 @@ static void bytes_chain_read(bytes_chain_reader_t* const reader, const size_t si
     }
 }
 
+// Like bytes_chain_read() but the data is only added to the CRC instead of being copied. Returns the updated CRC.
+static uint16_t bytes_chain_crc(bytes_chain_reader_t* const reader, const size_t size, const uint16_t crc)
+{
+    CANARD_ASSERT((reader != NULL) && (reader->cursor != NULL));
+    uint16_t out       = crc;
+    size_t   remaining = size;
+    while (remaining > 0U) {
+        while (reader->position == reader->cursor->bytes.size) { // Advance while skipping empty fragments.
+            reader->position = 0U;
+            reader->cursor   = reader->cursor->next;
+            CANARD_ASSERT(reader->cursor != NULL);
+        }
+        const size_t progress = smaller(remaining, reader->cursor->bytes.size - reader->position);
+        out                   = crc_add(out, progress, ((const byte_t*)reader->cursor->bytes.data) + reader->position);
+        remaining -= progress;
+        reader->position += progress;
+    }
+    return out;
+}
+
 static size_t bytes_chain_size(const canard_bytes_chain_t head)
 {
     size_t                      size    = head.bytes.size;
@@ -333,6 +780,144 @@ static bool bytes_chain_valid(const canard_bytes_chain_t head)
     return (head.bytes.data != NULL) || (head.bytes.size == 0U);
 }
 
+// ---------------------------------------------           SLAB            ---------------------------------------------
+
+typedef struct slab_block_t
+{
+    struct slab_block_t* next;
+} slab_block_t;
+
+static canard_slab_class_t* slab_class_find(const canard_slab_t* const self, const size_t size)
+{
+    for (size_t i = 0; i < self->class_count; i++) {
+        if (self->classes[i].size == size) {
+            return (canard_slab_class_t*)&self->classes[i];
+        }
+    }
+    return NULL;
+}
+
+// Intrusive free lists of fixed-size blocks, also used for the reserved RX sessions and slots of subscriptions.
+static void freelist_push(void** const list, void* const pointer)
+{
+    slab_block_t* const block = (slab_block_t*)pointer;
+    block->next               = (slab_block_t*)*list;
+    *list                     = block;
+}
+
+static void* freelist_pop(void** const list)
+{
+    slab_block_t* const block = (slab_block_t*)*list;
+    if (block != NULL) {
+        *list = block->next;
+    }
+    return block;
+}
+
+static void slab_class_push(canard_slab_class_t* const cls, void* const pointer)
+{
+    freelist_push(&cls->free_list, pointer);
+    cls->stats.cached++;
+}
+
+static void* slab_alloc(const canard_mem_t mem, const size_t size)
+{
+    canard_slab_t* const       self = (canard_slab_t*)mem.context;
+    canard_slab_class_t* const cls  = slab_class_find(self, size);
+    if (cls == NULL) {
+        self->passthrough++;
+        return mem_alloc(self->upstream, size);
+    }
+    void* block = freelist_pop(&cls->free_list);
+    if (block != NULL) {
+        cls->stats.cached--;
+        cls->stats.hits++;
+    } else {
+        cls->stats.misses++;
+        block = mem_alloc(self->upstream, size);
+    }
+    if (block != NULL) {
+        cls->stats.in_use++;
+        cls->stats.in_use_max = (cls->stats.in_use > cls->stats.in_use_max) ? cls->stats.in_use : cls->stats.in_use_max;
+    }
+    return block;
+}
+
+static void slab_free(const canard_mem_t mem, const size_t size, void* const pointer)
+{
+    canard_slab_t* const       self = (canard_slab_t*)mem.context;
+    canard_slab_class_t* const cls  = slab_class_find(self, size);
+    if (cls == NULL) {
+        mem_free(self->upstream, size, pointer);
+    } else if (pointer != NULL) {
+        // The block may have been allocated before the class was created; it is adopted by the class then.
+        cls->stats.in_use -= (cls->stats.in_use > 0) ? 1U : 0U;
+        slab_class_push(cls, pointer);
+    }
+}
+
+static const canard_mem_vtable_t slab_vtable = { .free = slab_free, .alloc = slab_alloc };
+
+bool canard_slab_new(canard_slab_t* const self, const canard_mem_t upstream, const size_t prewarm)
+{
+    const bool ok = (self != NULL) && (upstream.vtable != NULL) && (upstream.vtable->alloc != NULL) &&
+                    (upstream.vtable->free != NULL);
+    if (ok) {
+        (void)memset(self, 0, sizeof(*self));
+        self->upstream = upstream;
+        self->prewarm  = prewarm;
+    }
+    return ok;
+}
+
+void canard_slab_destroy(canard_slab_t* const self)
+{
+    if (self != NULL) {
+        for (size_t i = 0; i < self->class_count; i++) {
+            canard_slab_class_t* const cls = &self->classes[i];
+            while (cls->free_list != NULL) {
+                mem_free(self->upstream, cls->size, freelist_pop(&cls->free_list));
+            }
+            cls->stats.cached = 0;
+        }
+    }
+}
+
+canard_mem_t canard_slab_mem(canard_slab_t* const self)
+{
+    return (canard_mem_t){ .vtable = &slab_vtable, .context = self };
+}
+
+bool canard_slab_reserve(canard_slab_t* const self, const size_t size, const size_t count)
+{
+    if ((self == NULL) || (size < sizeof(slab_block_t))) {
+        return false;
+    }
+    canard_slab_class_t* cls = slab_class_find(self, size);
+    if (cls == NULL) {
+        if (self->class_count >= CANARD_SLAB_CLASS_COUNT) {
+            return false;
+        }
+        cls = &self->classes[self->class_count++];
+        (void)memset(cls, 0, sizeof(*cls));
+        cls->size = size;
+    }
+    while (cls->stats.cached < count) {
+        void* const block = mem_alloc(self->upstream, size);
+        if (block == NULL) {
+            return false;
+        }
+        slab_class_push(cls, block);
+    }
+    return true;
+}
+
+const canard_slab_stats_t* canard_slab_stats(const canard_slab_t* const self, const size_t size)
+{
+    const canard_slab_class_t* const cls = (self != NULL) ? slab_class_find(self, size) : NULL;
+    return (cls != NULL) ? &cls->stats : NULL;
+}
+
 // ---------------------------------------------            TX             ---------------------------------------------
 
 // On a 32-bit platform, o1heap has a per-block overhead of sizeof(void*)*2=8 bytes, meaning that the available
@@ -342,9 +927,15 @@ static bool bytes_chain_valid(const canard_bytes_chain_t head)
 typedef struct tx_frame_t
 {
     struct tx_frame_t* next;
-    size_t             refcount : (sizeof(size_t) * CHAR_BIT) - DLC_BITS; // 268+ million ought to be enough for anybody
-    size_t             dlc : DLC_BITS; // use canard_len_to_dlc[] and canard_dlc_to_len[]
-    byte_t             data[];
+#if CANARD_TX_CONTIGUOUS_SPOOL
+    struct tx_block_t* block; // The shared allocation this frame is carved from, or NULL if allocated individually.
+#endif
+    size_t refcount : (sizeof(size_t) * CHAR_BIT) - DLC_BITS - CANARD_PRIO_BITS - 2U; // 8+ million
+    size_t dlc : DLC_BITS;          // use canard_len_to_dlc[] and canard_dlc_to_len[]
+    size_t prio : CANARD_PRIO_BITS; // of the owning transfer, for the per-priority queue size accounting
+    size_t inlined : 1;             // stored inside the owning transfer, see CANARD_TX_INLINE_FRAME_SIZE
+    size_t gather  : 1;             // the payload is referenced rather than stored, see tx_gather_t
+    byte_t data[];
 } tx_frame_t;
 static_assert((sizeof(void*) > 4) || ((sizeof(tx_frame_t) + CANARD_MTU_CAN_CLASSIC) <= 24),
               "On a 32-bit platform with a half-fit heap, the full Classic CAN frame should fit in a 32-byte block");
@@ -361,43 +952,132 @@ static tx_frame_t* tx_frame_from_view(const canard_bytes_t view)
     return (tx_frame_t*)ptr_unbias(view.data, offsetof(tx_frame_t, data));
 }
 
-static tx_frame_t* tx_frame_new(canard_t* const self, const size_t data_size)
+static void tx_frame_init(canard_t* const self, tx_frame_t* const frame, const byte_t prio, const size_t data_size)
 {
+    CANARD_ASSERT(prio < CANARD_PRIO_COUNT);
     CANARD_ASSERT(data_size <= CANARD_MTU_CAN_FD);
     CANARD_ASSERT(data_size == canard_dlc_to_len[canard_len_to_dlc[data_size]]); // NOLINT(*-security.ArrayBound)
+    frame->next = NULL;
+#if CANARD_TX_CONTIGUOUS_SPOOL
+    frame->block = NULL;
+#endif
+    frame->refcount = 1U;
+    frame->dlc      = canard_len_to_dlc[data_size] & 15U; // NOLINT(*-security.ArrayBound)
+    frame->prio     = prio & (CANARD_PRIO_COUNT - 1U);
+    frame->inlined  = 0U;
+    frame->gather   = 0U;
+    // Update the counts; these are decremented when the frame is freed upon refcount reaching zero.
+    self->tx.queue_size++;
+    self->tx.queue_size_by_prio[prio]++;
+}
+
+static tx_frame_t* tx_frame_new(canard_t* const self, const byte_t prio, const size_t data_size)
+{
     tx_frame_t* const frame = (tx_frame_t*)mem_alloc(self->mem.tx_frame, sizeof(tx_frame_t) + data_size);
     if (frame != NULL) {
-        frame->next     = NULL;
-        frame->refcount = 1U;
-        frame->dlc      = canard_len_to_dlc[data_size] & 15U; // NOLINT(*-security.ArrayBound)
-        // Update the count; this is decremented when the frame is freed upon refcount reaching zero.
-        self->tx.queue_size++;
+        tx_frame_init(self, frame, prio, data_size);
     }
     return frame;
 }
 
-void canard_refcount_inc(const canard_bytes_t obj)
+// A single allocation holding all frames of a multi-frame transfer, see CANARD_TX_CONTIGUOUS_SPOOL.
+// The frames follow the header at a fixed stride that is a multiple of sizeof(tx_frame_t) to keep them aligned.
+// The block is freed when its last frame is released.
+typedef struct tx_block_t
 {
-    if (obj.data != NULL) {
-        tx_frame_t* const frame = tx_frame_from_view(obj);
-        CANARD_ASSERT(frame->refcount > 0U);
-        ++frame->refcount; // TODO: if C11 is enabled, use stdatomic here
-    }
+    size_t  size;   // The allocation size, needed for freeing.
+    size_t  live;   // The number of frames carved out and not yet released.
+    size_t  spare;  // The number of slots not yet carved out.
+    size_t  stride; // The slot size.
+    byte_t* cursor; // The next slot to carve out.
+} tx_block_t;
+
+static size_t tx_block_round(const size_t x)
+{
+    return ((x + sizeof(tx_frame_t) - 1U) / sizeof(tx_frame_t)) * sizeof(tx_frame_t);
 }
 
-void canard_refcount_dec(canard_t* const self, const canard_bytes_t obj)
+// Returns NULL if the option is disabled, not useful for this frame count, or OOM;
+// the frames are then allocated individually.
+static tx_block_t* tx_block_new(canard_t* const self, const size_t frame_count, const size_t mtu)
 {
-    if (obj.data != NULL) {
-        tx_frame_t* const frame = tx_frame_from_view(obj);
-        CANARD_ASSERT(frame->refcount > 0U); // NOLINT(*-security.ArrayBound)
-        CANARD_ASSERT(canard_dlc_to_len[frame->dlc] == obj.size);
-        frame->refcount--;
-        if (frame->refcount == 0U) {
-            CANARD_ASSERT(self->tx.queue_size > 0U);
-            self->tx.queue_size--;
-            mem_free(self->mem.tx_frame, sizeof(tx_frame_t) + obj.size, frame);
+    tx_block_t* block = NULL;
+    if (CANARD_TX_CONTIGUOUS_SPOOL && (frame_count > 1U)) {
+        const size_t header = tx_block_round(sizeof(tx_block_t));
+        const size_t stride = tx_block_round(sizeof(tx_frame_t) + mtu);
+        const size_t size   = header + (frame_count * stride);
+        block               = (tx_block_t*)mem_alloc(self->mem.tx_frame, size);
+        if (block != NULL) {
+            block->size   = size;
+            block->live   = 0U;
+            block->spare  = frame_count;
+            block->stride = stride;
+            block->cursor = ((byte_t*)block) + header;
         }
     }
+    return block;
+}
+
+// Carves the next frame out of the block; if there is no block or it is exhausted, allocates the frame individually.
+static tx_frame_t* tx_block_frame_new(canard_t* const   self,
+                                      tx_block_t* const block,
+                                      const byte_t      prio,
+                                      const size_t      data_size)
+{
+    tx_frame_t* frame = NULL;
+    if ((block != NULL) && (block->spare > 0U)) {
+        CANARD_ASSERT((sizeof(tx_frame_t) + data_size) <= block->stride);
+        frame = (tx_frame_t*)(void*)block->cursor;
+        block->cursor += block->stride;
+        block->spare--;
+        block->live++;
+        tx_frame_init(self, frame, prio, data_size);
+#if CANARD_TX_CONTIGUOUS_SPOOL
+        frame->block = block;
+#endif
+    } else {
+        frame = tx_frame_new(self, prio, data_size);
+    }
+    return frame;
+}
+
+// A frame of a zero-copy transfer stores only its trailer (padding, CRC, tail byte) in the data; the payload part is
+// a slice of the application buffer, which is described by this header preceding the frame in the same allocation.
+// The frame is submitted via tx_gather() as a chain of the slice fragments followed by the trailer.
+typedef struct
+{
+    bytes_chain_reader_t slice; // Points at the first payload byte of the frame.
+    size_t               slice_size;
+} tx_gather_t;
+
+static tx_gather_t* tx_gather_of(const tx_frame_t* const frame)
+{
+    CANARD_ASSERT(frame->gather != 0U);
+    return (tx_gather_t*)ptr_unbias(frame, sizeof(tx_gather_t));
+}
+
+static size_t tx_gather_alloc_size(const size_t data_size, const size_t slice_size)
+{
+    return sizeof(tx_gather_t) + sizeof(tx_frame_t) + (data_size - slice_size);
+}
+
+// The data size is that of the whole frame; the slice is assigned by the caller.
+static tx_frame_t* tx_gather_frame_new(canard_t* const self,
+                                       const byte_t    prio,
+                                       const size_t    data_size,
+                                       const size_t    slice_size)
+{
+    CANARD_ASSERT(slice_size < data_size); // The tail byte is always stored.
+    tx_gather_t* const gather =
+      (tx_gather_t*)mem_alloc(self->mem.tx_frame, tx_gather_alloc_size(data_size, slice_size));
+    tx_frame_t* frame = NULL;
+    if (gather != NULL) {
+        gather->slice_size = slice_size;
+        frame              = (tx_frame_t*)(void*)(gather + 1);
+        tx_frame_init(self, frame, prio, data_size);
+        frame->gather = 1U;
+    }
+    return frame;
 }
 
 // Everything except the local node-ID. The node-ID is not needed because it may be changed while the transfer
@@ -405,12 +1085,49 @@ void canard_refcount_dec(canard_t* const self, const canard_bytes_t obj)
 // hence it would not affect the ordering.
 #define CAN_ID_MSb_BITS (29U - 7U)
 
+// The state of the frame-by-frame serialization of a multi-frame Cyphal/CAN transfer.
+// It is used to build the whole spool at once, or one frame at a time for lazy transfers, see tx_lazy_t.
+typedef struct
+{
+    bytes_chain_reader_t reader;
+    size_t               size;   // The payload size without the CRC.
+    size_t               offset; // The number of payload and CRC bytes emitted so far.
+    size_t               mtu;
+    uint16_t             crc;
+    byte_t               transfer_id;
+    bool                 toggle;
+} tx_spooler_t;
+
+// A lazy transfer references the application payload and generates its frames one at a time as they are needed.
+// The state is allocated from the tx_frame resource; it must not move because the spooler points to the payload head.
+// A zero-copy transfer is a lazy one whose frames reference the payload, so it is kept until the transfer is retired.
+// A streamed transfer is a lazy one whose payload is pulled from the producer into the chunk before each frame.
+typedef struct tx_lazy_t
+{
+    canard_bytes_chain_t head; // A copy of the head of the payload chain, which is passed by value.
+    tx_spooler_t         spooler;
+    canard_tx_release_t  release;
+    canard_tx_producer_t producer; // Non-NULL if streamed; then the chunk is allocated.
+    bool                 reserved; // One queue slot is held for the next frame, see tx_lazy_reserve().
+    bool                 zero_copy;
+    byte_t               chunk[];
+} tx_lazy_t;
+
+#define TX_STREAM_CHUNK_SIZE (CANARD_MTU_CAN_FD - 1U) // The largest payload fragment of a frame.
+
 // The struct must fit into a 128-byte O1Heap block in common embedded configurations.
 typedef struct tx_transfer_t
 {
+    canard_listed_t list_pending[CANARD_IFACE_COUNT];
     canard_tree_t   index_pending[CANARD_IFACE_COUNT];
-    canard_tree_t   index_deadline;
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+    canard_listed_t list_deadline;
+    uint16_t        deadline_bucket;
+#else
+    canard_tree_t index_deadline;
+#endif
     canard_listed_t list_agewise;
+    canard_listed_t list_agewise_by_prio;
 
     // Constant fields.
     void*       user_context;
@@ -422,27 +1139,55 @@ typedef struct tx_transfer_t
 
     // Mutable fields that change as the transfer is making progress.
     uint32_t    first_frame_departed : 1;
+    uint32_t    orphaned             : 1; // Retired while the inline frame is retained; freed together with the frame.
+    byte_t      iface_done;               // The interfaces that have completed the transmission, for tx_done().
+    uint16_t    sacrifice_epoch;          // Chosen to be sacrificed if equals tx.sacrifice_epoch, see tx_sacrifice().
     tx_frame_t* cursor[CANARD_IFACE_COUNT];
+    tx_lazy_t*  lazy; // Non-NULL while the payload of a lazy transfer is referenced.
+
+#if CANARD_TX_TIMESTAMPS
+    canard_us_t enqueue_ts; // See CANARD_TX_TIMESTAMPS; recorded only while tx_done() is set, BIG_BANG otherwise.
+    canard_us_t first_frame_ts;
+    canard_us_t last_frame_ts;
+#endif
+
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+    // The frame of a single-frame transfer if it fits, see CANARD_TX_INLINE_FRAME_SIZE. In use while referenced.
+    // A structure with a flexible array member cannot be nested, hence the storage is aligned via the union.
+    union
+    {
+        void*  align;
+        byte_t storage[sizeof(tx_frame_t) + CANARD_TX_INLINE_FRAME_SIZE];
+    } inline_frame;
+#endif
 } tx_transfer_t;
-static_assert((CANARD_IFACE_COUNT > 2) || (sizeof(void*) > 4) || (sizeof(tx_transfer_t) <= 120),
+static_assert((CANARD_TX_INLINE_FRAME_SIZE > 0) || CANARD_TX_TIMESTAMPS || (CANARD_IFACE_COUNT > 2) ||
+                (sizeof(void*) > 4) || (sizeof(tx_transfer_t) <= 120),
               "On a 32-bit platform with a half-fit heap, the TX transfer object should fit in a 128-byte block");
 
-static tx_transfer_t* tx_transfer_new(canard_t* const   self,
-                                      const canard_us_t deadline,
-                                      const uint32_t    can_id_template,
-                                      const bool        fd,
-                                      void* const       user_context)
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+static tx_frame_t* tx_inline_frame(tx_transfer_t* const tr) { return (tx_frame_t*)(void*)tr->inline_frame.storage; }
+#endif
+
+// Also used to recycle a dequeued transfer object, so every field is initialized.
+static void tx_transfer_init(canard_t* const      self,
+                             tx_transfer_t* const tr,
+                             const canard_us_t    deadline,
+                             const uint32_t       can_id_template,
+                             const bool           fd,
+                             void* const          user_context)
 {
-    tx_transfer_t* const tr = mem_alloc_zero(self->mem.tx_transfer, sizeof(tx_transfer_t));
-    if (tr == NULL) {
-        self->err.oom++;
-        return NULL;
-    }
     FOREACH_IFACE (i) {
+        tr->list_pending[i]  = LIST_NULL;
         tr->index_pending[i] = TREE_NULL;
     }
-    tr->index_deadline       = TREE_NULL;
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+    tr->list_deadline = LIST_NULL;
+#else
+    tr->index_deadline = TREE_NULL;
+#endif
     tr->list_agewise         = LIST_NULL;
+    tr->list_agewise_by_prio = LIST_NULL;
     tr->user_context         = user_context;
     tr->deadline             = deadline;
     tr->seqno                = self->tx.seqno++;
@@ -450,16 +1195,145 @@ static tx_transfer_t* tx_transfer_new(canard_t* const   self,
     tr->fd                   = fd ? 1U : 0U;
     tr->multi_frame          = 0U;
     tr->first_frame_departed = 0U;
+    tr->orphaned             = 0U;
+    tr->iface_done           = 0U;
+    tr->sacrifice_epoch      = 0U;
     FOREACH_IFACE (i) {
         tr->cursor[i] = NULL;
     }
-    return tr;
+    tr->lazy = NULL;
+#if CANARD_TX_TIMESTAMPS
+    tr->enqueue_ts     = BIG_BANG;
+    tr->first_frame_ts = BIG_BANG;
+    tr->last_frame_ts  = BIG_BANG;
+#endif
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+    CANARD_ASSERT(tx_inline_frame(tr)->refcount == 0U); // A recycled transfer has not been transmitted.
+#endif
 }
 
-static bool tx_is_pending(const canard_t* const self, const tx_transfer_t* const tr)
+static tx_transfer_t* tx_transfer_new(canard_t* const   self,
+                                      const canard_us_t deadline,
+                                      const uint32_t    can_id_template,
+                                      const bool        fd,
+                                      void* const       user_context)
+{
+    tx_transfer_t* const tr = mem_alloc_zero(self->mem.tx_transfer, sizeof(tx_transfer_t));
+    if (tr == NULL) {
+        self->err.oom++;
+        return NULL;
+    }
+    tx_transfer_init(self, tr, deadline, can_id_template, fd, user_context);
+    return tr;
+}
+
+// The inline frame storage is released together with the owning transfer if the latter is already retired.
+static void tx_transfer_free(canard_t* const self, tx_transfer_t* const tr)
+{
+    bool release = true;
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+    release = tx_inline_frame(tr)->refcount == 0U;
+    if (!release) {
+        tr->orphaned = 1U;
+    }
+#endif
+    if (release) {
+        mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), tr);
+    }
+}
+
+// Uses the storage inside the transfer for the frame of a single-frame transfer if it fits; otherwise, allocates it.
+static tx_frame_t* tx_frame_new_single(canard_t* const      self,
+                                       tx_transfer_t* const owner,
+                                       const byte_t         prio,
+                                       const size_t         data_size)
+{
+    tx_frame_t* frame = NULL;
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+    if ((owner != NULL) && (data_size <= CANARD_TX_INLINE_FRAME_SIZE)) {
+        frame = tx_inline_frame(owner);
+        CANARD_ASSERT(frame->refcount == 0U);
+        tx_frame_init(self, frame, prio, data_size);
+        frame->inlined = 1U;
+    }
+#else
+    (void)owner;
+#endif
+    if (frame == NULL) {
+        frame = tx_frame_new(self, prio, data_size);
+    }
+    return frame;
+}
+
+static void tx_frame_free(canard_t* const self, tx_frame_t* const frame, const size_t data_size)
+{
+    bool individual = frame->inlined == 0U;
+#if CANARD_TX_INLINE_FRAME_SIZE > 0
+    if (!individual) {
+        tx_transfer_t* const owner = (tx_transfer_t*)ptr_unbias(frame, offsetof(tx_transfer_t, inline_frame));
+        if (owner->orphaned != 0U) {
+            mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), owner);
+        }
+    }
+#endif
+#if CANARD_TX_CONTIGUOUS_SPOOL
+    tx_block_t* const block = individual ? frame->block : NULL; // An inline frame may be gone already.
+    if (block != NULL) {
+        individual = false;
+        CANARD_ASSERT(block->live > 0U);
+        block->live--;
+        if (block->live == 0U) {
+            mem_free(self->mem.tx_frame, block->size, block);
+        }
+    }
+#endif
+    if (individual) {
+        void*  base = frame;
+        size_t size = sizeof(tx_frame_t) + data_size;
+        if (frame->gather != 0U) {
+            tx_gather_t* const gather = tx_gather_of(frame);
+            base                      = gather;
+            size                      = tx_gather_alloc_size(data_size, gather->slice_size);
+        }
+        mem_free(self->mem.tx_frame, size, base);
+    }
+}
+
+void canard_refcount_inc(const canard_bytes_t obj)
+{
+    if (obj.data != NULL) {
+        tx_frame_t* const frame = tx_frame_from_view(obj);
+        CANARD_ASSERT(frame->refcount > 0U);
+        ++frame->refcount; // TODO: if C11 is enabled, use stdatomic here
+    }
+}
+
+void canard_refcount_dec(canard_t* const self, const canard_bytes_t obj)
+{
+    if (obj.data != NULL) {
+        tx_frame_t* const frame = tx_frame_from_view(obj);
+        CANARD_ASSERT(frame->refcount > 0U); // NOLINT(*-security.ArrayBound)
+        CANARD_ASSERT(canard_dlc_to_len[frame->dlc] == obj.size);
+        frame->refcount--;
+        if (frame->refcount == 0U) {
+            CANARD_ASSERT(self->tx.queue_size > 0U);
+            CANARD_ASSERT(self->tx.queue_size_by_prio[frame->prio] > 0U);
+            self->tx.queue_size--;
+            self->tx.queue_size_by_prio[frame->prio]--;
+            tx_frame_free(self, frame, obj.size);
+        }
+    }
+}
+
+static byte_t tx_priority(const tx_transfer_t* const tr)
+{
+    return (byte_t)(tr->can_id_msb >> (CAN_ID_MSb_BITS - CANARD_PRIO_BITS));
+}
+
+static bool tx_is_pending(const canard_t* const self, const tx_transfer_t* const tr)
 {
     FOREACH_IFACE (i) {
-        if (cavl2_is_inserted(self->tx.pending[i], &tr->index_pending[i])) {
+        if (is_listed(&self->tx.pending[i][tx_priority(tr)], &tr->list_pending[i])) {
             CANARD_ASSERT(tr->cursor[i] != NULL);
             return true;
         }
@@ -467,6 +1341,39 @@ static bool tx_is_pending(const canard_t* const self, const tx_transfer_t* const
     return false;
 }
 
+static void tx_lazy_unreserve(canard_t* const self, tx_transfer_t* const tr)
+{
+    if (tr->lazy->reserved) {
+        CANARD_ASSERT(self->tx.queue_size > 0U);
+        CANARD_ASSERT(self->tx.queue_size_by_prio[tx_priority(tr)] > 0U);
+        self->tx.queue_size--;
+        self->tx.queue_size_by_prio[tx_priority(tr)]--;
+        tr->lazy->reserved = false;
+    }
+}
+
+static size_t tx_lazy_alloc_size(const bool stream) { return sizeof(tx_lazy_t) + (stream ? TX_STREAM_CHUNK_SIZE : 0U); }
+
+static void tx_lazy_free(canard_t* const self, tx_lazy_t* const lazy)
+{
+    mem_free(self->mem.tx_frame, tx_lazy_alloc_size(lazy->producer != NULL), lazy);
+}
+
+// Returns the payload of a lazy transfer to the application. The state is detached before the callback is invoked.
+static void tx_lazy_release(canard_t* const self, tx_transfer_t* const tr)
+{
+    tx_lazy_t* const lazy = tr->lazy;
+    if (lazy != NULL) {
+        tx_lazy_unreserve(self, tr);
+        const canard_tx_release_t release = lazy->release;
+        tx_lazy_free(self, lazy);
+        tr->lazy = NULL;
+        if (release != NULL) {
+            release(self, tr->user_context);
+        }
+    }
+}
+
 static void tx_free_payload(canard_t* const self, tx_transfer_t* const tr)
 {
     CANARD_ASSERT(tr != NULL);
@@ -479,18 +1386,122 @@ static void tx_free_payload(canard_t* const self, tx_transfer_t* const tr)
         }
         tr->cursor[i] = NULL;
     }
+    tx_lazy_release(self, tr);
 }
 
-// Smaller CAN ID on the left, then smaller seqno on the left.
-static int32_t tx_cavl_compare_pending_order(const void* const user, const canard_tree_t* const node)
+static tx_transfer_t* tx_pending_member_to_transfer(const canard_listed_t* const member, const byte_t iface_index)
 {
-    const tx_transfer_t* const lhs = (const tx_transfer_t*)user;
-    const tx_transfer_t* const rhs = CAVL2_TO_OWNER(node, tx_transfer_t, index_pending[0]); // clang-format off
-    if (lhs->can_id_msb < rhs->can_id_msb) { return -1; }
-    if (lhs->can_id_msb > rhs->can_id_msb) { return +1; }
-    return (lhs->seqno < rhs->seqno) ? -1 : +1; // clang-format on
+    return (tx_transfer_t*)ptr_unbias(
+      member, offsetof(tx_transfer_t, list_pending) + (((size_t)iface_index) * sizeof(canard_listed_t)));
+}
+
+static tx_transfer_t* tx_pending_index_to_transfer(const canard_tree_t* const node, const byte_t iface_index)
+{
+    return (tx_transfer_t*)ptr_unbias(
+      node, offsetof(tx_transfer_t, index_pending) + (((size_t)iface_index) * sizeof(canard_tree_t)));
+}
+
+typedef struct
+{
+    uint32_t can_id_msb;
+    byte_t   iface_index; // The comparator needs it to locate the owner of the tree node.
+} tx_pending_key_t;
+
+static int32_t tx_cavl_compare_pending(const void* const user, const canard_tree_t* const node)
+{
+    const tx_pending_key_t* const key = (const tx_pending_key_t*)user; // clang-format off
+    const uint32_t                can_id = tx_pending_index_to_transfer(node, key->iface_index)->can_id_msb;
+    if (key->can_id_msb < can_id) { return -1; }
+    if (key->can_id_msb > can_id) { return +1; }
+    return 0; // clang-format on
+}
+
+// The pending transfers of each interface are bucketed by priority. Each bucket is kept in the arbitration order:
+// smaller CAN ID first, then smaller seqno first. The seqno of a new transfer is always the greatest, so it goes
+// right after the last transfer with the same or the nearest smaller CAN ID. The last transfer of each CAN ID in the
+// bucket is indexed by CAN ID, so the position is found in constant time if the new transfer has the greatest CAN ID
+// in the bucket, as is common, and otherwise in logarithmic time in the number of distinct CAN IDs in the bucket.
+static void tx_pending_insert(canard_t* const self, tx_transfer_t* const tr, const byte_t iface_index)
+{
+    const byte_t           prio  = tx_priority(tr);
+    canard_list_t* const   list  = &self->tx.pending[iface_index][prio];
+    canard_tree_t** const  index = &self->tx.pending_by_can_id[iface_index][prio];
+    const tx_pending_key_t key   = { .can_id_msb = tr->can_id_msb, .iface_index = iface_index };
+    tx_transfer_t*         prev  = tx_pending_member_to_transfer(list->tail, iface_index);
+    if ((prev != NULL) && (prev->can_id_msb > tr->can_id_msb)) {
+        prev = tx_pending_index_to_transfer(cavl2_predecessor(*index, &key, tx_cavl_compare_pending), iface_index);
+    }
+    CANARD_ASSERT((prev == NULL) || ((prev->can_id_msb <= tr->can_id_msb) && (prev->seqno < tr->seqno)));
+    enlist_before(
+      list, (prev != NULL) ? prev->list_pending[iface_index].next : list->head, &tr->list_pending[iface_index]);
+    if ((prev != NULL) && (prev->can_id_msb == tr->can_id_msb)) { // The new transfer is now the last of its CAN ID.
+        cavl2_replace(index, &prev->index_pending[iface_index], &tr->index_pending[iface_index]);
+    } else {
+        const canard_tree_t* const node = cavl2_find_or_insert(
+          index, &key, tx_cavl_compare_pending, &tr->index_pending[iface_index], cavl2_trivial_factory);
+        CANARD_ASSERT(node == &tr->index_pending[iface_index]);
+        (void)node;
+    }
+    self->tx.pending_prio_bitmap[iface_index] |= (uint_least8_t)(1U << prio);
+}
+
+// No effect if the transfer is not pending on the specified interface.
+static void tx_pending_remove(canard_t* const self, tx_transfer_t* const tr, const byte_t iface_index)
+{
+    const byte_t          prio  = tx_priority(tr);
+    canard_list_t* const  list  = &self->tx.pending[iface_index][prio];
+    canard_tree_t** const index = &self->tx.pending_by_can_id[iface_index][prio];
+    canard_tree_t* const  node  = &tr->index_pending[iface_index];
+    if (cavl2_is_inserted(*index, node)) { // The last of its CAN ID; the previous one may take over.
+        tx_transfer_t* const prev = tx_pending_member_to_transfer(tr->list_pending[iface_index].prev, iface_index);
+        if ((prev != NULL) && (prev->can_id_msb == tr->can_id_msb)) {
+            cavl2_replace(index, node, &prev->index_pending[iface_index]);
+        } else {
+            cavl2_remove(index, node);
+        }
+    }
+    delist(list, &tr->list_pending[iface_index]);
+    if (list->head == NULL) {
+        CANARD_ASSERT(*index == NULL);
+        self->tx.pending_prio_bitmap[iface_index] &= (uint_least8_t)~(1U << prio);
+    }
+}
+
+// The next transfer to transmit: the head of the highest (numerically smallest) nonempty priority level.
+static tx_transfer_t* tx_pending_first(const canard_t* const self, const byte_t iface_index)
+{
+    const unsigned bitmap = self->tx.pending_prio_bitmap[iface_index];
+    if (bitmap == 0U) {
+        return NULL;
+    }
+    const byte_t prio = popcount((bitmap & (~bitmap + 1U)) - 1U); // Index of the lowest set bit.
+    CANARD_ASSERT(prio < CANARD_PRIO_COUNT);
+    return tx_pending_member_to_transfer(self->tx.pending[iface_index][prio].head, iface_index);
+}
+
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+// The buckets are kept sorted by deadline (calendar queue), so that expiration stops at the first transfer that is
+// not yet due, which may belong to a later rotation of the wheel. The insertion point is searched from the tail,
+// which is constant-time when the deadlines are mostly monotonic, as is typical.
+// Never file under an already processed tick, otherwise the transfer would be missed until the wheel wraps around.
+static void tx_deadline_insert(canard_t* const self, tx_transfer_t* const tr)
+{
+    const int64_t tick  = later(tr->deadline / CANARD_TX_DEADLINE_WHEEL_TICK_us, self->tx.deadline_tick);
+    tr->deadline_bucket = (uint16_t)(((uint64_t)tick) % CANARD_TX_DEADLINE_WHEEL_SIZE);
+
+    canard_list_t* const bucket = &self->tx.deadline[tr->deadline_bucket];
+    tx_transfer_t*       prev   = LIST_TAIL(*bucket, tx_transfer_t, list_deadline);
+    while ((prev != NULL) && (prev->deadline > tr->deadline)) {
+        prev = LIST_PREV(prev, tx_transfer_t, list_deadline);
+    }
+    enlist_before(bucket, (prev != NULL) ? prev->list_deadline.next : bucket->head, &tr->list_deadline);
 }
 
+static void tx_deadline_remove(canard_t* const self, tx_transfer_t* const tr)
+{
+    delist(&self->tx.deadline[tr->deadline_bucket], &tr->list_deadline);
+}
+#else
 // Soonest to expire (smallest deadline) on the left, then smaller seqno on the left.
 static int32_t tx_cavl_compare_deadline(const void* const user, const canard_tree_t* const node)
 {
@@ -501,29 +1512,102 @@ static int32_t tx_cavl_compare_deadline(const void* const user, const canard_tre
     return (lhs->seqno < rhs->seqno) ? -1 : +1; // clang-format on
 }
 
+static void tx_deadline_insert(canard_t* const self, tx_transfer_t* const tr)
+{
+    const canard_tree_t* const tree = cavl2_find_or_insert(
+      &self->tx.deadline, tr, tx_cavl_compare_deadline, &tr->index_deadline, cavl2_trivial_factory);
+    CANARD_ASSERT(tree == &tr->index_deadline);
+    (void)tree;
+}
+
+static void tx_deadline_remove(canard_t* const self, tx_transfer_t* const tr)
+{
+    CANARD_ASSERT(cavl2_is_inserted(self->tx.deadline, &tr->index_deadline));
+    cavl2_remove(&self->tx.deadline, &tr->index_deadline);
+}
+#endif
+
 static void tx_make_pending(canard_t* const self, tx_transfer_t* const tr)
 {
     FOREACH_IFACE (i) { // Enqueue for transmission unless it's there already (stalled interface?)
-        if ((tr->cursor[i] != NULL) && !cavl2_is_inserted(self->tx.pending[i], &tr->index_pending[i])) {
-            const canard_tree_t* const tree = cavl2_find_or_insert(
-              &self->tx.pending[i], tr, tx_cavl_compare_pending_order, &tr->index_pending[i], cavl2_trivial_factory);
-            CANARD_ASSERT(tree == &tr->index_pending[i]);
-            (void)tree;
+        if ((tr->cursor[i] != NULL) && !is_listed(&self->tx.pending[i][tx_priority(tr)], &tr->list_pending[i])) {
+            tx_pending_insert(self, tr, (byte_t)i);
         }
     }
 }
 
-// Retire one transfer and release its resources.
-static void tx_retire(canard_t* const self, tx_transfer_t* const tr)
+// Remove one transfer from the queue and release its frames, but not the transfer object itself.
+static void tx_dequeue(canard_t* const self, tx_transfer_t* const tr)
 {
     FOREACH_IFACE (i) {
-        (void)cavl2_remove_if(&self->tx.pending[i], &tr->index_pending[i]);
+        tx_pending_remove(self, tr, (byte_t)i);
     }
-    CANARD_ASSERT(cavl2_is_inserted(self->tx.deadline, &tr->index_deadline));
-    cavl2_remove(&self->tx.deadline, &tr->index_deadline);
+    tx_deadline_remove(self, tr);
     delist(&self->tx.agewise, &tr->list_agewise);
+    delist(&self->tx.agewise_by_prio[tx_priority(tr)], &tr->list_agewise_by_prio);
     tx_free_payload(self, tr);
-    mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), tr);
+}
+
+// Notifies the application that the transfer has left the queue, if it wants to know. The payload is already released.
+static void tx_report(canard_t* const self, const tx_transfer_t* const tr, const canard_tx_outcome_t outcome)
+{
+    if (self->vtable->tx_done != NULL) {
+#if CANARD_TX_TIMESTAMPS
+        self->vtable->tx_done(
+          self, tr->user_context, outcome, tr->enqueue_ts, tr->first_frame_ts, tr->last_frame_ts, tr->iface_done);
+#else
+        self->vtable->tx_done(self, tr->user_context, outcome, BIG_BANG, BIG_BANG, BIG_BANG, tr->iface_done);
+#endif
+    }
+}
+
+// Retire one transfer and release its resources.
+static void tx_retire(canard_t* const self, tx_transfer_t* const tr, const canard_tx_outcome_t outcome)
+{
+    tx_dequeue(self, tr);
+    tx_report(self, tr, outcome);
+    tx_transfer_free(self, tr);
+}
+
+// Latest-value-wins: finds the newest enqueued transfer with the same CAN ID and the same interfaces that has not
+// started transmission on any of them, dequeues it, and recycles the object for the new transfer.
+// Only the newest one of its CAN ID on every interface is eligible, so that the recycled transfer, which is the newest
+// again, keeps its place relative to the others. Returns NULL if there is no eligible transfer.
+// The complexity is logarithmic in the number of distinct CAN IDs pending at the same priority level.
+static tx_transfer_t* tx_coalesce(canard_t* const   self,
+                                  const canard_us_t deadline,
+                                  const uint32_t    can_id_template,
+                                  const byte_t      iface_bitmap,
+                                  void* const       user_context)
+{
+    const uint32_t can_id_msb = (can_id_template >> (29U - CAN_ID_MSb_BITS)) & ((1U << CAN_ID_MSb_BITS) - 1U);
+    const byte_t   prio       = (byte_t)(can_id_msb >> (CAN_ID_MSb_BITS - CANARD_PRIO_BITS));
+    const byte_t   effective  = iface_bitmap & (byte_t)self->iface_bitmap;
+    tx_transfer_t* out        = NULL;
+    FOREACH_IFACE (i) {
+        if ((effective & (1U << i)) != 0U) {
+            const tx_pending_key_t key = { .can_id_msb = can_id_msb, .iface_index = (byte_t)i };
+            tx_transfer_t* const   tr  = tx_pending_index_to_transfer(
+              cavl2_find(self->tx.pending_by_can_id[i][prio], &key, tx_cavl_compare_pending), (byte_t)i);
+            if ((tr == NULL) || ((out != NULL) && (tr != out))) {
+                return NULL;
+            }
+            out = tr;
+        }
+    }
+    if ((out == NULL) || (out->first_frame_departed != 0U) || ((out->fd != 0U) != self->tx.fd)) {
+        return NULL;
+    }
+    FOREACH_IFACE (i) {
+        if ((out->cursor[i] != NULL) != ((effective & (1U << i)) != 0U)) {
+            return NULL;
+        }
+    }
+    tx_dequeue(self, out);
+    tx_report(self, out, canard_tx_outcome_superseded);
+    tx_transfer_init(self, out, deadline, can_id_template, self->tx.fd, user_context);
+    self->tx.coalesced++;
+    return out;
 }
 
 static byte_t tx_make_tail_byte(const bool sot, const bool eot, const bool tog, const byte_t transfer_id)
@@ -539,46 +1623,119 @@ static size_t tx_ceil_frame_payload_size(const size_t x)
     return canard_dlc_to_len[canard_len_to_dlc[x]];
 }
 
-// Builds a chain of tx_frame_t instances, or NULL if OOM.
+static tx_spooler_t tx_spooler_make(const canard_bytes_chain_t* const payload,
+                                    const size_t                      size,
+                                    const size_t                      mtu,
+                                    const uint16_t                    crc_seed,
+                                    const byte_t                      transfer_id)
+{
+    CANARD_ASSERT(size >= mtu); // Single-frame transfers are handled separately.
+    return (tx_spooler_t){ .reader      = { .cursor = payload, .position = 0U },
+                           .size        = size,
+                           .offset      = 0U,
+                           .mtu         = mtu,
+                           .crc         = crc_seed,
+                           .transfer_id = transfer_id,
+                           .toggle      = true }; // Cyphal transfers start with toggle==1, unlike legacy
+}
+
+static bool tx_spooler_done(const tx_spooler_t* const sp) { return sp->offset >= (sp->size + CRC_BYTES); }
+
+// Emits the next frame of the transfer. Returns NULL if OOM, in which case the state is not modified.
+// A gather frame references the payload instead of copying it, see tx_gather_t; the block is not used then.
+static tx_frame_t* tx_spooler_next(canard_t* const     self,
+                                   tx_spooler_t* const sp,
+                                   tx_block_t* const   block,
+                                   const byte_t        prio,
+                                   const bool          gather)
+{
+    CANARD_ASSERT(!tx_spooler_done(sp));
+    const size_t size          = sp->size;
+    const size_t size_with_crc = size + CRC_BYTES;
+    const size_t frame_size_with_tail =
+      ((size_with_crc - sp->offset) < (sp->mtu - 1U))
+        ? tx_ceil_frame_payload_size((size_with_crc - sp->offset) + 1U) // padding last frame only
+        : sp->mtu;
+    const size_t      frame_size = frame_size_with_tail - 1U;
+    const size_t      move_size  = (sp->offset < size) ? smaller(size - sp->offset, frame_size) : 0U;
+    tx_frame_t* const frame      = gather ? tx_gather_frame_new(self, prio, frame_size_with_tail, move_size)
+                                          : tx_block_frame_new(self, block, prio, frame_size_with_tail);
+    if (frame == NULL) {
+        return NULL;
+    }
+    // Populate the frame contents. The data of a gather frame begins after the slice.
+    const bool   sot          = sp->offset == 0U;
+    const size_t base         = gather ? move_size : 0U;
+    size_t       frame_offset = 0U;
+    if (gather) {
+        tx_gather_of(frame)->slice = sp->reader;
+        sp->crc                    = bytes_chain_crc(&sp->reader, move_size, sp->crc);
+    } else if (sp->reader.cursor != NULL) { // Otherwise, written in place later; see tx_reservation_seal().
+        bytes_chain_read(&sp->reader, move_size, frame->data);
+        sp->crc = crc_add(sp->crc, move_size, frame->data);
+    }
+    frame_offset += move_size;
+    sp->offset += move_size;
+    // Handle the last frame of the transfer: it is special because it also contains padding and CRC.
+    if (sp->offset >= size) {
+        // Insert padding -- only in the last frame. Include the padding bytes into the CRC.
+        while ((frame_offset + CRC_BYTES) < frame_size) {
+            frame->data[frame_offset - base] = PADDING_BYTE_VALUE;
+            ++frame_offset;
+            sp->crc = crc_add_byte(sp->crc, PADDING_BYTE_VALUE);
+        }
+        // Insert the CRC.
+        if ((frame_offset < frame_size) && (sp->offset == size)) {
+            frame->data[frame_offset - base] = (byte_t)((sp->crc >> 8U) & BYTE_MAX); // NOLINT(*-signed-bitwise)
+            ++frame_offset;
+            ++sp->offset;
+        }
+        if ((frame_offset < frame_size) && (sp->offset > size)) {
+            frame->data[frame_offset - base] = (byte_t)(sp->crc & BYTE_MAX);
+            ++frame_offset;
+            ++sp->offset;
+        }
+    }
+    // Finalize the frame.
+    CANARD_ASSERT((frame_offset + 1U) == canard_dlc_to_len[frame->dlc]);
+    frame->data[frame_offset - base] = tx_make_tail_byte(sot, tx_spooler_done(sp), sp->toggle, sp->transfer_id);
+    sp->toggle                       = !sp->toggle;
+    return frame;
+}
+
+// Builds a chain of tx_frame_t instances, or NULL if OOM. The owner, if given, may host a single-frame transfer.
 // This version works with Cyphal/CAN transfers. Legacy transfers require a different layout, see dedicated function.
-static tx_frame_t* tx_spool(canard_t* const            self,
-                            const uint16_t             crc_seed,
-                            const size_t               mtu,
-                            const byte_t               transfer_id,
-                            const size_t               size,
-                            const canard_bytes_chain_t payload)
-{
-    bytes_chain_reader_t reader = { .cursor = &payload, .position = 0U };
-    tx_frame_t*          head   = NULL;
-    bool                 toggle = true; // Cyphal transfers start with toggle==1, unlike legacy
-    if (size < mtu) {                   // Single-frame transfer; no CRC required -- easy case.
+// If the payload is NULL, the payload bytes are left to be written in place by the application, and so is the CRC.
+static tx_frame_t* tx_spool(canard_t* const                   self,
+                            tx_transfer_t* const              owner,
+                            const byte_t                      prio,
+                            const uint16_t                    crc_seed,
+                            const size_t                      mtu,
+                            const byte_t                      transfer_id,
+                            const size_t                      size,
+                            const canard_bytes_chain_t* const payload)
+{
+    tx_frame_t* head = NULL;
+    if (size < mtu) { // Single-frame transfer; no CRC required -- easy case.
         const size_t frame_size = tx_ceil_frame_payload_size(size + 1U);
-        head                    = tx_frame_new(self, frame_size);
+        head                    = tx_frame_new_single(self, owner, prio, frame_size);
         if (head != NULL) {
-            bytes_chain_read(&reader, size, head->data);
+            if (payload != NULL) {
+                bytes_chain_reader_t reader = { .cursor = payload, .position = 0U };
+                bytes_chain_read(&reader, size, head->data);
+            }
             // NOLINTNEXTLINE(*-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
             memset(&head->data[size], PADDING_BYTE_VALUE, frame_size - size - 1U);
-            head->data[frame_size - 1U] = tx_make_tail_byte(true, true, toggle, transfer_id);
+            head->data[frame_size - 1U] = tx_make_tail_byte(true, true, true, transfer_id);
         }
     } else {
-        const size_t size_with_crc = size + CRC_BYTES;
-        size_t       offset        = 0U;
-        uint16_t     crc           = crc_seed;
-        tx_frame_t*  tail          = NULL;
-        while (offset < size_with_crc) {
-            const size_t frame_size_with_tail =
-              ((size_with_crc - offset) < (mtu - 1U))
-                ? tx_ceil_frame_payload_size((size_with_crc - offset) + 1U) // padding last frame only
-                : mtu;
-            tx_frame_t* const item = tx_frame_new(self, frame_size_with_tail);
-            if (NULL == head) {
-                head = item;
-            } else {
-                tail->next = item;
-            }
-            tail = item;
+        tx_spooler_t      sp    = tx_spooler_make(payload, size, mtu, crc_seed, transfer_id);
+        tx_block_t* const block = tx_block_new(self, ((size + CRC_BYTES + mtu) - 2U) / (mtu - 1U), mtu);
+        tx_frame_t*       tail  = NULL;
+        while (!tx_spooler_done(&sp)) {
+            tx_frame_t* const item = tx_spooler_next(self, &sp, block, prio, false);
             // On OOM, deallocate the entire chain and quit.
-            if (NULL == tail) {
+            if (NULL == item) {
                 while (head != NULL) {
                     tx_frame_t* const next = head->next;
                     canard_refcount_dec(self, tx_frame_view(head));
@@ -586,40 +1743,12 @@ static tx_frame_t* tx_spool(canard_t* const            self,
                 }
                 break;
             }
-            // Populate the frame contents.
-            const size_t frame_size   = frame_size_with_tail - 1U;
-            size_t       frame_offset = 0U;
-            if (offset < size) {
-                const size_t move_size = smaller(size - offset, frame_size);
-                bytes_chain_read(&reader, move_size, tail->data);
-                crc = crc_add(crc, move_size, tail->data);
-                frame_offset += move_size;
-                offset += move_size;
-            }
-            // Handle the last frame of the transfer: it is special because it also contains padding and CRC.
-            if (offset >= size) {
-                // Insert padding -- only in the last frame. Include the padding bytes into the CRC.
-                while ((frame_offset + CRC_BYTES) < frame_size) {
-                    tail->data[frame_offset] = PADDING_BYTE_VALUE;
-                    ++frame_offset;
-                    crc = crc_add_byte(crc, PADDING_BYTE_VALUE);
-                }
-                // Insert the CRC.
-                if ((frame_offset < frame_size) && (offset == size)) {
-                    tail->data[frame_offset] = (byte_t)((crc >> 8U) & BYTE_MAX); // NOLINT(*-signed-bitwise)
-                    ++frame_offset;
-                    ++offset;
-                }
-                if ((frame_offset < frame_size) && (offset > size)) {
-                    tail->data[frame_offset] = (byte_t)(crc & BYTE_MAX);
-                    ++frame_offset;
-                    ++offset;
-                }
+            if (NULL == head) {
+                head = item;
+            } else {
+                tail->next = item;
             }
-            // Finalize the frame.
-            CANARD_ASSERT((frame_offset + 1U) == canard_dlc_to_len[tail->dlc]);
-            tail->data[frame_offset] = tx_make_tail_byte(head == tail, offset >= size_with_crc, toggle, transfer_id);
-            toggle                   = !toggle;
+            tail = item;
         }
     }
     return head;
@@ -628,6 +1757,8 @@ static tx_frame_t* tx_spool(canard_t* const            self,
 // The legacy counterpart of tx_spool() for UAVCAN v0 transfers.
 // Always uses Classic CAN MTU because UAVCAN v0 does not support CAN FD.
 static tx_frame_t* tx_spool_v0(canard_t* const            self,
+                               tx_transfer_t* const       owner,
+                               const byte_t               prio,
                                const uint16_t             crc_seed,
                                const byte_t               transfer_id,
                                const size_t               size,
@@ -635,7 +1766,7 @@ static tx_frame_t* tx_spool_v0(canard_t* const            self,
 {
     bool toggle = false;                 // in v0, toggle starts with zero; that's how v0/v1 can be distinguished
     if (size < CANARD_MTU_CAN_CLASSIC) { // single-frame transfer
-        tx_frame_t* const item = tx_frame_new(self, size + 1U);
+        tx_frame_t* const item = tx_frame_new_single(self, owner, prio, size + 1U);
         if (item != NULL) {
             bytes_chain_reader_t reader = { .cursor = &payload, .position = 0U };
             bytes_chain_read(&reader, size, item->data);
@@ -652,8 +1783,11 @@ static tx_frame_t* tx_spool_v0(canard_t* const            self,
     tx_frame_t*                head          = NULL;
     tx_frame_t*                tail          = NULL;
     size_t                     offset        = 0U;
+    tx_block_t* const          block         = tx_block_new(
+      self, ((size_total + CANARD_MTU_CAN_CLASSIC) - 2U) / (CANARD_MTU_CAN_CLASSIC - 1U), CANARD_MTU_CAN_CLASSIC);
     while (offset < size_total) {
-        tx_frame_t* const item = tx_frame_new(self, smaller((size_total - offset) + 1U, CANARD_MTU_CAN_CLASSIC));
+        tx_frame_t* const item =
+          tx_block_frame_new(self, block, prio, smaller((size_total - offset) + 1U, CANARD_MTU_CAN_CLASSIC));
         // On OOM, deallocate the entire chain and quit.
         if (NULL == item) {
             while (head != NULL) {
@@ -683,115 +1817,444 @@ static tx_frame_t* tx_spool_v0(canard_t* const            self,
     return head;
 }
 
-// When the queue is exhausted, finds a transfer to sacrifice using simple heuristics and returns it.
-// Will return NULL if there are no transfers worth sacrificing (no queue space can be reclaimed).
-// We cannot simply stop accepting new transfers when the queue is full, because it may be caused by a single
-// stalled interface holding back progress for all transfers.
-// The heuristics are subject to review and improvement.
-static tx_transfer_t* tx_sacrifice(const canard_t* const self)
+// True if the first transfer wins the arbitration against the second one on the same interface.
+static bool tx_arbitrates_before(const tx_transfer_t* const a, const tx_transfer_t* const b)
 {
-    return LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
+    return (a->can_id_msb < b->can_id_msb) || ((a->can_id_msb == b->can_id_msb) && (a->seqno < b->seqno));
 }
 
-// True on success, false if not possible to reclaim enough space.
-static bool tx_ensure_queue_space(canard_t* const self, const size_t total_frames_needed)
+#if CANARD_TX_DEADLINE_WHEEL_SIZE == 0
+// The mirror image of cavl2_next_greater().
+static canard_tree_t* tx_tree_next_smaller(canard_tree_t* const node)
 {
-    if (total_frames_needed > self->tx.queue_capacity) {
-        return false; // not gonna happen
+    if (node->lr[0] != NULL) {
+        return cavl2_max(node->lr[0]);
     }
-    while (total_frames_needed > (self->tx.queue_capacity - self->tx.queue_size)) {
-        tx_transfer_t* const tr = tx_sacrifice(self);
-        if (tr == NULL) {
-            break; // We may have no transfers anymore but the CAN driver could still be holding some pending frames.
-        }
-        tx_retire(self, tr);
-        self->err.tx_sacrifice++;
+    const canard_tree_t* n = node;
+    canard_tree_t*       p = node->up;
+    while ((p != NULL) && (p->lr[0] == n)) {
+        n = p;
+        p = p->up;
     }
-    return total_frames_needed <= (self->tx.queue_capacity - self->tx.queue_size);
+    return p;
 }
+#endif
 
-static size_t tx_predict_frame_count(const size_t transfer_size, const size_t mtu)
+// True if the transfer has already been chosen to be sacrificed in the current round; see tx_ensure_queue_space().
+// The epoch is zero until the first round, which the default policy never starts, so zero marks nothing.
+static bool tx_doomed(const canard_t* const self, const tx_transfer_t* const tr)
 {
-    const size_t bytes_per_frame = mtu - 1U; // 1 byte is used for the tail byte
-    if (transfer_size <= bytes_per_frame) {
-        return 1U; // single-frame transfer
-    }
-    return ((transfer_size + CRC_BYTES + bytes_per_frame) - 1U) / bytes_per_frame; // rounding up
+    return (tr->sacrifice_epoch != 0U) && (tr->sacrifice_epoch == self->tx.sacrifice_epoch);
 }
 
-static void tx_expire(canard_t* const self, const canard_us_t now)
+// True if the transfer belongs to one of the priority levels in the bitmap and is not doomed yet.
+static bool tx_in_levels(const canard_t* const self, const tx_transfer_t* const tr, const byte_t levels)
 {
-    tx_transfer_t* tr = CAVL2_TO_OWNER(cavl2_min(self->tx.deadline), tx_transfer_t, index_deadline);
-    while ((tr != NULL) && (now > tr->deadline)) {
-        tx_transfer_t* const tr_next =
-          CAVL2_TO_OWNER(cavl2_next_greater(&tr->index_deadline), tx_transfer_t, index_deadline);
-        tx_retire(self, tr);
-        self->err.tx_expiration++;
-        tr = tr_next;
-    }
+    return (((levels >> tx_priority(tr)) & 1U) != 0U) && !tx_doomed(self, tr);
 }
 
-// Enqueues a transfer for transmission.
-static bool tx_push(canard_t* const            self,
-                    tx_transfer_t* const       tr,
-                    const bool                 v0,
-                    const byte_t               iface_bitmap,
-                    const byte_t               transfer_id,
-                    const canard_bytes_chain_t payload,
-                    const uint16_t             crc_seed)
+// The oldest enqueued transfer at the specified priority level that is not doomed yet.
+static tx_transfer_t* tx_oldest_at(const canard_t* const self, const byte_t prio)
 {
-    CANARD_ASSERT(tr != NULL);
-    CANARD_ASSERT((!tr->fd) || !v0); // The caller must ensure this.
-    CANARD_ASSERT(iface_bitmap != 0);
-
-    const byte_t effective = iface_bitmap & (byte_t)self->iface_bitmap;
-    if (effective == 0) {
-        mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), tr);
-        return false;
+    tx_transfer_t* tr = LIST_HEAD(self->tx.agewise_by_prio[prio], tx_transfer_t, list_agewise_by_prio);
+    while ((tr != NULL) && tx_doomed(self, tr)) {
+        tr = LIST_NEXT(tr, tx_transfer_t, list_agewise_by_prio);
     }
+    return tr;
+}
 
-    const canard_us_t now = self->vtable->now(self);
-
-    // Expire old transfers first to free up queue space.
-    tx_expire(self, now);
-
-    // Ensure the queue has enough space. v0 transfers always use Classic CAN regardless of tr->fd.
-    const size_t mtu      = tr->fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
-    const size_t size     = bytes_chain_size(payload);
-    const size_t n_frames = tx_predict_frame_count(size, mtu);
-    CANARD_ASSERT(n_frames > 0);
-    tr->multi_frame = n_frames > 1U;
-    if (!tx_ensure_queue_space(self, n_frames)) {
-        self->err.tx_capacity++;
-        mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), tr);
-        return false;
+// The enqueued transfer with the latest deadline among the specified priority levels; the newest one among equals.
+static tx_transfer_t* tx_latest_deadline(const canard_t* const self, const byte_t levels)
+{
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+    tx_transfer_t* out = NULL;
+    for (size_t i = 0; i < CANARD_TX_DEADLINE_WHEEL_SIZE; i++) { // The buckets are sorted, the tail is the latest.
+        tx_transfer_t* tr = LIST_TAIL(self->tx.deadline[i], tx_transfer_t, list_deadline);
+        while ((tr != NULL) && !tx_in_levels(self, tr, levels)) {
+            tr = LIST_PREV(tr, tx_transfer_t, list_deadline);
+        }
+        if ((tr != NULL) && ((out == NULL) || (tr->deadline > out->deadline) ||
+                             ((tr->deadline == out->deadline) && (tr->seqno > out->seqno)))) {
+            out = tr;
+        }
     }
-
-    // Make a shared frame spool. Unlike the Cyphal/UDP implementation, we require all ifaces to use the same MTU.
-    const size_t      queue_size_before = self->tx.queue_size;
-    tx_frame_t* const spool             = v0 ? tx_spool_v0(self, crc_seed, transfer_id, size, payload)
-                                             : tx_spool(self, crc_seed, mtu, transfer_id, size, payload);
-    if (spool == NULL) {
-        self->err.oom++;
-        mem_free(self->mem.tx_transfer, sizeof(tx_transfer_t), tr);
-        return false;
+    return out;
+#else
+    tx_transfer_t* tr = CAVL2_TO_OWNER(cavl2_max(self->tx.deadline), tx_transfer_t, index_deadline);
+    while ((tr != NULL) && !tx_in_levels(self, tr, levels)) {
+        tr = CAVL2_TO_OWNER(tx_tree_next_smaller(&tr->index_deadline), tx_transfer_t, index_deadline);
     }
-    CANARD_ASSERT((self->tx.queue_size - queue_size_before) == n_frames);
-    CANARD_ASSERT(self->tx.queue_size <= self->tx.queue_capacity);
-    (void)queue_size_before;
+    return tr;
+#endif
+}
 
-    // Adjust the spooled frame refcounts to avoid premature deallocation.
-    const byte_t frame_refcount_inc = (byte_t)(popcount(effective) - 1U);
-    CANARD_ASSERT(frame_refcount_inc < CANARD_IFACE_COUNT);
-    if (frame_refcount_inc > 0) {
-        tx_frame_t* frame = spool;
-        while (frame != NULL) {
-            frame->refcount += frame_refcount_inc;
-            frame = frame->next;
+// The oldest enqueued transfer among the specified priority levels.
+static tx_transfer_t* tx_oldest(const canard_t* const self, const byte_t levels)
+{
+    if (levels == BYTE_MAX) {
+        tx_transfer_t* tr = LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
+        while ((tr != NULL) && tx_doomed(self, tr)) {
+            tr = LIST_NEXT(tr, tx_transfer_t, list_agewise);
         }
+        return tr;
     }
-
-    // Attach the spool.
+    tx_transfer_t* out = NULL;
+    FOREACH_PRIO (p) {
+        tx_transfer_t* const tr = tx_oldest_at(self, (byte_t)p);
+        if ((tr != NULL) && tx_in_levels(self, tr, levels) && ((out == NULL) || (tr->seqno < out->seqno))) {
+            out = tr;
+        }
+    }
+    return out;
+}
+
+// When the queue is exhausted, finds a transfer to sacrifice according to the configured policy and returns it.
+// Only the transfers at the specified priority levels that are not doomed yet are considered.
+// Will return NULL if there are no transfers worth sacrificing (no queue space can be reclaimed), or if the policy
+// prefers to reject the new transfer instead; the new transfer is not enqueued yet.
+// We cannot simply stop accepting new transfers when the queue is full, because it may be caused by a single
+// stalled interface holding back progress for all transfers.
+static tx_transfer_t* tx_sacrifice(const canard_t* const self, const tx_transfer_t* const newcomer, const byte_t levels)
+{
+    if (self->tx.sacrifice_policy == canard_tx_sacrifice_latest_deadline) {
+        tx_transfer_t* const tr = tx_latest_deadline(self, levels);
+        return ((tr != NULL) && (tr->deadline > newcomer->deadline)) ? tr : NULL;
+    }
+    if ((self->tx.sacrifice_policy != canard_tx_sacrifice_lowest_priority) &&
+        (self->tx.sacrifice_policy != canard_tx_sacrifice_oldest_lowest_priority)) {
+        return tx_oldest(self, levels);
+    }
+    size_t prio = CANARD_PRIO_COUNT; // Find the lowest nonempty priority level.
+    while ((prio > 0) &&
+           ((((levels >> (prio - 1U)) & 1U) == 0U) || (tx_oldest_at(self, (byte_t)(prio - 1U)) == NULL))) {
+        prio--;
+    }
+    if ((prio == 0) || ((prio - 1U) < tx_priority(newcomer))) {
+        return NULL; // Nothing enqueued at the priority of the new transfer or lower.
+    }
+    prio--;
+    if (self->tx.sacrifice_policy == canard_tx_sacrifice_oldest_lowest_priority) {
+        return tx_oldest_at(self, (byte_t)prio);
+    }
+    // Every enqueued transfer is pending on at least one interface, so the last one is at the tail of some bucket.
+    tx_transfer_t* last = NULL;
+    FOREACH_IFACE (i) {
+        const canard_listed_t* member = self->tx.pending[i][prio].tail;
+        while ((member != NULL) && tx_doomed(self, tx_pending_member_to_transfer(member, (byte_t)i))) {
+            member = member->prev;
+        }
+        tx_transfer_t* const tr = tx_pending_member_to_transfer(member, (byte_t)i);
+        if ((tr != NULL) && ((last == NULL) || tx_arbitrates_before(last, tr))) {
+            last = tr;
+        }
+    }
+    CANARD_ASSERT(last != NULL);
+    return tx_arbitrates_before(newcomer, last) ? last : NULL;
+}
+
+// The number of frames that a new transfer at the specified priority level can take without sacrificing anything:
+// the free space less the unused reservations of the other levels, capped by the limit of its own level.
+static size_t tx_queue_headroom(const canard_t* const self, const byte_t prio)
+{
+    size_t out = self->tx.queue_capacity - self->tx.queue_size;
+    FOREACH_PRIO (p) {
+        const size_t used = self->tx.queue_size_by_prio[p];
+        if ((p != prio) && (self->tx.queue_reserve[p] > used)) {
+            const size_t unused = self->tx.queue_reserve[p] - used;
+            out                 = (out > unused) ? (out - unused) : 0U;
+        }
+    }
+    const size_t used = self->tx.queue_size_by_prio[prio];
+    return smaller(out, (self->tx.queue_limit[prio] > used) ? (self->tx.queue_limit[prio] - used) : 0U);
+}
+
+// The priority levels whose transfers can be sacrificed to make room for a new transfer at the specified level.
+// The transfers of the same level always can; those of the other levels only if their level is above its reservation,
+// and only if the new transfer does not exceed the limit of its own level.
+static byte_t tx_sacrifice_levels(const canard_t* const self, const byte_t prio, const size_t frames_needed)
+{
+    byte_t out = (byte_t)(1U << prio);
+    if ((self->tx.queue_size_by_prio[prio] + frames_needed) <= self->tx.queue_limit[prio]) {
+        FOREACH_PRIO (p) {
+            const size_t reserve = self->tx.queue_reserve[p];
+            if ((reserve == 0U) || (self->tx.queue_size_by_prio[p] > reserve)) {
+                out |= (byte_t)(1U << p);
+            }
+        }
+    }
+    return out;
+}
+
+// The number of frames that would be freed if the transfer was retired now. The frames that are referenced elsewhere,
+// such as those held by the driver, are not counted. The cursors point into the same spool, so the references to
+// a frame held by the transfer are the cursors at or before it; the cursor that is the furthest behind sees them all.
+static size_t tx_reclaimable(const tx_transfer_t* const tr)
+{
+    const tx_frame_t* head     = NULL;
+    size_t            head_len = 0U;
+    FOREACH_IFACE (i) {
+        size_t len = 0U;
+        for (const tx_frame_t* frame = tr->cursor[i]; frame != NULL; frame = frame->next) {
+            len++;
+        }
+        if (len > head_len) {
+            head     = tr->cursor[i];
+            head_len = len;
+        }
+    }
+    size_t out  = ((tr->lazy != NULL) && tr->lazy->reserved) ? 1U : 0U;
+    size_t refs = 0U;
+    for (const tx_frame_t* frame = head; frame != NULL; frame = frame->next) {
+        FOREACH_IFACE (i) {
+            refs += (tr->cursor[i] == frame) ? 1U : 0U;
+        }
+        out += (frame->refcount == refs) ? 1U : 0U;
+    }
+    return out;
+}
+
+// Starts a new sacrifice round, which voids the marks left by the previous one.
+static void tx_sacrifice_epoch_next(canard_t* const self)
+{
+    self->tx.sacrifice_epoch++;
+    if (self->tx.sacrifice_epoch == 0U) { // Wrapped around, so an old mark could be mistaken for a new one.
+        tx_transfer_t* tr = LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
+        while (tr != NULL) {
+            tr->sacrifice_epoch = 0U;
+            tr                  = LIST_NEXT(tr, tx_transfer_t, list_agewise);
+        }
+        self->tx.sacrifice_epoch = 1U;
+    }
+}
+
+// True if the victims chosen by the policy can make enough room for the new transfer before the policy would rather
+// reject it. Nothing is removed: the victims are only marked as doomed while the queue size is discounted.
+static bool tx_sacrifice_feasible(canard_t* const            self,
+                                  const tx_transfer_t* const newcomer,
+                                  const size_t               total_frames_needed)
+{
+    const byte_t prio       = tx_priority(newcomer);
+    const size_t queue_size = self->tx.queue_size;
+    size_t       queue_size_by_prio[CANARD_PRIO_COUNT];
+    (void)memcpy(queue_size_by_prio, self->tx.queue_size_by_prio, sizeof(queue_size_by_prio));
+    tx_sacrifice_epoch_next(self);
+    while (total_frames_needed > tx_queue_headroom(self, prio)) {
+        const byte_t         levels = tx_sacrifice_levels(self, prio, total_frames_needed);
+        tx_transfer_t* const tr     = tx_sacrifice(self, newcomer, levels);
+        if (tr == NULL) {
+            break;
+        }
+        tr->sacrifice_epoch = self->tx.sacrifice_epoch;
+        const size_t frames = tx_reclaimable(tr);
+        CANARD_ASSERT(self->tx.queue_size_by_prio[tx_priority(tr)] >= frames);
+        self->tx.queue_size -= frames;
+        self->tx.queue_size_by_prio[tx_priority(tr)] -= frames;
+    }
+    const bool out = total_frames_needed <= tx_queue_headroom(self, prio);
+
+    self->tx.queue_size = queue_size;
+    (void)memcpy(self->tx.queue_size_by_prio, queue_size_by_prio, sizeof(queue_size_by_prio));
+    tx_sacrifice_epoch_next(self); // Un-doom the victims for the real round.
+    return out;
+}
+
+// True on success, false if not possible to reclaim enough space; then, unless the default policy is used,
+// the enqueued transfers are left intact.
+static bool tx_ensure_queue_space(canard_t* const            self,
+                                  const tx_transfer_t* const newcomer,
+                                  const size_t               total_frames_needed)
+{
+    const byte_t prio = tx_priority(newcomer);
+    if ((total_frames_needed > self->tx.queue_capacity) || (total_frames_needed > self->tx.queue_limit[prio])) {
+        return false; // not gonna happen
+    }
+    // The default policy evicts the oldest transfers until there is enough room, as before; the others may prefer
+    // the new transfer over the enqueued ones, so their victims are chosen before anything is removed.
+    if ((self->tx.sacrifice_policy != canard_tx_sacrifice_oldest) &&
+        (total_frames_needed > tx_queue_headroom(self, prio)) &&
+        !tx_sacrifice_feasible(self, newcomer, total_frames_needed)) {
+        return false;
+    }
+    while (total_frames_needed > tx_queue_headroom(self, prio)) {
+        const byte_t         levels = tx_sacrifice_levels(self, prio, total_frames_needed);
+        tx_transfer_t* const tr     = tx_sacrifice(self, newcomer, levels);
+        if (tr == NULL) {
+            break; // We may have no transfers anymore but the CAN driver could still be holding some pending frames.
+        }
+        self->err.tx_sacrifice_by_prio[tx_priority(tr)]++;
+        tx_retire(self, tr, canard_tx_outcome_sacrificed);
+        self->err.tx_sacrifice++;
+    }
+    return total_frames_needed <= tx_queue_headroom(self, prio);
+}
+
+static size_t tx_predict_frame_count(const size_t transfer_size, const size_t mtu)
+{
+    const size_t bytes_per_frame = mtu - 1U; // 1 byte is used for the tail byte
+    if (transfer_size <= bytes_per_frame) {
+        return 1U; // single-frame transfer
+    }
+    return ((transfer_size + CRC_BYTES + bytes_per_frame) - 1U) / bytes_per_frame; // rounding up
+}
+
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+// Visits the buckets of the ticks elapsed since the last call, including the current one which may be only partially
+// due. If more than a full rotation has elapsed, every bucket is visited once. Unlike the tree, the transfers that
+// expire in the same call are retired in the deadline order only within each bucket.
+static void tx_expire(canard_t* const self, const canard_us_t now)
+{
+    const int64_t now_tick = now / CANARD_TX_DEADLINE_WHEEL_TICK_us;
+    const int64_t last     = sooner(now_tick, (self->tx.deadline_tick + (int64_t)CANARD_TX_DEADLINE_WHEEL_SIZE) - 1);
+    for (int64_t tick = self->tx.deadline_tick; tick <= last; tick++) {
+        const canard_list_t* const bucket = &self->tx.deadline[((uint64_t)tick) % CANARD_TX_DEADLINE_WHEEL_SIZE];
+        tx_transfer_t*             tr     = LIST_HEAD(*bucket, tx_transfer_t, list_deadline);
+        while ((tr != NULL) && (now > tr->deadline)) {
+            tx_transfer_t* const tr_next = LIST_NEXT(tr, tx_transfer_t, list_deadline);
+            tx_retire(self, tr, canard_tx_outcome_expired);
+            self->err.tx_expiration++;
+            tr = tr_next;
+        }
+    }
+    self->tx.deadline_tick = later(self->tx.deadline_tick, now_tick); // The current tick will be revisited.
+}
+#else
+static void tx_expire(canard_t* const self, const canard_us_t now)
+{
+    tx_transfer_t* tr = CAVL2_TO_OWNER(cavl2_min(self->tx.deadline), tx_transfer_t, index_deadline);
+    while ((tr != NULL) && (now > tr->deadline)) {
+        tx_transfer_t* const tr_next =
+          CAVL2_TO_OWNER(cavl2_next_greater(&tr->index_deadline), tx_transfer_t, index_deadline);
+        tx_retire(self, tr, canard_tx_outcome_expired);
+        self->err.tx_expiration++;
+        tr = tr_next;
+    }
+}
+#endif
+
+// Whether the transfer is lazy and has frames yet to be generated.
+static bool tx_lazy_pending(const tx_transfer_t* const tr)
+{
+    return (tr->lazy != NULL) && !tx_spooler_done(&tr->lazy->spooler);
+}
+
+// Zero-copy frames are only possible if the driver can transmit them; otherwise, they are copied as usual.
+static bool tx_lazy_gather(const canard_t* const self, const tx_lazy_t* const lazy)
+{
+    return lazy->zero_copy && (self->vtable->tx_gather != NULL);
+}
+
+// Holds one queue slot for the next frame of a lazy transfer if there is headroom, so that the transfer cannot be
+// starved by newcomers while the queue is full. Returns whether the slot is held.
+static bool tx_lazy_reserve(canard_t* const self, tx_transfer_t* const tr)
+{
+    CANARD_ASSERT(tx_lazy_pending(tr));
+    tx_lazy_t* const lazy = tr->lazy;
+    const byte_t     prio = tx_priority(tr);
+    if ((!lazy->reserved) && (tx_queue_headroom(self, prio) > 0U)) {
+        self->tx.queue_size++;
+        self->tx.queue_size_by_prio[prio]++;
+        lazy->reserved = true;
+    }
+    return lazy->reserved;
+}
+
+// Generates the next frame of a lazy transfer, pulling its payload from the producer first if the transfer is streamed.
+// Returns NULL if there is no memory (counted) or if the producer has no data yet (not counted, as it is not an error).
+static tx_frame_t* tx_lazy_next(canard_t* const  self,
+                                tx_lazy_t* const lazy,
+                                const byte_t     prio,
+                                void* const      user_context)
+{
+    tx_spooler_t* const sp = &lazy->spooler;
+    if (lazy->producer != NULL) {
+        const size_t size = (sp->offset < sp->size) ? smaller(sp->size - sp->offset, sp->mtu - 1U) : 0U;
+        CANARD_ASSERT(size <= TX_STREAM_CHUNK_SIZE);
+        if ((size > 0U) && !lazy->producer(self, user_context, sp->offset, size, lazy->chunk)) {
+            return NULL;
+        }
+        lazy->head = (canard_bytes_chain_t){ .bytes = { .size = size, .data = lazy->chunk }, .next = NULL };
+        sp->reader = (bytes_chain_reader_t){ .cursor = &lazy->head, .position = 0U };
+    }
+    tx_frame_t* const frame = tx_spooler_next(self, sp, NULL, prio, tx_lazy_gather(self, lazy));
+    if (frame == NULL) {
+        self->err.oom++;
+    }
+    return frame;
+}
+
+// Generates the next frame of a lazy transfer into the reserved queue slot and appends it after the last frame.
+// Unless zero-copy, the payload is released once the last frame is generated.
+// Returns false if there is no memory or queue space, or if the producer of a streamed transfer has no data yet.
+static bool tx_lazy_extend(canard_t* const self, tx_transfer_t* const tr, tx_frame_t* const last)
+{
+    CANARD_ASSERT(tx_lazy_pending(tr) && (last->next == NULL));
+    if (!tx_lazy_reserve(self, tr)) {
+        return false;
+    }
+    tx_lazy_t* const  lazy  = tr->lazy;
+    tx_frame_t* const frame = tx_lazy_next(self, lazy, tx_priority(tr), tr->user_context);
+    if (frame == NULL) {
+        return false;
+    }
+    tx_lazy_unreserve(self, tr); // The slot is taken over by the new frame.
+    // Every interface that has not finished the transfer is at or behind the last frame, so it needs the new one.
+    // The new frame starts with one reference, which belongs to the interface that requested it.
+    FOREACH_IFACE (i) {
+        if (tr->cursor[i] != NULL) {
+            frame->refcount++;
+        }
+    }
+    frame->refcount--;
+    last->next = frame;
+    if (tx_spooler_done(&lazy->spooler) && !lazy->zero_copy) {
+        tx_lazy_release(self, tr);
+    }
+    return true;
+}
+
+// Frees a transfer that could not be enqueued. The payload of a lazy transfer is not released; the caller keeps it.
+static void tx_push_abort(canard_t* const self, tx_transfer_t* const tr, tx_lazy_t* const lazy)
+{
+    if (lazy != NULL) {
+        tx_lazy_free(self, lazy);
+    }
+    tx_transfer_free(self, tr);
+}
+
+// Expires the stale transfers and makes room in the queue for a new transfer that needs the specified frame count.
+// Returns the effective interface bitmap, or zero if the transfer cannot be enqueued.
+static byte_t tx_admit(canard_t* const            self,
+                       const tx_transfer_t* const tr,
+                       const byte_t               iface_bitmap,
+                       const size_t               frames_needed)
+{
+    byte_t effective = iface_bitmap & (byte_t)self->iface_bitmap;
+    if (effective != 0) {
+        tx_expire(self, self->vtable->now(self)); // Expire old transfers first to free up queue space.
+        if (!tx_ensure_queue_space(self, tr, frames_needed)) {
+            self->err.tx_capacity++;
+            effective = 0;
+        }
+    }
+    return effective;
+}
+
+// Attaches the spool to the transfer on the effective interfaces and schedules the transfer for transmission.
+static void tx_enqueue(canard_t* const self, tx_transfer_t* const tr, const byte_t effective, tx_frame_t* const spool)
+{
+    CANARD_ASSERT((tr != NULL) && (effective != 0) && (spool != NULL));
+    // Adjust the spooled frame refcounts to avoid premature deallocation.
+    const byte_t frame_refcount_inc = (byte_t)(popcount(effective) - 1U);
+    CANARD_ASSERT(frame_refcount_inc < CANARD_IFACE_COUNT);
+    if (frame_refcount_inc > 0) {
+        tx_frame_t* frame = spool;
+        while (frame != NULL) {
+            frame->refcount += frame_refcount_inc;
+            frame = frame->next;
+        }
+    }
+
+    // Attach the spool.
     FOREACH_IFACE (i) {
         if ((effective & (1U << i)) != 0) {
             tr->cursor[i] = spool;
@@ -799,53 +2262,274 @@ static bool tx_push(canard_t* const            self,
     }
 
     // Register the transfer and schedule for transmission.
-    const canard_tree_t* const deadline_tree = cavl2_find_or_insert(
-      &self->tx.deadline, tr, tx_cavl_compare_deadline, &tr->index_deadline, cavl2_trivial_factory);
-    CANARD_ASSERT(deadline_tree == &tr->index_deadline);
-    (void)deadline_tree;
+#if CANARD_TX_TIMESTAMPS
+    if (self->vtable->tx_done != NULL) {
+        tr->enqueue_ts = self->vtable->now(self);
+    }
+#endif
+    tx_deadline_insert(self, tr);
     enlist_tail(&self->tx.agewise, &tr->list_agewise);
+    enlist_tail(&self->tx.agewise_by_prio[tx_priority(tr)], &tr->list_agewise_by_prio);
     tx_make_pending(self, tr);
+}
+
+// Enqueues a transfer for transmission. The payload size and the number of frames are supplied by the caller.
+// If the lazy state is given, only the first frame is generated now; the others are generated by tx_eject_pending().
+static bool tx_push_sized(canard_t* const            self,
+                          tx_transfer_t* const       tr,
+                          const bool                 v0,
+                          const byte_t               iface_bitmap,
+                          const byte_t               transfer_id,
+                          const canard_bytes_chain_t payload,
+                          const size_t               size,
+                          const size_t               n_frames,
+                          const uint16_t             crc_seed,
+                          tx_lazy_t* const           lazy)
+{
+    CANARD_ASSERT(tr != NULL);
+    CANARD_ASSERT((!tr->fd) || !v0); // The caller must ensure this.
+    CANARD_ASSERT(iface_bitmap != 0);
+    CANARD_ASSERT((lazy == NULL) || ((!v0) && (n_frames > 1U)));
+
+    // Ensure the queue has enough space. v0 transfers always use Classic CAN regardless of tr->fd.
+    const size_t mtu = tr->fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
+    CANARD_ASSERT(((lazy != NULL) && (lazy->producer != NULL)) || (size == bytes_chain_size(payload)));
+    CANARD_ASSERT(n_frames == tx_predict_frame_count(size, mtu));
+    tr->multi_frame = n_frames > 1U;
+    // A lazy transfer takes one slot for the first frame and one reserved for the next, see tx_lazy_reserve().
+    const size_t frames_needed = (lazy != NULL) ? 2U : n_frames;
+    const byte_t effective     = tx_admit(self, tr, iface_bitmap, frames_needed);
+    if (effective == 0) {
+        tx_push_abort(self, tr, lazy);
+        return false;
+    }
+
+    // Make a shared frame spool. Unlike the Cyphal/UDP implementation, we require all ifaces to use the same MTU.
+    const size_t queue_size_before = self->tx.queue_size;
+    const bool   legacy            = CANARD_ENABLE_V0 && v0; // Constant-folded if v0 is disabled at build time.
+    const byte_t prio              = tx_priority(tr);
+    tx_frame_t*  spool             = NULL;
+    if (lazy != NULL) {
+        lazy->head     = payload;
+        lazy->spooler  = tx_spooler_make(&lazy->head, size, mtu, crc_seed, transfer_id);
+        lazy->reserved = false;
+        spool          = tx_lazy_next(self, lazy, prio, tr->user_context);
+    } else {
+        spool = legacy ? tx_spool_v0(self, tr, prio, crc_seed, transfer_id, size, payload)
+                       : tx_spool(self, tr, prio, crc_seed, mtu, transfer_id, size, &payload);
+        if (spool == NULL) {
+            self->err.oom++;
+        }
+    }
+    if (spool == NULL) {
+        tx_push_abort(self, tr, lazy);
+        return false;
+    }
+    if (lazy != NULL) {
+        tr->lazy            = lazy;
+        const bool reserved = tx_lazy_reserve(self, tr);
+        CANARD_ASSERT(reserved); // The space has been ensured above.
+        (void)reserved;
+    }
+    CANARD_ASSERT((self->tx.queue_size - queue_size_before) == frames_needed);
+    CANARD_ASSERT(self->tx.queue_size <= self->tx.queue_capacity);
+    (void)queue_size_before;
+    tx_enqueue(self, tr, effective, spool);
     return true;
 }
 
-static tx_transfer_t* tx_pending_node_to_transfer(const canard_tree_t* const node, const byte_t iface_index)
+// Enqueues a transfer for transmission.
+static bool tx_push(canard_t* const            self,
+                    tx_transfer_t* const       tr,
+                    const bool                 v0,
+                    const byte_t               iface_bitmap,
+                    const byte_t               transfer_id,
+                    const canard_bytes_chain_t payload,
+                    const uint16_t             crc_seed)
 {
-    return (tx_transfer_t*)ptr_unbias(
-      node, offsetof(tx_transfer_t, index_pending) + (((size_t)iface_index) * sizeof(canard_tree_t)));
+    const size_t size = bytes_chain_size(payload);
+    const size_t mtu  = tr->fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
+    return tx_push_sized(
+      self, tr, v0, iface_bitmap, transfer_id, payload, size, tx_predict_frame_count(size, mtu), crc_seed, NULL);
 }
 
-static void tx_eject_pending(canard_t* const self, const byte_t iface_index)
+// The maximum number of fragments a gather frame is submitted in. A frame whose payload slice spans more fragments of
+// the application buffer is flattened into a temporary buffer instead, which keeps the stack usage bounded.
+#define TX_GATHER_FRAGMENTS 4U
+
+// Builds the fragment chain of a gather frame in the provided storage; the trailer is always the last fragment.
+static canard_bytes_chain_t tx_gather_fragments(const tx_frame_t* const frame,
+                                                canard_bytes_chain_t    fragments[TX_GATHER_FRAGMENTS],
+                                                byte_t                  flat[CANARD_MTU_CAN_FD])
 {
-    while (true) {
-        const canard_tree_t* const pending = cavl2_min(self->tx.pending[iface_index]);
-        if (pending == NULL) {
-            break;
+    const tx_gather_t* const gather     = tx_gather_of(frame);
+    const size_t             frame_size = canard_dlc_to_len[frame->dlc];
+    const canard_bytes_t     trailer    = { .size = frame_size - gather->slice_size, .data = frame->data };
+    bytes_chain_reader_t     reader     = gather->slice;
+    size_t                   remaining  = gather->slice_size;
+    size_t                   count      = 0U;
+    while ((remaining > 0U) && (count < (TX_GATHER_FRAGMENTS - 1U))) {
+        while (reader.position == reader.cursor->bytes.size) { // Skip the exhausted and empty fragments.
+            reader.position = 0U;
+            reader.cursor   = reader.cursor->next;
+            CANARD_ASSERT(reader.cursor != NULL);
         }
-        tx_transfer_t* const tr = tx_pending_node_to_transfer(pending, iface_index);
-        CANARD_ASSERT(tr->cursor[iface_index] != NULL);
+        const size_t progress  = smaller(remaining, reader.cursor->bytes.size - reader.position);
+        fragments[count].bytes = (canard_bytes_t){
+            .size = progress,
+            .data = ((const byte_t*)reader.cursor->bytes.data) + reader.position,
+        };
+        count++;
+        remaining -= progress;
+        reader.position += progress;
+    }
+    if (remaining > 0U) { // Too fragmented, copy the whole frame.
+        reader = gather->slice;
+        bytes_chain_read(&reader, gather->slice_size, flat);
+        // NOLINTNEXTLINE(*DeprecatedOrUnsafeBufferHandling)
+        (void)memcpy(&flat[gather->slice_size], trailer.data, trailer.size);
+        fragments[0].bytes = (canard_bytes_t){ .size = frame_size, .data = flat };
+        count              = 1U;
+    } else {
+        fragments[count].bytes = trailer;
+        count++;
+    }
+    for (size_t i = 0; i < count; i++) {
+        fragments[i].next = ((i + 1U) < count) ? &fragments[i + 1U] : NULL;
+    }
+    return fragments[0];
+}
+
+// The CAN ID of the frames of the transfer with the current local node-ID.
+static uint32_t tx_can_id(const canard_t* const self, const tx_transfer_t* const tr)
+{
+    // Clangd/Clang-Tidy bug: bitfield integer promotion rules are modeled incorrectly -- the cast is not redundant.
+    return ((uint32_t)tr->can_id_msb << 7U) | self->node_id; // NOLINT(*-readability-casting)
+}
+
+// Submits one frame via the driver. Returns true if the frame was accepted.
+static bool tx_submit(canard_t* const            self,
+                      const tx_transfer_t* const tr,
+                      const byte_t               iface_index,
+                      const tx_frame_t* const    frame)
+{
+    const uint32_t can_id = tx_can_id(self, tr);
+    const bool     fd     = tr->fd != 0U;
+    if (frame->gather != 0U) {
+        CANARD_ASSERT(self->vtable->tx_gather != NULL);
+        canard_bytes_chain_t       fragments[TX_GATHER_FRAGMENTS];
+        byte_t                     flat[CANARD_MTU_CAN_FD];
+        const canard_bytes_chain_t can_data = tx_gather_fragments(frame, fragments, flat);
+        return self->vtable->tx_gather(self, tr->user_context, tr->deadline, iface_index, fd, can_id, can_data);
+    }
+    return self->vtable->tx(self, tr->user_context, tr->deadline, iface_index, fd, can_id, tx_frame_view(frame));
+}
+
+// The transfer that follows the specified one in the transmission order of the interface, or NULL if none.
+static tx_transfer_t* tx_pending_next(const canard_t* const      self,
+                                      const tx_transfer_t* const tr,
+                                      const byte_t               iface_index)
+{
+    tx_transfer_t* out = tx_pending_member_to_transfer(tr->list_pending[iface_index].next, iface_index);
+    if (out == NULL) { // Continue with the head of the next nonempty priority level.
+        const unsigned bitmap = self->tx.pending_prio_bitmap[iface_index] & ~((2U << tx_priority(tr)) - 1U);
+        if (bitmap != 0U) {
+            const byte_t prio = popcount((bitmap & (~bitmap + 1U)) - 1U); // Index of the lowest set bit.
+            out               = tx_pending_member_to_transfer(self->tx.pending[iface_index][prio].head, iface_index);
+        }
+    }
+    return out;
+}
 
-        // Try to eject one frame.
-        const tx_frame_t* const frame      = tr->cursor[iface_index];
-        tx_frame_t* const       frame_next = frame->next;
-        // Clangd/Clang-Tidy bug: bitfield integer promotion rules are modeled incorrectly -- the cast is not redundant.
-        const uint32_t can_id  = ((uint32_t)tr->can_id_msb << 7U) | self->node_id; // NOLINT(*-readability-casting)
-        const bool     ejected = self->vtable->tx(
-          self, tr->user_context, tr->deadline, iface_index, tr->fd != 0U, can_id, tx_frame_view(frame));
-        if (!ejected) {
+// Commits the ejection of the current frame of the transfer by advancing the interface cursor.
+static void tx_eject_advance(canard_t* const self, tx_transfer_t* const tr, const byte_t iface_index)
+{
+    tx_frame_t* const frame      = tr->cursor[iface_index];
+    tx_frame_t* const frame_next = frame->next;
+#if CANARD_TX_TIMESTAMPS
+    if ((self->vtable->tx_done != NULL) && ((tr->first_frame_departed == 0U) || (frame_next == NULL))) {
+        const canard_us_t now = self->vtable->now(self);
+        tr->first_frame_ts    = (tr->first_frame_departed == 0U) ? now : tr->first_frame_ts;
+        tr->last_frame_ts     = (frame_next == NULL) ? now : tr->last_frame_ts;
+    }
+#endif
+    tr->first_frame_departed = 1U;
+    tr->cursor[iface_index]  = frame_next;
+    canard_refcount_dec(self, tx_frame_view(frame));
+    if (tx_lazy_pending(tr)) {
+        (void)tx_lazy_reserve(self, tr); // Take the slot just freed before a newcomer does.
+    }
+
+    // If this interface is done with the transfer, remove it from this pending queue.
+    if (frame_next == NULL) {
+        tr->iface_done |= (byte_t)(1U << iface_index);
+        tx_pending_remove(self, tr, iface_index);
+        if (!tx_is_pending(self, tr)) {
+            tx_retire(self, tr, canard_tx_outcome_completed);
+        }
+    }
+}
+
+// Collects the frames that are ready for transmission via the interface, in the transmission order, and submits them
+// via tx_batch(). Collection stops at a frame for tx_gather() or at a lazy frame that cannot be generated yet.
+// Returns true if all collected frames were accepted, so that the caller may continue.
+static bool tx_eject_batch(canard_t* const self, const byte_t iface_index)
+{
+    canard_tx_frame_t batch[CANARD_TX_BATCH_SIZE];
+    size_t            count = 0U;
+    tx_transfer_t*    tr    = tx_pending_first(self, iface_index);
+    tx_frame_t*       frame = tr->cursor[iface_index];
+    while ((count < CANARD_TX_BATCH_SIZE) && (frame != NULL) && (frame->gather == 0U)) {
+        if ((frame->next == NULL) && tx_lazy_pending(tr) && !tx_lazy_extend(self, tr, frame)) {
             break;
         }
+        batch[count++] = (canard_tx_frame_t){
+            .user_context    = tr->user_context,
+            .deadline        = tr->deadline,
+            .fd              = tr->fd != 0U,
+            .extended_can_id = tx_can_id(self, tr),
+            .can_data        = tx_frame_view(frame),
+        };
+        frame = frame->next;
+        if (frame == NULL) {
+            tr    = tx_pending_next(self, tr, iface_index);
+            frame = (tr != NULL) ? tr->cursor[iface_index] : NULL;
+        }
+    }
+    size_t accepted = 0U;
+    if (count > 0U) {
+        accepted = self->vtable->tx_batch(self, iface_index, batch, count);
+        CANARD_ASSERT(accepted <= count);
+        accepted = smaller(accepted, count);
+    }
+    // The accepted frames are at the front of the transmission order, which does not change while advancing.
+    for (size_t i = 0U; i < accepted; i++) {
+        tx_eject_advance(self, tx_pending_first(self, iface_index), iface_index);
+    }
+    return (count > 0U) && (accepted == count);
+}
 
-        // Commit successful ejection by advancing this interface cursor.
-        tr->first_frame_departed = 1U;
-        tr->cursor[iface_index]  = frame_next;
-        canard_refcount_dec(self, tx_frame_view(frame));
+static void tx_eject_pending(canard_t* const self, const byte_t iface_index)
+{
+    bool progress = true;
+    while (progress) {
+        tx_transfer_t* const tr = tx_pending_first(self, iface_index);
+        if (tr == NULL) {
+            break;
+        }
+        CANARD_ASSERT(tr->cursor[iface_index] != NULL);
+        tx_frame_t* const frame = tr->cursor[iface_index];
+        if ((self->vtable->tx_batch != NULL) && (frame->gather == 0U)) {
+            progress = tx_eject_batch(self, iface_index);
+            continue;
+        }
 
-        // If this interface is done with the transfer, remove it from this pending tree.
-        if (frame_next == NULL) {
-            (void)cavl2_remove_if(&self->tx.pending[iface_index], &tr->index_pending[iface_index]);
-            if (!tx_is_pending(self, tr)) {
-                tx_retire(self, tr);
-            }
+        // Try to eject one frame. The next frame of a lazy transfer is generated first so that the cursor can advance.
+        // If that fails due to lack of memory or queue space, try again later.
+        progress = !((frame->next == NULL) && tx_lazy_pending(tr) && !tx_lazy_extend(self, tr, frame)) &&
+                   tx_submit(self, tr, iface_index, frame);
+        if (progress) {
+            tx_eject_advance(self, tr, iface_index);
         }
     }
 }
@@ -861,7 +2545,7 @@ static void tx_purge_continuations(canard_t* const self)
     while (tr != NULL) {
         tx_transfer_t* const next = LIST_NEXT(tr, tx_transfer_t, list_agewise);
         if ((tr->multi_frame != 0U) && (tr->first_frame_departed != 0U)) {
-            tx_retire(self, tr);
+            tx_retire(self, tr, canard_tx_outcome_canceled);
         }
         tr = next;
     }
@@ -872,12 +2556,180 @@ uint_least8_t canard_pending_ifaces(const canard_t* const self)
     uint_least8_t out = 0;
     if (self != NULL) {
         FOREACH_IFACE (i) {
-            out |= (self->tx.pending[i] != NULL) ? (uint_least8_t)(1U << i) : 0U;
+            if (self->tx.pending_prio_bitmap[i] != 0U) {
+                out = (uint_least8_t)(out | (1U << i));
+            }
         }
     }
     return out;
 }
 
+static bool tx_iface_bitmap_valid(const uint_least8_t iface_bitmap)
+{
+    return ((iface_bitmap & CANARD_IFACE_BITMAP_ALL) != 0) &&
+           ((iface_bitmap & CANARD_IFACE_BITMAP_ALL) == iface_bitmap);
+}
+
+// v1.1 16-bit message format extends the subject-ID to 16 bits, using bit 7 as 1 to discriminate from v1.0,
+// and designating the anonymous bit as reserved=0. ID bit layout:
+//
+//  28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10  9  8  7  6  5  4  3  2  1  0
+// |prio[3] |sv| 0|                  subject_id[16]               | 1|  source_node_id[7] |
+//
+// In DSDL notation:
+//
+//  uint7  source_node_id
+//  bool   reserved_7          # =1, version discrimination
+//  uint16 subject_id
+//  bool   reserved_24         # =0, was anonymous
+//  bool   service_not_message # =0
+//  uint3  priority
+static uint32_t tx_can_id_16b(const canard_prio_t priority, const uint16_t subject_id)
+{
+    return (((uint32_t)priority) << PRIO_SHIFT) | ((uint32_t)subject_id << 8U) | (UINT32_C(1) << 7U);
+}
+
+static uint32_t tx_can_id_13b(const canard_prio_t priority, const uint16_t subject_id)
+{
+    return (((uint32_t)priority) << PRIO_SHIFT) | (UINT32_C(3) << 21U) | (((uint32_t)subject_id) << 8U);
+}
+
+static uint32_t tx_can_id_v0(const canard_prio_t priority, const uint16_t data_type_id)
+{
+    return (((uint32_t)priority) << PRIO_SHIFT) | ((uint32_t)data_type_id << 8U);
+}
+
+// How the payload of a published transfer is handled; a single-frame payload is always copied and released at once.
+#define TX_PAYLOAD_COPY      0U // Spooled entirely at enqueue time.
+#define TX_PAYLOAD_LAZY      1U // Referenced until the last frame is generated, see canard_publish_16b_lazy().
+#define TX_PAYLOAD_ZERO_COPY 2U // Referenced until the transfer is retired, see canard_publish_16b_zero_copy().
+
+// Enqueues a new transfer, or recycles an enqueued one of the same CAN ID if latest-value-wins is requested.
+static bool tx_publish(canard_t* const            self,
+                       const canard_us_t          deadline,
+                       const uint_least8_t        iface_bitmap,
+                       const uint32_t             can_id,
+                       const uint_least8_t        transfer_id,
+                       const canard_bytes_chain_t payload,
+                       void* const                user_context,
+                       const bool                 latest,
+                       const byte_t               payload_mode,
+                       const canard_tx_release_t  release)
+{
+    const size_t size     = bytes_chain_size(payload);
+    const size_t n_frames = tx_predict_frame_count(size, self->tx.fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC);
+    tx_lazy_t*   state    = NULL;
+    if ((payload_mode != TX_PAYLOAD_COPY) && (n_frames > 1U)) {
+        state = (tx_lazy_t*)mem_alloc(self->mem.tx_frame, tx_lazy_alloc_size(false));
+        if (state == NULL) {
+            self->err.oom++;
+            return false;
+        }
+        state->release   = release;
+        state->producer  = NULL;
+        state->zero_copy = payload_mode == TX_PAYLOAD_ZERO_COPY;
+    }
+    tx_transfer_t* tr = latest ? tx_coalesce(self, deadline, can_id, iface_bitmap, user_context) : NULL;
+    if (tr == NULL) {
+        tr = tx_transfer_new(self, deadline, can_id, self->tx.fd, user_context);
+    }
+    if ((tr == NULL) && (state != NULL)) {
+        tx_lazy_free(self, state);
+    }
+    const bool ok =
+      (tr != NULL) &&
+      tx_push_sized(self, tr, false, iface_bitmap, transfer_id, payload, size, n_frames, CRC_INITIAL, state);
+    if (ok && (payload_mode != TX_PAYLOAD_COPY) && (state == NULL) && (release != NULL)) {
+        release(self, user_context); // A single-frame transfer is spooled at once.
+    }
+    return ok;
+}
+
+// Enqueues a transfer whose payload is pulled from the producer one frame at a time, see tx_lazy_next().
+static bool tx_publish_stream(canard_t* const            self,
+                              const canard_us_t          deadline,
+                              const uint_least8_t        iface_bitmap,
+                              const uint32_t             can_id,
+                              const uint_least8_t        transfer_id,
+                              const size_t               size,
+                              const canard_tx_producer_t producer,
+                              const canard_tx_release_t  release,
+                              void* const                user_context)
+{
+    const size_t n_frames = tx_predict_frame_count(size, self->tx.fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC);
+    if (n_frames == 1U) { // Pulled at once and published like a single-frame lazy transfer.
+        byte_t chunk[TX_STREAM_CHUNK_SIZE];
+        CANARD_ASSERT(size <= sizeof(chunk));
+        if ((size > 0U) && !producer(self, user_context, 0U, size, chunk)) {
+            return false;
+        }
+        const canard_bytes_chain_t payload = { .bytes = { .size = size, .data = chunk }, .next = NULL };
+        return tx_publish(
+          self, deadline, iface_bitmap, can_id, transfer_id, payload, user_context, false, TX_PAYLOAD_LAZY, release);
+    }
+    tx_lazy_t* const state = (tx_lazy_t*)mem_alloc(self->mem.tx_frame, tx_lazy_alloc_size(true));
+    if (state == NULL) {
+        self->err.oom++;
+        return false;
+    }
+    state->release   = release;
+    state->producer  = producer;
+    state->zero_copy = false;
+
+    tx_transfer_t* const tr = tx_transfer_new(self, deadline, can_id, self->tx.fd, user_context);
+    if (tr == NULL) {
+        tx_lazy_free(self, state);
+        return false;
+    }
+    const canard_bytes_chain_t none = { .bytes = { .size = 0U, .data = NULL }, .next = NULL };
+    return tx_push_sized(self, tr, false, iface_bitmap, transfer_id, none, size, n_frames, CRC_INITIAL, state);
+}
+
+static bool tx_publish_16b(canard_t* const            self,
+                           const canard_us_t          deadline,
+                           const uint_least8_t        iface_bitmap,
+                           const canard_prio_t        priority,
+                           const uint16_t             subject_id,
+                           const uint_least8_t        transfer_id,
+                           const canard_bytes_chain_t payload,
+                           void* const                user_context,
+                           const bool                 latest,
+                           const byte_t               payload_mode,
+                           const canard_tx_release_t  release)
+{
+    bool ok = (self != NULL) && protocol_enabled(self, 1) && (priority < CANARD_PRIO_COUNT) &&
+              bytes_chain_valid(payload) && tx_iface_bitmap_valid(iface_bitmap);
+    if (ok) {
+        const uint32_t can_id = tx_can_id_16b(priority, subject_id);
+        ok                    = tx_publish(
+          self, deadline, iface_bitmap, can_id, transfer_id, payload, user_context, latest, payload_mode, release);
+    }
+    return ok;
+}
+
+static bool tx_publish_13b(canard_t* const            self,
+                           const canard_us_t          deadline,
+                           const uint_least8_t        iface_bitmap,
+                           const canard_prio_t        priority,
+                           const uint16_t             subject_id,
+                           const uint_least8_t        transfer_id,
+                           const canard_bytes_chain_t payload,
+                           void* const                user_context,
+                           const bool                 latest,
+                           const byte_t               payload_mode,
+                           const canard_tx_release_t  release)
+{
+    bool ok = (self != NULL) && protocol_enabled(self, 1) && (priority < CANARD_PRIO_COUNT) &&
+              bytes_chain_valid(payload) && tx_iface_bitmap_valid(iface_bitmap) &&
+              (subject_id <= CANARD_SUBJECT_ID_MAX_13b);
+    if (ok) {
+        const uint32_t can_id = tx_can_id_13b(priority, subject_id);
+        ok                    = tx_publish(
+          self, deadline, iface_bitmap, can_id, transfer_id, payload, user_context, latest, payload_mode, release);
+    }
+    return ok;
+}
+
 bool canard_publish_16b(canard_t* const            self,
                         const canard_us_t          deadline,
                         const uint_least8_t        iface_bitmap,
@@ -887,30 +2739,17 @@ bool canard_publish_16b(canard_t* const            self,
                         const canard_bytes_chain_t payload,
                         void* const                user_context)
 {
-    bool ok =
-      (self != NULL) && (priority < CANARD_PRIO_COUNT) && bytes_chain_valid(payload) &&
-      (((iface_bitmap & CANARD_IFACE_BITMAP_ALL) != 0) && ((iface_bitmap & CANARD_IFACE_BITMAP_ALL) == iface_bitmap));
-    if (ok) {
-        // v1.1 16-bit message format extends the subject-ID to 16 bits, using bit 7 as 1 to discriminate from v1.0,
-        // and designating the anonymous bit as reserved=0. ID bit layout:
-        //
-        //  28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10  9  8  7  6  5  4  3  2  1  0
-        // |prio[3] |sv| 0|                  subject_id[16]               | 1|  source_node_id[7] |
-        //
-        // In DSDL notation:
-        //
-        //  uint7  source_node_id
-        //  bool   reserved_7          # =1, version discrimination
-        //  uint16 subject_id
-        //  bool   reserved_24         # =0, was anonymous
-        //  bool   service_not_message # =0
-        //  uint3  priority
-        const uint32_t can_id =
-          (((uint32_t)priority) << PRIO_SHIFT) | ((uint32_t)subject_id << 8U) | (UINT32_C(1) << 7U);
-        tx_transfer_t* const tr = tx_transfer_new(self, deadline, can_id, self->tx.fd, user_context);
-        ok = (tr != NULL) && tx_push(self, tr, false, iface_bitmap, transfer_id, payload, CRC_INITIAL);
-    }
-    return ok;
+    return tx_publish_16b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_COPY,
+                          NULL);
 }
 
 bool canard_publish_13b(canard_t* const            self,
@@ -922,17 +2761,364 @@ bool canard_publish_13b(canard_t* const            self,
                         const canard_bytes_chain_t payload,
                         void* const                user_context)
 {
-    bool ok =
-      (self != NULL) && (priority < CANARD_PRIO_COUNT) && bytes_chain_valid(payload) &&
-      (((iface_bitmap & CANARD_IFACE_BITMAP_ALL) != 0) && ((iface_bitmap & CANARD_IFACE_BITMAP_ALL) == iface_bitmap)) &&
-      (subject_id <= CANARD_SUBJECT_ID_MAX_13b);
-    if (ok) {
-        const uint32_t can_id =
-          (((uint32_t)priority) << PRIO_SHIFT) | (UINT32_C(3) << 21U) | (((uint32_t)subject_id) << 8U);
-        tx_transfer_t* const tr = tx_transfer_new(self, deadline, can_id, self->tx.fd, user_context);
-        ok = (tr != NULL) && tx_push(self, tr, false, iface_bitmap, transfer_id, payload, CRC_INITIAL);
+    return tx_publish_13b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_COPY,
+                          NULL);
+}
+
+bool canard_publish_16b_latest(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const canard_bytes_chain_t payload,
+                               void* const                user_context)
+{
+    return tx_publish_16b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          true,
+                          TX_PAYLOAD_COPY,
+                          NULL);
+}
+
+bool canard_publish_13b_latest(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const canard_bytes_chain_t payload,
+                               void* const                user_context)
+{
+    return tx_publish_13b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          true,
+                          TX_PAYLOAD_COPY,
+                          NULL);
+}
+
+bool canard_publish_16b_lazy(canard_t* const            self,
+                             const canard_us_t          deadline,
+                             const uint_least8_t        iface_bitmap,
+                             const canard_prio_t        priority,
+                             const uint16_t             subject_id,
+                             const uint_least8_t        transfer_id,
+                             const canard_bytes_chain_t payload,
+                             const canard_tx_release_t  release,
+                             void* const                user_context)
+{
+    return tx_publish_16b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_LAZY,
+                          release);
+}
+
+bool canard_publish_13b_lazy(canard_t* const            self,
+                             const canard_us_t          deadline,
+                             const uint_least8_t        iface_bitmap,
+                             const canard_prio_t        priority,
+                             const uint16_t             subject_id,
+                             const uint_least8_t        transfer_id,
+                             const canard_bytes_chain_t payload,
+                             const canard_tx_release_t  release,
+                             void* const                user_context)
+{
+    return tx_publish_13b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_LAZY,
+                          release);
+}
+
+bool canard_publish_16b_zero_copy(canard_t* const            self,
+                                  const canard_us_t          deadline,
+                                  const uint_least8_t        iface_bitmap,
+                                  const canard_prio_t        priority,
+                                  const uint16_t             subject_id,
+                                  const uint_least8_t        transfer_id,
+                                  const canard_bytes_chain_t payload,
+                                  const canard_tx_release_t  release,
+                                  void* const                user_context)
+{
+    return tx_publish_16b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_ZERO_COPY,
+                          release);
+}
+
+bool canard_publish_13b_zero_copy(canard_t* const            self,
+                                  const canard_us_t          deadline,
+                                  const uint_least8_t        iface_bitmap,
+                                  const canard_prio_t        priority,
+                                  const uint16_t             subject_id,
+                                  const uint_least8_t        transfer_id,
+                                  const canard_bytes_chain_t payload,
+                                  const canard_tx_release_t  release,
+                                  void* const                user_context)
+{
+    return tx_publish_13b(self,
+                          deadline,
+                          iface_bitmap,
+                          priority,
+                          subject_id,
+                          transfer_id,
+                          payload,
+                          user_context,
+                          false,
+                          TX_PAYLOAD_ZERO_COPY,
+                          release);
+}
+
+bool canard_publish_16b_stream(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const size_t               payload_size,
+                               const canard_tx_producer_t producer,
+                               const canard_tx_release_t  release,
+                               void* const                user_context)
+{
+    const bool ok = (self != NULL) && protocol_enabled(self, 1) && (priority < CANARD_PRIO_COUNT) &&
+                    (producer != NULL) && tx_iface_bitmap_valid(iface_bitmap);
+    return ok && tx_publish_stream(self,
+                                   deadline,
+                                   iface_bitmap,
+                                   tx_can_id_16b(priority, subject_id),
+                                   transfer_id,
+                                   payload_size,
+                                   producer,
+                                   release,
+                                   user_context);
+}
+
+bool canard_publish_13b_stream(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const size_t               payload_size,
+                               const canard_tx_producer_t producer,
+                               const canard_tx_release_t  release,
+                               void* const                user_context)
+{
+    const bool ok = (self != NULL) && protocol_enabled(self, 1) && (priority < CANARD_PRIO_COUNT) &&
+                    (producer != NULL) && tx_iface_bitmap_valid(iface_bitmap) &&
+                    (subject_id <= CANARD_SUBJECT_ID_MAX_13b);
+    return ok && tx_publish_stream(self,
+                                   deadline,
+                                   iface_bitmap,
+                                   tx_can_id_13b(priority, subject_id),
+                                   transfer_id,
+                                   payload_size,
+                                   producer,
+                                   release,
+                                   user_context);
+}
+
+// The payload region of a reserved frame whose payload starts at the specified offset; empty past the payload end.
+static canard_bytes_mut_t tx_reservation_span(tx_frame_t* const frame, const size_t offset, const size_t size)
+{
+    canard_bytes_mut_t out = { .size = 0U, .data = NULL };
+    if ((frame != NULL) && (offset < size)) {
+        out.size = smaller(size - offset, canard_dlc_to_len[frame->dlc] - 1U);
+        out.data = frame->data;
+    }
+    return out;
+}
+
+// Computes the CRC of a multi-frame transfer whose payload has been written in place and stores it. The frame bytes
+// between the end of the payload and the tail bytes are the padding written by the spooler followed by the CRC,
+// which may straddle the last two frames; hence, the last two of these bytes are tracked during the traversal.
+static void tx_reservation_seal(tx_frame_t* const spool, const size_t size)
+{
+    uint16_t crc                = CRC_INITIAL;
+    size_t   offset             = 0U;
+    byte_t*  trailer[CRC_BYTES] = { NULL, NULL };
+    for (tx_frame_t* frame = spool; frame != NULL; frame = frame->next) {
+        const size_t capacity = canard_dlc_to_len[frame->dlc] - 1U;
+        const size_t progress = smaller(size - offset, capacity);
+        crc                   = crc_add(crc, progress, frame->data);
+        offset += progress;
+        for (size_t i = progress; i < capacity; i++) {
+            if (trailer[0] != NULL) {
+                crc = crc_add_byte(crc, *trailer[0]); // Padding.
+            }
+            trailer[0] = trailer[1];
+            trailer[1] = &frame->data[i];
+        }
+    }
+    CANARD_ASSERT((offset == size) && (trailer[0] != NULL) && (trailer[1] != NULL));
+    *trailer[0] = (byte_t)((crc >> 8U) & BYTE_MAX); // NOLINT(*-signed-bitwise)
+    *trailer[1] = (byte_t)(crc & BYTE_MAX);
+}
+
+// Spools the frames of a new transfer without the payload, which is written in place by the application later.
+static bool tx_reserve(canard_t* const                self,
+                       canard_tx_reservation_t* const reservation,
+                       const canard_us_t              deadline,
+                       const uint_least8_t            iface_bitmap,
+                       const uint32_t                 can_id,
+                       const uint_least8_t            transfer_id,
+                       const size_t                   size,
+                       void* const                    user_context)
+{
+    const size_t         mtu = self->tx.fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
+    const size_t         n   = tx_predict_frame_count(size, mtu);
+    tx_transfer_t* const tr  = tx_transfer_new(self, deadline, can_id, self->tx.fd, user_context);
+    if (tr == NULL) {
+        return false;
+    }
+    tr->multi_frame        = n > 1U;
+    const byte_t effective = tx_admit(self, tr, iface_bitmap, n);
+    tx_frame_t*  spool     = NULL;
+    if (effective != 0) {
+        spool = tx_spool(self, tr, tx_priority(tr), CRC_INITIAL, mtu, transfer_id, size, NULL);
+        if (spool == NULL) {
+            self->err.oom++;
+        }
+    }
+    if (spool == NULL) {
+        tx_transfer_free(self, tr);
+        return false;
+    }
+    reservation->span         = tx_reservation_span(spool, 0U, size);
+    reservation->offset       = 0U;
+    reservation->size         = size;
+    reservation->transfer     = tr;
+    reservation->spool        = spool;
+    reservation->frame        = spool;
+    reservation->iface_bitmap = effective;
+    return true;
+}
+
+bool canard_reserve_16b(canard_t* const                self,
+                        canard_tx_reservation_t* const reservation,
+                        const canard_us_t              deadline,
+                        const uint_least8_t            iface_bitmap,
+                        const canard_prio_t            priority,
+                        const uint16_t                 subject_id,
+                        const uint_least8_t            transfer_id,
+                        const size_t                   payload_size,
+                        void* const                    user_context)
+{
+    const bool ok = (self != NULL) && (reservation != NULL) && protocol_enabled(self, 1) &&
+                    (priority < CANARD_PRIO_COUNT) && tx_iface_bitmap_valid(iface_bitmap);
+    return ok && tx_reserve(self,
+                            reservation,
+                            deadline,
+                            iface_bitmap,
+                            tx_can_id_16b(priority, subject_id),
+                            transfer_id,
+                            payload_size,
+                            user_context);
+}
+
+bool canard_reserve_13b(canard_t* const                self,
+                        canard_tx_reservation_t* const reservation,
+                        const canard_us_t              deadline,
+                        const uint_least8_t            iface_bitmap,
+                        const canard_prio_t            priority,
+                        const uint16_t                 subject_id,
+                        const uint_least8_t            transfer_id,
+                        const size_t                   payload_size,
+                        void* const                    user_context)
+{
+    const bool ok = (self != NULL) && (reservation != NULL) && protocol_enabled(self, 1) &&
+                    (priority < CANARD_PRIO_COUNT) && tx_iface_bitmap_valid(iface_bitmap) &&
+                    (subject_id <= CANARD_SUBJECT_ID_MAX_13b);
+    return ok && tx_reserve(self,
+                            reservation,
+                            deadline,
+                            iface_bitmap,
+                            tx_can_id_13b(priority, subject_id),
+                            transfer_id,
+                            payload_size,
+                            user_context);
+}
+
+bool canard_reservation_next(canard_tx_reservation_t* const self)
+{
+    bool ok = false;
+    if ((self != NULL) && (self->frame != NULL)) {
+        tx_frame_t* const frame = ((tx_frame_t*)self->frame)->next;
+        self->offset += self->span.size;
+        self->frame = frame;
+        self->span  = tx_reservation_span(frame, self->offset, self->size);
+        ok          = self->span.size > 0U;
+    }
+    return ok;
+}
+
+void canard_reservation_commit(canard_t* const self, canard_tx_reservation_t* const reservation)
+{
+    if ((self != NULL) && (reservation != NULL) && (reservation->transfer != NULL)) {
+        tx_transfer_t* const tr    = (tx_transfer_t*)reservation->transfer;
+        tx_frame_t* const    spool = (tx_frame_t*)reservation->spool;
+        if (tr->multi_frame != 0U) {
+            tx_reservation_seal(spool, reservation->size);
+        }
+        tr->seqno = self->tx.seqno++; // Queued after the transfers enqueued before the commit.
+        tx_enqueue(self, tr, (byte_t)reservation->iface_bitmap, spool);
+        (void)memset(reservation, 0, sizeof(*reservation));
+    }
+}
+
+void canard_reservation_cancel(canard_t* const self, canard_tx_reservation_t* const reservation)
+{
+    if ((self != NULL) && (reservation != NULL) && (reservation->transfer != NULL)) {
+        tx_frame_t* frame = (tx_frame_t*)reservation->spool;
+        while (frame != NULL) {
+            tx_frame_t* const next = frame->next;
+            canard_refcount_dec(self, tx_frame_view(frame));
+            frame = next;
+        }
+        tx_transfer_free(self, (tx_transfer_t*)reservation->transfer);
+        (void)memset(reservation, 0, sizeof(*reservation));
     }
-    return ok;
 }
 
 static bool tx_1v0_service(canard_t* const            self,
@@ -945,8 +3131,9 @@ static bool tx_1v0_service(canard_t* const            self,
                            const canard_bytes_chain_t payload,
                            void* const                user_context)
 {
-    bool ok = (self != NULL) && (priority < CANARD_PRIO_COUNT) && bytes_chain_valid(payload) &&
-              (service_id <= CANARD_SERVICE_ID_MAX) && (destination_node_id <= CANARD_NODE_ID_MAX);
+    bool ok = (self != NULL) && protocol_enabled(self, 1) && (priority < CANARD_PRIO_COUNT) &&
+              bytes_chain_valid(payload) && (service_id <= CANARD_SERVICE_ID_MAX) &&
+              (destination_node_id <= CANARD_NODE_ID_MAX);
     if (ok) {
         const uint32_t can_id = (((uint32_t)priority) << PRIO_SHIFT) | (UINT32_C(1) << 25U) |
                                 (request_not_response ? (UINT32_C(1) << 24U) : 0U) | (((uint32_t)service_id) << 14U) |
@@ -993,12 +3180,10 @@ bool canard_v0_publish(canard_t* const            self,
                        const canard_bytes_chain_t payload,
                        void* const                user_context)
 {
-    bool ok =
-      (self != NULL) && (priority < CANARD_PRIO_COUNT) && bytes_chain_valid(payload) &&
-      (((iface_bitmap & CANARD_IFACE_BITMAP_ALL) != 0) && ((iface_bitmap & CANARD_IFACE_BITMAP_ALL) == iface_bitmap)) &&
-      (self->node_id != 0);
+    bool ok = (self != NULL) && protocol_enabled(self, 0) && (priority < CANARD_PRIO_COUNT) &&
+              bytes_chain_valid(payload) && tx_iface_bitmap_valid(iface_bitmap) && (self->node_id != 0);
     if (ok) {
-        const uint32_t       can_id = (((uint32_t)priority) << PRIO_SHIFT) | ((uint32_t)data_type_id << 8U);
+        const uint32_t       can_id = tx_can_id_v0(priority, data_type_id);
         tx_transfer_t* const tr     = tx_transfer_new(self, deadline, can_id, false, user_context);
         ok = (tr != NULL) && tx_push(self, tr, true, iface_bitmap, transfer_id, payload, crc_seed);
     }
@@ -1016,8 +3201,9 @@ static bool tx_v0_service(canard_t* const            self,
                           const canard_bytes_chain_t payload,
                           void* const                user_context)
 {
-    bool ok = (self != NULL) && (priority < CANARD_PRIO_COUNT) && bytes_chain_valid(payload) && (self->node_id != 0U) &&
-              (destination_node_id > 0U) && (destination_node_id <= CANARD_NODE_ID_MAX);
+    bool ok = (self != NULL) && protocol_enabled(self, 0) && (priority < CANARD_PRIO_COUNT) &&
+              bytes_chain_valid(payload) && (self->node_id != 0U) && (destination_node_id > 0U) &&
+              (destination_node_id <= CANARD_NODE_ID_MAX);
     if (ok) {
         const uint32_t can_id = (((uint32_t)priority) << PRIO_SHIFT) | (((uint32_t)data_type_id) << 16U) |
                                 (request_not_response ? (UINT32_C(1) << 15U) : 0U) |
@@ -1074,21 +3260,97 @@ typedef struct
     bool end;
     bool toggle;
 
-    canard_bytes_t payload;
+    canard_bytes_t     payload;
+    canard_rx_buffer_t buffer; // The buffer holding the payload, if retainable.
 } frame_t;
 
+#define RX_ROUTE_KEY_OCCUPIED 1U // Distinguishes occupied route cache entries from empty ones.
+#define RX_ROUTE_KEY_SRC_ZERO 2U // Set if the source node-ID is zero, which changes the meaning of v0 CAN IDs.
+
+// The route key retains all CAN ID bits that affect the parsing except the source node-ID, which only matters
+// in so far as whether it is zero. The priority is dropped because it does not affect the routing.
+static uint32_t rx_route_key(const uint32_t can_id)
+{
+    const uint32_t src_zero = ((can_id & CANARD_NODE_ID_MAX) == 0U) ? RX_ROUTE_KEY_SRC_ZERO : 0U;
+    return (can_id & ((UINT32_C(1) << PRIO_SHIFT) - 1U) & ~(uint32_t)CANARD_NODE_ID_MAX) | src_zero |
+           RX_ROUTE_KEY_OCCUPIED;
+}
+
+// Parses the part of the CAN ID that does not depend on the priority and the source node-ID for both versions.
+// The subscriptions are not resolved here. The outcome is only a function of the route key.
+static void rx_parse_can_id(const uint32_t can_id, canard_rx_route_t* const out)
+{
+    CANARD_ASSERT(can_id <= CAN_EXT_ID_MASK);
+    CANARD_ASSERT(out != NULL);
+    memset(out, 0, sizeof(*out));
+    out->key = rx_route_key(can_id);
+
+    const bool bit_7  = (can_id & (UINT32_C(1) << 7U)) != 0U;
+    const bool bit_23 = (can_id & (UINT32_C(1) << 23U)) != 0U;
+    const bool bit_24 = (can_id & (UINT32_C(1) << 24U)) != 0U;
+
+    // The versions disabled at build time are left invalid, which removes them from the rest of the RX pipeline.
+    // Cyphal v1.
+    if (CANARD_ENABLE_V1) {
+        if ((can_id & (UINT32_C(1) << 25U)) != 0U) {
+            out->version[1].dst     = (byte_t)((can_id >> 7U) & CANARD_NODE_ID_MAX);
+            out->version[1].port_id = (can_id >> 14U) & CANARD_SERVICE_ID_MAX;
+            out->version[1].kind    = bit_24 ? canard_kind_request : canard_kind_response;
+            out->version[1].valid   = !bit_23;
+        } else {
+            out->version[1].dst = CANARD_NODE_ID_ANONYMOUS;
+            if (bit_7) {
+                out->version[1].port_id = (can_id >> 8U) & CANARD_SUBJECT_ID_MAX;
+                out->version[1].kind    = canard_kind_message_16b;
+                out->version[1].valid   = !bit_24; // was anonymous
+            } else {
+                out->version[1].port_id   = (can_id >> 8U) & CANARD_SUBJECT_ID_MAX_13b;
+                out->version[1].kind      = canard_kind_message_13b;
+                out->version[1].anonymous = bit_24;
+                out->version[1].valid     = !bit_23;
+            }
+        }
+    }
+
+    // UAVCAN v0.
+    if (CANARD_ENABLE_V0) {
+        const bool src_zero = (can_id & CANARD_NODE_ID_MAX) == 0U;
+        if (bit_7) {
+            const byte_t dst        = (byte_t)((can_id >> 8U) & CANARD_NODE_ID_MAX);
+            const bool   req        = (can_id & (UINT32_C(1) << 15U)) != 0U;
+            out->version[0].dst     = dst;
+            out->version[0].port_id = (can_id >> 16U) & 0xFFU;
+            out->version[0].kind    = req ? canard_kind_v0_request : canard_kind_v0_response;
+            // Node-ID 0 reserved for anonymous/broadcast, invalid for services.
+            out->version[0].valid = (dst != 0) && !src_zero;
+        } else {
+            out->version[0].dst       = CANARD_NODE_ID_ANONYMOUS;
+            out->version[0].kind      = canard_kind_v0_message;
+            out->version[0].anonymous = src_zero;
+            // Anonymous messages carry only the 2 low bits of the data type ID.
+            out->version[0].port_id = (uint16_t)((can_id >> 8U) & (src_zero ? 0x3U : 0xFFFFU));
+            out->version[0].valid   = true;
+        }
+    }
+}
+
 // The protocol version is only unambiguously detectable in the first frame of a transfer.
 // In non-first frames, we attempt to parse the frame as both versions simultaneously and then let the caller
 // decide which one is correct by checking for incomplete multi-frame reassembly states.
 // The return value is a bitmask indicating which of the versions have been parsed at this level.
 // This function admits v0 frames with MTU>8 even though this is not compliant with the v0 specification;
 // there are a few non-compliant implementations out there that use this and there is value in liberal acceptance.
-static byte_t rx_parse(const uint32_t       can_id,
-                       const canard_bytes_t payload_raw,
-                       frame_t* const       out_v0,
-                       frame_t* const       out_v1)
+// The route shall be obtained from rx_parse_can_id() for the same CAN ID; its subscriptions are not used here.
+// Only the versions in the protocols bitmap (CANARD_PROTOCOL_*) are considered if enabled at build time.
+static byte_t rx_parse_frame(const uint32_t                 can_id,
+                             const canard_bytes_t           payload_raw,
+                             const canard_rx_route_t* const route,
+                             const byte_t                   protocols,
+                             frame_t* const                 out_v0,
+                             frame_t* const                 out_v1)
 {
     CANARD_ASSERT(can_id <= CAN_EXT_ID_MASK);
+    CANARD_ASSERT((route != NULL) && (route->key == rx_route_key(can_id)));
     CANARD_ASSERT(out_v0 != NULL);
     CANARD_ASSERT(out_v1 != NULL);
     memset(out_v0, 0, sizeof(*out_v0));
@@ -1115,74 +3377,36 @@ static byte_t rx_parse(const uint32_t       can_id,
                             ((start && end) || (payload.size > 0));                  // multi-frame cannot be empty
 
     // Version detection: v1 requires the toggle to start from 1, v0 starts from 0.
-    // If this is not the first frame of a transfer, the version is not detectable, so we attempt to parse both.
-    bool is_v1 = !(start && !toggle) && payload_ok;
-    bool is_v0 = !(start && toggle) && payload_ok;
-    if (is_v1) {
-        out_v1->priority    = priority;
-        out_v1->src         = src;
-        out_v1->transfer_id = transfer_id;
-        out_v1->start       = start;
-        out_v1->end         = end;
-        out_v1->toggle      = toggle;
-        out_v1->payload     = payload;
-        const bool svc      = (can_id & (UINT32_C(1) << 25U)) != 0U;
-        const bool bit_23   = (can_id & (UINT32_C(1) << 23U)) != 0U;
-        if (svc) {
-            out_v1->dst     = (byte_t)((can_id >> 7U) & CANARD_NODE_ID_MAX);
-            out_v1->port_id = (can_id >> 14U) & CANARD_SERVICE_ID_MAX;
-            const bool req  = (can_id & (UINT32_C(1) << 24U)) != 0U;
-            out_v1->kind    = req ? canard_kind_request : canard_kind_response;
-            is_v1           = is_v1 && !bit_23 && (out_v1->src != out_v1->dst); // self-addressing not allowed
-        } else {
-            out_v1->dst       = CANARD_NODE_ID_ANONYMOUS;
-            const bool is_1v1 = (can_id & (UINT32_C(1) << 7U)) != 0U;
-            if (is_1v1) {
-                const bool bit_24 = (can_id & (UINT32_C(1) << 24U)) != 0U;
-                is_v1             = is_v1 && !bit_24; // was anonymous
-                out_v1->port_id   = (can_id >> 8U) & CANARD_SUBJECT_ID_MAX;
-                out_v1->kind      = canard_kind_message_16b;
-            } else {
-                is_v1           = is_v1 && !bit_23;
-                out_v1->port_id = (can_id >> 8U) & CANARD_SUBJECT_ID_MAX_13b;
-                out_v1->kind    = canard_kind_message_13b;
-                if ((can_id & (UINT32_C(1) << 24U)) != 0U) {
-                    out_v1->src = CANARD_NODE_ID_ANONYMOUS;
-                    is_v1       = is_v1 && start && end; // anonymous can only be single-frame
-                }
+    // If this is not the first frame of a transfer, the version is not detectable, so we attempt to parse both,
+    // unless one of them is disabled. The build-time part of the check is constant-folded.
+    const byte_t   enabled       = protocols & (byte_t)CANARD_PROTOCOL_ALL;
+    const bool     version_ok[2] = { ((enabled & CANARD_PROTOCOL_V0) != 0U) && !(start && toggle) && payload_ok,
+                                     ((enabled & CANARD_PROTOCOL_V1) != 0U) && !(start && !toggle) && payload_ok };
+    frame_t* const out[2]        = { out_v0, out_v1 };
+    byte_t         result        = 0;
+    for (byte_t v = 0; v < 2U; v++) {
+        if (version_ok[v]) {
+            const bool anon     = route->version[v].anonymous;
+            out[v]->priority    = priority;
+            out[v]->kind        = route->version[v].kind;
+            out[v]->port_id     = route->version[v].port_id;
+            out[v]->dst         = route->version[v].dst;
+            out[v]->src         = anon ? CANARD_NODE_ID_ANONYMOUS : src;
+            out[v]->transfer_id = transfer_id;
+            out[v]->start       = start;
+            out[v]->end         = end;
+            out[v]->toggle      = toggle;
+            out[v]->payload     = payload;
+            // Self-addressing is not allowed. Anonymous transfers can only be single-frame.
+            const bool valid = route->version[v].valid &&
+                               ((out[v]->dst == CANARD_NODE_ID_ANONYMOUS) || (out[v]->dst != src)) &&
+                               (!anon || (start && end));
+            if (valid) {
+                result = (byte_t)(result | (1U << v));
             }
         }
     }
-    if (is_v0) {
-        out_v0->priority    = priority;
-        out_v0->src         = src;
-        out_v0->transfer_id = transfer_id;
-        out_v0->start       = start;
-        out_v0->end         = end;
-        out_v0->toggle      = toggle;
-        out_v0->payload     = payload;
-        const bool svc      = (can_id & (UINT32_C(1) << 7U)) != 0U;
-        if (svc) {
-            const byte_t dst = (byte_t)((can_id >> 8U) & CANARD_NODE_ID_MAX);
-            out_v0->dst      = dst;
-            out_v0->port_id  = (can_id >> 16U) & 0xFFU;
-            const bool req   = (can_id & (UINT32_C(1) << 15U)) != 0U;
-            out_v0->kind     = req ? canard_kind_v0_request : canard_kind_v0_response;
-            // Node-ID 0 reserved for anonymous/broadcast, invalid for services. Self-addressing not allowed.
-            is_v0 = is_v0 && (dst != 0) && (src != 0) && (src != dst);
-        } else {
-            out_v0->dst  = CANARD_NODE_ID_ANONYMOUS;
-            out_v0->kind = canard_kind_v0_message;
-            if (src == 0) {
-                out_v0->src     = CANARD_NODE_ID_ANONYMOUS;
-                out_v0->port_id = (can_id >> 8U) & 0x3U; // anon frame carries only the 2 low DTID bits
-                is_v0           = is_v0 && start && end; // anonymous can only be single-frame
-            } else {
-                out_v0->port_id = (can_id >> 8U) & 0xFFFFU;
-            }
-        }
-    }
-    return (is_v0 ? 1U : 0U) | (is_v1 ? 2U : 0U);
+    return result;
 }
 
 // Idle sessions are removed after this timeout even if reassembly is not finished.
@@ -1195,28 +3419,85 @@ static byte_t rx_parse(const uint32_t       can_id,
 // Maintaining separate state per priority level allows preemption of higher-priority transfers without loss.
 // Interface affinity is required because frames duplicated across redundant interfaces may arrive with a significant
 // delay, which may cause the receiver to accept more frames than necessary.
+// A frame retained for zero-copy reassembly, or a copy of its payload if the frame buffer is not retainable.
+// The fragments of a transfer are handed over to the application as a chain, hence the link must be the first member.
+typedef struct rx_fragment_t
+{
+    canard_bytes_chain_t link;
+    canard_rx_buffer_t   buffer; // NULL vtable if the payload is stored inline.
+    size_t               alloc_size;
+    byte_t               data[]; // Inline payload copy, if not retained.
+} rx_fragment_t;
+
+static rx_fragment_t* rx_fragment_next(const rx_fragment_t* const frag)
+{
+    return (rx_fragment_t*)ptr_unbias(frag->link.next, offsetof(rx_fragment_t, link));
+}
+
+// Releases the fragment and all fragments following it.
+static void rx_fragment_free(canard_t* const self, rx_fragment_t* const head)
+{
+    rx_fragment_t* frag = head;
+    while (frag != NULL) {
+        rx_fragment_t* const next = rx_fragment_next(frag);
+        if (frag->buffer.vtable != NULL) {
+            frag->buffer.vtable->release(frag->buffer);
+        }
+        mem_free(self->mem.rx_payload, frag->alloc_size, frag);
+        frag = next;
+    }
+}
+
 typedef struct
 {
-    canard_us_t start_ts;
-    size_t      extent;     // Captured from sub->extent at slot creation; for v0, includes CRC_BYTES.
-    uint32_t    total_size; // The raw payload size seen before the implicit truncation and CRC removal.
-    uint16_t    crc;
-    byte_t      transfer_id : CANARD_TRANSFER_ID_BITS;
-    byte_t      iface_index : IFACE_INDEX_BITS;
-    byte_t      expected_toggle : 1;
-    byte_t      payload[]; // Extent-sized.
+    canard_us_t    start_ts;
+    size_t         extent;     // Captured from sub->extent at slot creation; for v0, includes CRC_BYTES.
+    uint32_t       total_size; // The raw payload size seen before the implicit truncation and CRC removal.
+    uint16_t       crc;
+    byte_t         transfer_id : CANARD_TRANSFER_ID_BITS;
+    byte_t         iface_index : IFACE_INDEX_BITS;
+    byte_t         expected_toggle : 1;
+    byte_t         chained         : 1; // The payload is kept in the fragment chain; see on_message_chain.
+    byte_t         reserved        : 1; // Taken from the slot reserve of the subscription and returned there.
+    rx_fragment_t* chain_head;          // NULL unless chained and non-empty.
+    rx_fragment_t* chain_tail;          // Ditto.
+    byte_t         payload[];           // Extent-sized; if chained, only the leading CRC of v0 is stored here.
 } rx_slot_t;
 #define RX_SLOT_OVERHEAD (offsetof(rx_slot_t, payload))
 
-static rx_slot_t* rx_slot_new(const canard_subscription_t* const sub,
-                              const canard_us_t                  start_ts,
-                              const byte_t                       transfer_id,
-                              const byte_t                       iface_index)
+static size_t rx_slot_storage(const canard_subscription_t* const sub, const rx_slot_t* const slot)
+{
+    return slot->chained ? ((canard_kind_version(sub->kind) == 0) ? CRC_BYTES : 0U) : slot->extent;
+}
+
+// The size of the rx_payload allocation for a new slot of the subscription.
+static size_t rx_slot_alloc_size(const canard_subscription_t* const sub)
+{
+    const size_t v0_crc = (canard_kind_version(sub->kind) == 0) ? CRC_BYTES : 0U;
+    return RX_SLOT_OVERHEAD + v0_crc + ((sub->vtable->on_message_chain != NULL) ? 0U : sub->extent);
+}
+
+// True if a slot of the specified allocation size is to be taken from the slot reserve of the subscription.
+static bool rx_slot_reserved(const canard_subscription_t* const sub, const size_t alloc_size)
+{
+    return (sub->reserved_slots > 0) && (alloc_size == sub->reserved_slot_size);
+}
+
+static rx_slot_t* rx_slot_new(canard_subscription_t* const sub,
+                              const canard_us_t            start_ts,
+                              const byte_t                 transfer_id,
+                              const byte_t                 iface_index)
 {
-    const size_t     extent_full = sub->extent + ((canard_kind_version(sub->kind) == 0) ? CRC_BYTES : 0);
-    rx_slot_t* const slot        = mem_alloc(sub->owner->mem.rx_payload, RX_SLOT_OVERHEAD + extent_full);
+    const size_t     extent_full = sub->extent + ((canard_kind_version(sub->kind) == 0) ? CRC_BYTES : 0U);
+    const bool       chained     = sub->vtable->on_message_chain != NULL;
+    const size_t     alloc_size  = rx_slot_alloc_size(sub);
+    const bool       reserved    = rx_slot_reserved(sub, alloc_size);
+    rx_slot_t* const slot =
+      reserved ? freelist_pop(&sub->free_slots) : mem_alloc(sub->owner->mem.rx_payload, alloc_size);
     if (slot != NULL) {
         memset(slot, 0, RX_SLOT_OVERHEAD);
+        slot->chained         = chained ? 1U : 0U;
+        slot->reserved        = reserved ? 1U : 0U;
         slot->start_ts        = start_ts;
         slot->extent          = extent_full;
         slot->crc             = sub->crc_seed;
@@ -1227,27 +3508,120 @@ static rx_slot_t* rx_slot_new(const canard_subscription_t* const sub,
     return slot;
 }
 
-static void rx_slot_destroy(const canard_subscription_t* const sub, rx_slot_t* const slot)
+static void rx_slot_destroy(canard_subscription_t* const sub, rx_slot_t* const slot)
 {
     if (slot != NULL) {
-        mem_free(sub->owner->mem.rx_payload, RX_SLOT_OVERHEAD + slot->extent, slot);
+        rx_fragment_free(sub->owner, slot->chain_head);
+        if (slot->reserved) {
+            freelist_push(&sub->free_slots, slot);
+        } else {
+            mem_free(sub->owner->mem.rx_payload, RX_SLOT_OVERHEAD + rx_slot_storage(sub, slot), slot);
+        }
     }
 }
 
-static void rx_slot_advance(rx_slot_t* const slot, const canard_bytes_t payload)
+// Appends the payload of the next frame to the slot, truncating it at the extent, and adds it to the transfer CRC.
+// The copy and the CRC are done in a single pass; the CRC covers the full payload even beyond the extent.
+// The first crc_skip bytes are stored but excluded from the CRC; this is used for the CRC of a v0 transfer,
+// which is placed at the beginning of the first frame.
+static void rx_slot_advance(rx_slot_t* const slot, const canard_bytes_t payload, const size_t crc_skip)
 {
+    CANARD_ASSERT(crc_skip <= payload.size);
+    const byte_t* const src = (const byte_t*)payload.data;
     if (slot->total_size < slot->extent) {
-        const size_t copy_size = smaller(payload.size, (size_t)(slot->extent - slot->total_size)); // NOLINT(*-casting)
-        (void)memcpy(&slot->payload[slot->total_size], payload.data, copy_size);
+        byte_t* const dst       = &slot->payload[slot->total_size];
+        const size_t  copy_size = smaller(payload.size, (size_t)(slot->extent - slot->total_size)); // NOLINT(*-casting)
+        CANARD_ASSERT(crc_skip <= copy_size);
+        (void)memcpy(dst, src, crc_skip);
+        slot->crc =
+          crc_add_copy(slot->crc, payload.size - crc_skip, &src[crc_skip], copy_size - crc_skip, &dst[crc_skip]);
+    } else {
+        slot->crc = crc_add(slot->crc, payload.size - crc_skip, &src[crc_skip]);
     }
     slot->total_size = (uint32_t)(slot->total_size + payload.size); // Before truncation.
     slot->expected_toggle ^= 1U;
 }
 
+// Like rx_slot_advance(), but the payload is appended to the fragment chain of the slot instead of being copied,
+// unless the frame buffer is not retainable. Fragments are not created for the payload past the extent.
+// Returns false on OOM, in which case the slot is unchanged.
+static bool rx_slot_advance_chain(canard_t* const          self,
+                                  rx_slot_t* const         slot,
+                                  const canard_bytes_t     payload,
+                                  const canard_rx_buffer_t buffer,
+                                  const size_t             crc_skip)
+{
+    CANARD_ASSERT(slot->chained && (crc_skip <= payload.size));
+    const byte_t* const data = &((const byte_t*)payload.data)[crc_skip];
+    const size_t        size = payload.size - crc_skip;
+    size_t              keep = 0;
+    if (slot->total_size < slot->extent) {
+        const size_t copy_size = smaller(payload.size, (size_t)(slot->extent - slot->total_size)); // NOLINT(*-casting)
+        CANARD_ASSERT((crc_skip <= copy_size) && ((crc_skip == 0) || (slot->total_size == 0)));
+        keep = copy_size - crc_skip;
+    }
+    rx_fragment_t* frag = NULL;
+    if (keep > 0) {
+        const bool   retain     = buffer.vtable != NULL;
+        const size_t alloc_size = sizeof(rx_fragment_t) + (retain ? 0U : keep);
+        frag                    = (rx_fragment_t*)mem_alloc(self->mem.rx_payload, alloc_size);
+        if (frag == NULL) {
+            return false;
+        }
+        frag->link       = (canard_bytes_chain_t){ .bytes = { .size = keep, .data = retain ? data : frag->data } };
+        frag->buffer     = retain ? buffer : (canard_rx_buffer_t){ .vtable = NULL, .context = NULL };
+        frag->alloc_size = alloc_size;
+        if (retain) {
+            buffer.vtable->retain(buffer);
+        }
+        if (slot->chain_tail != NULL) {
+            slot->chain_tail->link.next = &frag->link;
+        } else {
+            slot->chain_head = frag;
+        }
+        slot->chain_tail = frag;
+    }
+    if (crc_skip > 0) {
+        (void)memcpy(slot->payload, payload.data, crc_skip);
+    }
+    const bool copied = (frag != NULL) && (frag->buffer.vtable == NULL);
+    slot->crc         = copied ? crc_add_copy(slot->crc, size, data, keep, frag->data) : crc_add(slot->crc, size, data);
+    slot->total_size  = (uint32_t)(slot->total_size + payload.size); // Before truncation.
+    slot->expected_toggle ^= 1U;
+    return true;
+}
+
+// Cuts the fragment chain of the slot at the specified size, which is not greater than the stored size, and releases
+// the fragments past the cut. This removes the trailing transfer CRC, which may be split between the last two frames.
+// Returns the head of the remaining chain, which is detached from the slot.
+static rx_fragment_t* rx_slot_detach_chain(canard_t* const self, rx_slot_t* const slot, const size_t size)
+{
+    rx_fragment_t* const head = slot->chain_head;
+    slot->chain_head          = NULL;
+    slot->chain_tail          = NULL;
+    if (size == 0) {
+        rx_fragment_free(self, head);
+        return NULL;
+    }
+    rx_fragment_t* frag = head;
+    size_t         left = size;
+    while (left > frag->link.bytes.size) {
+        left -= frag->link.bytes.size;
+        frag = rx_fragment_next(frag);
+        CANARD_ASSERT(frag != NULL);
+    }
+    rx_fragment_free(self, rx_fragment_next(frag));
+    frag->link.bytes.size = left;
+    frag->link.next       = NULL;
+    return head;
+}
+
 // Up to libcanard v4 we used a fixed-capacity array of pointers for per-remote sessions for constant-time lookup,
 // but it was too costly on MCUs: with a 32-bit pointer it took 512 bytes for the array plus overheads,
-// resulting in 1 KiB o1heap blocks per session, very expensive. Here we use a much less RAM-heavy approach with
-// sparse nodes in a tree with log-time lookup.
+// resulting in 1 KiB o1heap blocks per session, very expensive. Here we keep the constant-time lookup but compact the
+// array: a 128-bit occupancy bitmap indexed by node-ID tells if a session exists, and the session pointers are stored
+// densely ordered by node-ID, so that the index of a session is the number of occupied node-IDs below it (its rank).
+// The array holds only as many pointers as there are active remotes, rounded up to a power of two.
 //
 // Design goals:
 //
@@ -1273,46 +3647,127 @@ static void rx_slot_advance(rx_slot_t* const slot, const canard_bytes_t payload)
 //  - Slot matching for continuation uses exact match: priority, transfer-ID/seqno, toggle, and iface.
 typedef struct
 {
-    canard_tree_t          index;
-    canard_listed_t        list_animation; // On update, session moved to the tail; oldest pushed to the head.
+    canard_listed_t        list_wheel; // In the timer wheel bucket of the expiry tick.
     canard_us_t            last_admission_ts;
+    canard_us_t            expiry; // The earliest time when either a slot or the session itself becomes stale.
     rx_slot_t*             slots[CANARD_PRIO_COUNT]; // Indexed by priority level to allow preemption.
     canard_subscription_t* owner;
     byte_t                 node_id;
     byte_t                 last_admitted_transfer_id;
     byte_t                 last_admitted_priority;
     byte_t                 iface_index;
+    byte_t                 wheel_bucket;
+    bool                   reserved; // Taken from the session reserve of the subscription and returned there.
 } rx_session_t;
 static_assert((sizeof(void*) > 4) || (sizeof(rx_session_t) <= 120), "too large");
 
-static int32_t rx_session_cavl_compare(const void* const user, const canard_tree_t* const node)
+#define RX_SESSION_CAPACITY_MIN 4U
+
+// The index of the session for the given node-ID in the dense array, whether it exists or not.
+static size_t rx_session_rank(const canard_subscription_t* const sub, const byte_t node_id)
 {
-    return ((int32_t)(*(byte_t*)user)) - ((int32_t)CAVL2_TO_OWNER(node, rx_session_t, index)->node_id);
+    CANARD_ASSERT(node_id <= CANARD_NODE_ID_MAX);
+    const uint64_t below = (UINT64_C(1) << (node_id % 64U)) - 1U;
+    return (node_id < 64U) ? popcount(sub->session_bitmap[0] & below)
+                           : ((size_t)popcount(sub->session_bitmap[0]) + popcount(sub->session_bitmap[1] & below));
 }
 
-typedef struct
+static size_t rx_session_count(const canard_subscription_t* const sub)
 {
-    canard_subscription_t* owner;
-    byte_t                 iface_index; // Start with the affinity to the iface that delivered the first frame.
-    byte_t                 node_id;
-} rx_session_factory_context_t;
+    return (size_t)popcount(sub->session_bitmap[0]) + popcount(sub->session_bitmap[1]);
+}
+
+static rx_session_t* rx_session_find(const canard_subscription_t* const sub, const byte_t node_id)
+{
+    return bitmap_test(sub->session_bitmap, node_id) ? (rx_session_t*)sub->sessions[rx_session_rank(sub, node_id)]
+                                                     : NULL;
+}
+
+// Moves the session pointers into a new array of the specified capacity, or frees the array if zero.
+// Returns false on OOM, in which case the array is unchanged.
+static bool rx_session_array_resize(canard_subscription_t* const sub, const size_t capacity)
+{
+    CANARD_ASSERT((capacity >= rx_session_count(sub)) && (capacity <= CANARD_NODE_ID_CAPACITY));
+    const canard_mem_t mem  = sub->owner->mem.rx_payload;
+    void** const       next = (capacity > 0) ? mem_alloc(mem, capacity * sizeof(void*)) : NULL;
+    if ((capacity > 0) && (next == NULL)) {
+        return false;
+    }
+    const size_t count = rx_session_count(sub);
+    if ((next != NULL) && (count > 0)) {
+        (void)memcpy(next, sub->sessions, count * sizeof(void*));
+    }
+    mem_free(mem, sub->session_capacity * sizeof(void*), (void*)sub->sessions);
+    sub->sessions         = next;
+    sub->session_capacity = (uint_least8_t)capacity;
+    return true;
+}
+
+// A slot is stale once older than this; see rx_session_cleanup().
+static canard_us_t rx_slot_timeout(const canard_subscription_t* const sub)
+{
+    return later(RX_SESSION_TIMEOUT, sub->transfer_id_timeout);
+}
+
+// Files the session in the timer wheel under the tick of its next expiry event. If there are in-progress slots,
+// this is the moment the oldest of them becomes stale; otherwise, it is when the session itself becomes stale.
+// The expiry may only move later without rescheduling (e.g., when a slot completes), in which case the session will
+// be visited early and simply rescheduled; it must never move earlier without rescheduling.
+static void rx_session_schedule(rx_session_t* const ses)
+{
+    canard_t* const   owner    = ses->owner->owner;
+    const canard_us_t slot_ttl = rx_slot_timeout(ses->owner);
+    canard_us_t       expiry   = HEAT_DEATH;
+    FOREACH_PRIO (i) {
+        if (ses->slots[i] != NULL) {
+            expiry = sooner(expiry, ses->slots[i]->start_ts + slot_ttl + 1);
+        }
+    }
+    if (expiry == HEAT_DEATH) {
+        expiry = (ses->last_admission_ts > BIG_BANG) ? (ses->last_admission_ts + ses->owner->transfer_id_timeout + 1)
+                                                     : BIG_BANG;
+    }
+    ses->expiry = expiry;
+    // Never file under an already processed tick, otherwise the session would be missed until the wheel wraps around.
+    const int64_t tick = later(expiry / CANARD_RX_WHEEL_TICK_us, owner->rx.wheel_tick);
+    delist(&owner->rx.wheel[ses->wheel_bucket], &ses->list_wheel);
+    ses->wheel_bucket = (byte_t)(((uint64_t)tick) % CANARD_RX_WHEEL_SIZE);
+    enlist_tail(&owner->rx.wheel[ses->wheel_bucket], &ses->list_wheel);
+}
 
-static canard_tree_t* rx_session_factory(void* const user)
+static rx_session_t* rx_session_new(canard_subscription_t* const sub, const byte_t iface_index, const byte_t node_id)
 {
-    const rx_session_factory_context_t* const ctx = (rx_session_factory_context_t*)user;
-    rx_session_t* const ses = mem_alloc_zero(ctx->owner->owner->mem.rx_session, sizeof(rx_session_t));
+    CANARD_ASSERT(!bitmap_test(sub->session_bitmap, node_id));
+    const size_t count    = rx_session_count(sub);
+    const bool   reserved = sub->reserved_sessions > 0; // The array is pre-sized then; do not grow it on the hot path.
+    if ((count == sub->session_capacity) &&
+        (reserved || !rx_session_array_resize(sub, (count == 0) ? RX_SESSION_CAPACITY_MIN : (count * 2U)))) {
+        return NULL;
+    }
+    rx_session_t* const ses =
+      reserved ? freelist_pop(&sub->free_sessions) : mem_alloc(sub->owner->mem.rx_session, sizeof(rx_session_t));
     if (ses == NULL) {
+        if ((count == 0) && !reserved) {
+            (void)rx_session_array_resize(sub, 0); // Do not hold the array with no sessions in it.
+        }
         return NULL;
     }
+    (void)memset(ses, 0, sizeof(*ses));
     FOREACH_PRIO (i) {
         ses->slots[i] = NULL;
     }
     ses->last_admission_ts = BIG_BANG;
-    ses->owner             = ctx->owner;
-    ses->iface_index       = ctx->iface_index;
-    ses->node_id           = ctx->node_id;
-    enlist_tail(&ctx->owner->owner->rx.list_session_by_animation, &ses->list_animation);
-    return &ses->index;
+    ses->owner             = sub;
+    ses->iface_index       = iface_index; // Start with the affinity to the iface that delivered the first frame.
+    ses->node_id           = node_id;
+    ses->reserved          = reserved;
+    rx_session_schedule(ses);
+    // Insert into the dense array keeping the node-ID ordering.
+    const size_t rank = rx_session_rank(sub, node_id);
+    (void)memmove(&sub->sessions[rank + 1U], &sub->sessions[rank], (count - rank) * sizeof(void*));
+    sub->sessions[rank] = ses;
+    bitmap_set(sub->session_bitmap, node_id);
+    return ses;
 }
 
 static void rx_session_destroy(rx_session_t* const ses)
@@ -1321,16 +3776,30 @@ static void rx_session_destroy(rx_session_t* const ses)
     FOREACH_PRIO (i) {
         rx_slot_destroy(sub, ses->slots[i]);
     }
-    CANARD_ASSERT(cavl2_is_inserted(sub->sessions, &ses->index));
-    cavl2_remove(&sub->sessions, &ses->index);
-    delist(&sub->owner->rx.list_session_by_animation, &ses->list_animation);
-    mem_free(sub->owner->mem.rx_session, sizeof(rx_session_t), ses);
+    CANARD_ASSERT(rx_session_find(sub, ses->node_id) == ses);
+    const size_t rank  = rx_session_rank(sub, ses->node_id);
+    const size_t count = rx_session_count(sub) - 1U;
+    (void)memmove(&sub->sessions[rank], &sub->sessions[rank + 1U], (count - rank) * sizeof(void*));
+    bitmap_clear(sub->session_bitmap, ses->node_id);
+    // Shrink with hysteresis to avoid reallocation on every change. Failure to shrink is harmless.
+    // The array is kept as is while reserved.
+    const bool sparse = (sub->session_capacity > RX_SESSION_CAPACITY_MIN) && (count <= (sub->session_capacity / 4U));
+    if (((count == 0) || sparse) && (sub->reserved_sessions == 0)) {
+        (void)rx_session_array_resize(sub, (count == 0) ? 0U : (sub->session_capacity / 2U));
+    }
+    delist(&sub->owner->rx.wheel[ses->wheel_bucket], &ses->list_wheel);
+    if (ses->reserved) {
+        freelist_push(&sub->free_sessions, ses);
+    } else {
+        mem_free(sub->owner->mem.rx_session, sizeof(rx_session_t), ses);
+    }
+    sub->owner->rx.epoch++; // Invalidate the memoized session pointers.
 }
 
 // Checks the state and purges stale slots to reclaim memory early. Returns the number of in-progress slots remaining.
 static size_t rx_session_cleanup(rx_session_t* const ses, const canard_us_t now)
 {
-    const canard_us_t deadline = now - later(RX_SESSION_TIMEOUT, ses->owner->transfer_id_timeout);
+    const canard_us_t deadline = now - rx_slot_timeout(ses->owner);
     size_t            n_slots  = 0;
     FOREACH_PRIO (i) {
         const rx_slot_t* const slot = ses->slots[i];
@@ -1371,13 +3840,31 @@ static void rx_session_complete_slot(rx_session_t* const ses, const frame_t* con
     const bool     v1        = canard_kind_version(sub->kind) == 1;
     const uint16_t crc_ref   = v1 ? CRC_RESIDUE : (uint16_t)(slot->payload[0] | (((unsigned)slot->payload[1]) << 8U));
     CANARD_ASSERT(v1 || (slot->extent >= CRC_BYTES)); // Guaranteed by rx_slot_new adding CRC_BYTES for v0.
-    if (slot->crc == crc_ref) {
-        const size_t           size    = smaller(slot->total_size - CRC_BYTES, slot->extent - (v1 ? 0 : CRC_BYTES));
+    const size_t size = smaller(slot->total_size - CRC_BYTES, slot->extent - (v1 ? 0 : CRC_BYTES));
+    if ((slot->crc == crc_ref) && slot->chained) {
+        const rx_fragment_t* const   head    = rx_slot_detach_chain(sub->owner, slot, size);
+        const canard_payload_chain_t payload = { .size = size, .head = (head != NULL) ? &head->link : NULL };
+        const canard_us_t            ts      = slot->start_ts;
+        rx_slot_destroy(sub, slot); // The chain is detached and owned by the application now.
+        sub->vtable->on_message_chain(sub, ts, fr->priority, fr->src, fr->transfer_id, payload);
+    } else if (slot->crc == crc_ref) {
+        // A reserved slot is lent to the application for the duration of the callback only.
+        canard_t* const        owner   = sub->owner;
+        const bool             lent    = slot->reserved;
         const canard_payload_t payload = {
             .view   = { .data = v1 ? slot->payload : &slot->payload[CRC_BYTES], .size = size },
-            .origin = { .data = slot, .size = RX_SLOT_OVERHEAD + slot->extent },
+            .origin = { .data = lent ? NULL : slot, .size = lent ? 0U : (RX_SLOT_OVERHEAD + slot->extent) },
         };
+        if (lent) {
+            owner->rx.lent_slot       = slot;
+            owner->rx.lent_slot_owner = sub;
+        }
         sub->vtable->on_message(sub, slot->start_ts, fr->priority, fr->src, fr->transfer_id, payload);
+        if (lent && (owner->rx.lent_slot != NULL)) { // Otherwise, released by canard_unsubscribe() in the callback.
+            freelist_push(&sub->free_slots, slot);
+            owner->rx.lent_slot       = NULL;
+            owner->rx.lent_slot_owner = NULL;
+        }
     } else {
         sub->owner->err.rx_transfer++;
         rx_slot_destroy(ses->owner, slot);
@@ -1392,17 +3879,21 @@ static void rx_session_accept(rx_session_t* const ses, const canard_us_t ts_fram
     if (slot != NULL) {
         CANARD_ASSERT((!fr->start || !fr->end) && (slot->expected_toggle == fr->toggle));
         CANARD_ASSERT(slot->transfer_id == fr->transfer_id);
-        rx_slot_advance(slot, fr->payload);
         // Multi-frame transfers place CRC differently in v1 and v0.
         // The v1 handling is trivial: simply compute the full payload CRC and ensure the residue is correct.
         // The payload may be truncated to the slot extent, but the CRC is computed over the full payload.
-        // Legacy v0 is messy because the CRC is in the beginning, which we need to handle specially.
+        // Legacy v0 is messy because the CRC is in the beginning, which we need to exclude from the computation.
         // The CRC initial state is constant for v1, data-type-dependent for v0; this is managed outside of this scope.
-        const canard_bytes_t crc_input =
-          ((canard_kind_version(sub->kind) == 0) && fr->start)
-            ? (canard_bytes_t){ .size = fr->payload.size - CRC_BYTES, .data = ((byte_t*)fr->payload.data) + CRC_BYTES }
-            : fr->payload;
-        slot->crc = crc_add(slot->crc, crc_input.size, crc_input.data);
+        const bool   v0_head  = (canard_kind_version(sub->kind) == 0) && fr->start;
+        const size_t crc_skip = v0_head ? CRC_BYTES : 0U;
+        if (!slot->chained) {
+            rx_slot_advance(slot, fr->payload, crc_skip);
+        } else if (!rx_slot_advance_chain(sub->owner, slot, fr->payload, fr->buffer, crc_skip)) {
+            sub->owner->err.oom++;
+            ses->slots[fr->priority] = NULL; // The transfer cannot be completed; the remaining frames will be dropped.
+            rx_slot_destroy(sub, slot);
+            return;
+        }
         if (fr->end) {
             rx_session_complete_slot(ses, fr);
         }
@@ -1488,10 +3979,13 @@ static bool rx_session_solve_admission(const rx_session_t* const ses,
 
 // The caller must ensure the frame is of the correct version that matches the subscription (v0/v1).
 // The caller must ensure the frame is directed to the local node (broadcast or unicast to the local node-ID).
+// The session hint is optional; if given, it memoizes the session of the frame source to skip the lookup next time.
+// The caller is responsible for discarding the hint when the session may have been destroyed (see rx.epoch).
 static void rx_session_update(canard_subscription_t* const sub,
                               const canard_us_t            ts,
                               const frame_t* const         frame,
-                              const byte_t                 iface_index)
+                              const byte_t                 iface_index,
+                              rx_session_t** const         session_hint)
 {
     CANARD_ASSERT((sub != NULL) && (frame != NULL) && (frame->payload.data != NULL) && (ts >= 0));
     CANARD_ASSERT(frame->end || (frame->payload.size >= 7));
@@ -1510,20 +4004,21 @@ static void rx_session_update(canard_subscription_t* const sub,
     // Only start frames may create new states.
     // The protocol version is observable on start frames by design, which makes this robust.
     // At this point we also ensured the frame is not misaddressed.
-    rx_session_factory_context_t factory_context = { .owner = sub, .iface_index = iface_index, .node_id = frame->src };
-    rx_session_t* const          ses =
-      CAVL2_TO_OWNER(frame->start ? cavl2_find_or_insert(&sub->sessions, //
-                                                         &frame->src,
-                                                         rx_session_cavl_compare,
-                                                         &factory_context,
-                                                         rx_session_factory)
-                                  : cavl2_find(sub->sessions, &frame->src, rx_session_cavl_compare),
-                     rx_session_t,
-                     index);
+    rx_session_t* ses = (session_hint != NULL) ? *session_hint : NULL;
     if (ses == NULL) {
-        sub->owner->err.oom += frame->start;
-        return;
+        ses = rx_session_find(sub, frame->src);
+        if ((ses == NULL) && frame->start) {
+            ses = rx_session_new(sub, iface_index, frame->src);
+        }
+        if (ses == NULL) {
+            sub->owner->err.oom += frame->start;
+            return;
+        }
+        if (session_hint != NULL) {
+            *session_hint = ses;
+        }
     }
+    CANARD_ASSERT((ses->owner == sub) && (ses->node_id == frame->src));
 
     // Decide admit or drop.
     const bool admit = rx_session_solve_admission(
@@ -1534,8 +4029,6 @@ static void rx_session_update(canard_subscription_t* const sub,
 
     // The frame must be accepted. If this is the start of a new transfer, we must update state.
     if (frame->start) {
-        // Animate only when a new transfer is started to manage load. Correctness-wise there is not much difference.
-        enlist_tail(&sub->owner->rx.list_session_by_animation, &ses->list_animation);
         // Destroy the old slot if it exists, meaning we're discarding stale transfer.
         if (ses->slots[frame->priority] != NULL) {
             rx_slot_destroy(sub, ses->slots[frame->priority]);
@@ -1547,6 +4040,7 @@ static void rx_session_update(canard_subscription_t* const sub,
             ses->slots[frame->priority] = rx_slot_new(sub, ts, frame->transfer_id, iface_index);
             if (ses->slots[frame->priority] == NULL) {
                 sub->owner->err.oom++;
+                rx_session_schedule(ses);
                 return;
             }
             CANARD_ASSERT(ses->slots[frame->priority]->transfer_id == frame->transfer_id);
@@ -1554,34 +4048,198 @@ static void rx_session_update(canard_subscription_t* const sub,
         }
         // Register the new state only after we have a confirmation that we have memory to store the frame.
         rx_session_record_admission(ses, frame->priority, frame->transfer_id, ts, iface_index);
+        rx_session_schedule(ses); // Reschedule only when a new transfer is started to manage load.
     }
 
     // Accept the frame. Must be last: on_message may unsubscribe, destroying ses.
     rx_session_accept(ses, ts, frame);
 }
 
+// Visits the timer wheel buckets of the ticks elapsed since the last call, including the current one which may be
+// only partially due, and handles the sessions that are due: stale slots are purged, and the session is destroyed
+// if it has no slots left and its transfer-ID timeout has expired; otherwise, it is rescheduled.
+// Sessions in the visited buckets that are due in a later rotation of the wheel are skipped.
+static void rx_wheel_advance(canard_t* const self, const canard_us_t now)
+{
+    const int64_t now_tick = now / CANARD_RX_WHEEL_TICK_us;
+    // If more than a full rotation has elapsed, every bucket is visited once.
+    const int64_t last = sooner(now_tick, (self->rx.wheel_tick + (int64_t)CANARD_RX_WHEEL_SIZE) - 1);
+    for (int64_t tick = self->rx.wheel_tick; tick <= last; tick++) {
+        canard_list_t* const bucket = &self->rx.wheel[((uint64_t)tick) % CANARD_RX_WHEEL_SIZE];
+        rx_session_t*        ses    = LIST_HEAD(*bucket, rx_session_t, list_wheel);
+        while (ses != NULL) {
+            // Rescheduled sessions are moved after the current position, which is fine as they are no longer due.
+            rx_session_t* const next = LIST_NEXT(ses, rx_session_t, list_wheel);
+            if (ses->expiry <= now) {
+                const size_t in_progress_slots = rx_session_cleanup(ses, now);
+                if ((in_progress_slots == 0) && (ses->last_admission_ts < (now - ses->owner->transfer_id_timeout))) {
+                    rx_session_destroy(ses);
+                } else {
+                    rx_session_schedule(ses);
+                }
+            }
+            ses = next;
+        }
+    }
+    self->rx.wheel_tick = later(self->rx.wheel_tick, now_tick); // The current tick will be revisited.
+}
+
 static int32_t rx_subscription_cavl_compare(const void* const user, const canard_tree_t* const node)
 {
     return ((int32_t)(*(const uint16_t*)user)) - ((int32_t)((const canard_subscription_t*)(const void*)node)->port_id);
 }
 
+#if CANARD_RX_SUBSCRIPTION_TABLE
+// The port-ID is split into the root index (high bits) and the leaf index (low bits).
+#define RX_TABLE_LEAF_BITS                8U
+#define RX_TABLE_LEAF_SIZE                (1U << RX_TABLE_LEAF_BITS)
+#define RX_TABLE_ROOT_SIZE(port_id_count) (((port_id_count) + RX_TABLE_LEAF_SIZE - 1U) / RX_TABLE_LEAF_SIZE)
+
+// Indexed by kind. Port-IDs beyond the root of their kind are not representable and thus never subscribed.
+static const uint16_t rx_table_root_size[CANARD_KIND_COUNT] = {
+    [canard_kind_message_16b] = RX_TABLE_ROOT_SIZE(CANARD_SUBJECT_ID_MAX + 1U),
+    [canard_kind_message_13b] = RX_TABLE_ROOT_SIZE(CANARD_SUBJECT_ID_MAX_13b + 1U),
+    [canard_kind_response]    = RX_TABLE_ROOT_SIZE(CANARD_SERVICE_ID_MAX + 1U),
+    [canard_kind_request]     = RX_TABLE_ROOT_SIZE(CANARD_SERVICE_ID_MAX + 1U),
+    [canard_kind_v0_message]  = RX_TABLE_ROOT_SIZE(CANARD_SUBJECT_ID_MAX + 1U),
+    [canard_kind_v0_response] = RX_TABLE_ROOT_SIZE(BYTE_MAX + 1U),
+    [canard_kind_v0_request]  = RX_TABLE_ROOT_SIZE(BYTE_MAX + 1U),
+};
+
+static bool rx_table_is_empty(const void* const* const table, const size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        if (table[i] != NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Frees the leaf at the specified root index and then the root itself if they are empty.
+static void rx_table_prune(canard_t* const self, const canard_kind_t kind, const size_t hi)
+{
+    canard_subscription_t*** const root = self->rx.subscription_table[kind];
+    if (root != NULL) {
+        const size_t root_size = rx_table_root_size[kind];
+        CANARD_ASSERT(hi < root_size);
+        if ((root[hi] != NULL) && rx_table_is_empty((const void* const*)root[hi], RX_TABLE_LEAF_SIZE)) {
+            mem_free(self->mem.rx_payload, RX_TABLE_LEAF_SIZE * sizeof(canard_subscription_t*), root[hi]);
+            root[hi] = NULL;
+        }
+        if (rx_table_is_empty((const void* const*)root, root_size)) {
+            mem_free(self->mem.rx_payload, root_size * sizeof(canard_subscription_t**), root);
+            self->rx.subscription_table[kind] = NULL;
+        }
+    }
+}
+
+// Returns false on OOM, in which case the table is left unchanged.
+static bool rx_table_insert(canard_t* const self, canard_subscription_t* const sub)
+{
+    const size_t root_size = rx_table_root_size[sub->kind];
+    const size_t hi        = sub->port_id >> RX_TABLE_LEAF_BITS;
+    CANARD_ASSERT(hi < root_size);
+    canard_subscription_t*** root = self->rx.subscription_table[sub->kind];
+    if (root == NULL) {
+        root =
+          (canard_subscription_t***)mem_alloc_zero(self->mem.rx_payload, root_size * sizeof(canard_subscription_t**));
+        self->rx.subscription_table[sub->kind] = root;
+    }
+    if ((root != NULL) && (root[hi] == NULL)) {
+        root[hi] = (canard_subscription_t**)mem_alloc_zero(self->mem.rx_payload,
+                                                           RX_TABLE_LEAF_SIZE * sizeof(canard_subscription_t*));
+    }
+    const bool ok = (root != NULL) && (root[hi] != NULL);
+    if (ok) {
+        CANARD_ASSERT(root[hi][sub->port_id & (RX_TABLE_LEAF_SIZE - 1U)] == NULL);
+        root[hi][sub->port_id & (RX_TABLE_LEAF_SIZE - 1U)] = sub;
+    } else {
+        rx_table_prune(self, sub->kind, hi);
+    }
+    return ok;
+}
+
+static void rx_table_remove(canard_t* const self, const canard_subscription_t* const sub)
+{
+    canard_subscription_t*** const root = self->rx.subscription_table[sub->kind];
+    const size_t                   hi   = sub->port_id >> RX_TABLE_LEAF_BITS;
+    CANARD_ASSERT((root != NULL) && (root[hi] != NULL));
+    CANARD_ASSERT(root[hi][sub->port_id & (RX_TABLE_LEAF_SIZE - 1U)] == sub);
+    root[hi][sub->port_id & (RX_TABLE_LEAF_SIZE - 1U)] = NULL;
+    rx_table_prune(self, sub->kind, hi);
+}
+#endif
+
 static canard_subscription_t* rx_find_subscription(const canard_t* const self,
                                                    const canard_kind_t   kind,
                                                    const uint16_t        port_id)
 {
     CANARD_ASSERT((self != NULL) && ((size_t)kind < CANARD_KIND_COUNT));
+#if CANARD_RX_SUBSCRIPTION_TABLE
+    canard_subscription_t** const* const root = self->rx.subscription_table[kind];
+    const size_t                         hi   = port_id >> RX_TABLE_LEAF_BITS;
+    canard_subscription_t** const        leaf = ((root != NULL) && (hi < rx_table_root_size[kind])) ? root[hi] : NULL;
+    return (leaf != NULL) ? leaf[port_id & (RX_TABLE_LEAF_SIZE - 1U)] : NULL;
+#else
     return (canard_subscription_t*)(void*)cavl2_find(
       self->rx.subscriptions[kind], &port_id, rx_subscription_cavl_compare);
+#endif
 }
 
 // Locates the appropriate subscription if the destination is matching and there is a subscription.
-static canard_subscription_t* rx_route(const canard_t* const self, const frame_t* const fr)
+static canard_subscription_t* rx_route(const canard_t* const self,
+                                       const canard_kind_t   kind,
+                                       const uint16_t        port_id,
+                                       const byte_t          dst)
 {
-    CANARD_ASSERT((self != NULL) && (fr != NULL));
-    if ((fr->dst != CANARD_NODE_ID_ANONYMOUS) && (fr->dst != self->node_id)) {
+    CANARD_ASSERT(self != NULL);
+    if ((dst != CANARD_NODE_ID_ANONYMOUS) && (dst != self->node_id)) {
         return NULL; // misfiltered
     }
-    return rx_find_subscription(self, fr->kind, fr->port_id);
+    return rx_find_subscription(self, kind, port_id);
+}
+
+#if CANARD_RX_ROUTE_CACHE_SIZE > 0
+static size_t rx_route_cache_index(const uint32_t key)
+{
+    return (size_t)((key * UINT32_C(2654435761)) >> 16U) & (CANARD_RX_ROUTE_CACHE_SIZE - 1U); // Knuth hash
+}
+#endif
+
+// Must be invoked whenever the outcome of rx_route() may change: on subscription changes and node-ID changes.
+static void rx_routing_changed(canard_t* const self)
+{
+    self->rx.filters_dirty = true;
+    self->rx.epoch++;
+#if CANARD_RX_ROUTE_CACHE_SIZE > 0
+    memset(self->rx.route_cache, 0, sizeof(self->rx.route_cache));
+#endif
+}
+
+// Parses the CAN ID and finds the matching subscriptions for both protocol versions, consulting the cache first.
+static void rx_route_resolve(canard_t* const self, const uint32_t can_id, canard_rx_route_t* const out)
+{
+    CANARD_ASSERT((self != NULL) && (out != NULL));
+#if CANARD_RX_ROUTE_CACHE_SIZE > 0
+    const uint32_t           key   = rx_route_key(can_id);
+    canard_rx_route_t* const entry = &self->rx.route_cache[rx_route_cache_index(key)];
+    if (entry->key == key) {
+        self->rx.route_cache_hits++;
+        *out = *entry;
+        return;
+    }
+#endif
+    self->rx.route_cache_misses++;
+    rx_parse_can_id(can_id, out);
+    for (size_t v = 0; v < 2U; v++) {
+        out->version[v].subscription =
+          out->version[v].valid ? rx_route(self, out->version[v].kind, out->version[v].port_id, out->version[v].dst)
+                                : NULL;
+    }
+#if CANARD_RX_ROUTE_CACHE_SIZE > 0
+    *entry = *out;
+#endif
 }
 
 // Builds an acceptance filter that only admits frames matching the given kind and port-ID.
@@ -1593,6 +4251,7 @@ static canard_filter_t rx_filter_for_subscription(const canard_t* const self,
     canard_filter_t f  = { 0 };
     const uint32_t  id = self->node_id & CANARD_NODE_ID_MAX;
     switch (kind) {
+#if CANARD_ENABLE_V1
         case canard_kind_message_16b:
             f.extended_can_id = ((uint32_t)port_id << 8U) | (UINT32_C(1) << 7U);
             f.extended_mask   = 0x03FFFF80U;
@@ -1610,6 +4269,8 @@ static canard_filter_t rx_filter_for_subscription(const canard_t* const self,
             f.extended_mask    = 0x03FFFF80U;
             break;
         }
+#endif
+#if CANARD_ENABLE_V0
         case canard_kind_v0_message:
             f.extended_can_id = (uint32_t)port_id << 8U;
             // A data-type-ID <= 3 can also arrive anonymously, carrying only its 2 low bits with a random
@@ -1624,7 +4285,19 @@ static canard_filter_t rx_filter_for_subscription(const canard_t* const self,
             f.extended_mask    = 0x00FFFF80U;
             break;
         }
-        default:
+#endif
+#if !CANARD_ENABLE_V1
+        case canard_kind_message_16b:
+        case canard_kind_message_13b:
+        case canard_kind_response:
+        case canard_kind_request:
+#endif
+#if !CANARD_ENABLE_V0
+        case canard_kind_v0_message:
+        case canard_kind_v0_response:
+        case canard_kind_v0_request:
+#endif
+        default: // Subscriptions of the versions disabled at build time cannot exist.
             CANARD_ASSERT(false);
     }
     return f;
@@ -1719,8 +4392,12 @@ static bool rx_filter_configure(canard_t* const self)
     }
 
     // Build the filter array. Use optimal coalescence if we have more subscriptions than filters available.
+    // The subscriptions of the disabled protocol versions are left out.
     size_t n = 0;
     for (size_t kind = 0; kind < CANARD_KIND_COUNT; kind++) {
+        if (!protocol_enabled(self, canard_kind_version((canard_kind_t)kind))) {
+            continue;
+        }
         for (const canard_subscription_t* sub = (canard_subscription_t*)(void*)cavl2_min(self->rx.subscriptions[kind]);
              sub != NULL;
              sub = (canard_subscription_t*)(void*)cavl2_next_greater((canard_tree_t*)sub)) {
@@ -1740,6 +4417,9 @@ static bool rx_filter_configure(canard_t* const self)
         { canard_kind_v0_message, 341U },   // DroneCAN NodeStatus
     };
     for (size_t i = 0; i < sizeof(forced) / sizeof(forced[0]); i++) {
+        if (!protocol_enabled(self, canard_kind_version(forced[i].kind))) {
+            continue;
+        }
         const canard_filter_t g = rx_filter_for_subscription(self, forced[i].kind, forced[i].port_id);
         if (!rx_filter_covered(n, filters, g)) {
             rx_filter_append(filters, &n, capacity, g);
@@ -1753,6 +4433,28 @@ static bool rx_filter_configure(canard_t* const self)
     return ok;
 }
 
+// Returns the reserved sessions and slots of the subscription to the memory resources, and frees the session array.
+// This includes the reserved slot lent to the application if the subscription is removed from the callback.
+static void rx_reserve_release(canard_subscription_t* const sub)
+{
+    canard_t* const self = sub->owner;
+    CANARD_ASSERT(rx_session_count(sub) == 0);
+    if ((self->rx.lent_slot != NULL) && (self->rx.lent_slot_owner == sub)) {
+        mem_free(self->mem.rx_payload, sub->reserved_slot_size, self->rx.lent_slot);
+        self->rx.lent_slot       = NULL;
+        self->rx.lent_slot_owner = NULL;
+    }
+    while (sub->free_sessions != NULL) {
+        mem_free(self->mem.rx_session, sizeof(rx_session_t), freelist_pop(&sub->free_sessions));
+    }
+    while (sub->free_slots != NULL) {
+        mem_free(self->mem.rx_payload, sub->reserved_slot_size, freelist_pop(&sub->free_slots));
+    }
+    sub->reserved_sessions = 0;
+    sub->reserved_slots    = 0;
+    (void)rx_session_array_resize(sub, 0);
+}
+
 // Common subscribe logic: validate, initialize, insert into tree, mark filters dirty.
 static canard_subscription_t* rx_subscribe(canard_t* const                           self,
                                            canard_subscription_t* const              subscription,
@@ -1765,7 +4467,7 @@ static canard_subscription_t* rx_subscribe(canard_t* const
 {
     canard_subscription_t* out = NULL;
     if ((self != NULL) && (subscription != NULL) && (vtable != NULL) && (vtable->on_message != NULL) &&
-        (transfer_id_timeout >= 0)) {
+        (transfer_id_timeout >= 0) && protocol_enabled(self, canard_kind_version(kind))) {
         (void)memset(subscription, 0, sizeof(*subscription));
         subscription->transfer_id_timeout   = transfer_id_timeout;
         subscription->extent                = extent;
@@ -1773,7 +4475,10 @@ static canard_subscription_t* rx_subscribe(canard_t* const
         subscription->crc_seed              = crc_seed;
         subscription->kind                  = kind;
         subscription->owner                 = self;
+        subscription->session_bitmap[0]     = 0;
+        subscription->session_bitmap[1]     = 0;
         subscription->sessions              = NULL;
+        subscription->session_capacity      = 0;
         subscription->vtable                = vtable;
         subscription->user_context          = NULL;
         const canard_tree_t* const existing = cavl2_find_or_insert(&self->rx.subscriptions[kind],
@@ -1782,11 +4487,73 @@ static canard_subscription_t* rx_subscribe(canard_t* const
                                                                    &subscription->index_port_id,
                                                                    cavl2_trivial_factory);
         out                                 = (canard_subscription_t*)(void*)existing;
-        self->rx.filters_dirty              = self->rx.filters_dirty || (existing == &subscription->index_port_id);
+#if CANARD_RX_SUBSCRIPTION_TABLE
+        if ((out == subscription) && !rx_table_insert(self, subscription)) {
+            cavl2_remove(&self->rx.subscriptions[kind], &subscription->index_port_id);
+            self->err.oom++;
+            out = NULL;
+        }
+#endif
+        if (out == subscription) {
+            rx_routing_changed(self);
+            if (self->mem.rx_payload.vtable == &slab_vtable) { // Failure is harmless, the slab will pass through.
+                canard_slab_t* const slab = (canard_slab_t*)self->mem.rx_payload.context;
+                (void)canard_slab_reserve(slab, rx_slot_alloc_size(subscription), slab->prewarm);
+            }
+        }
     }
     return out;
 }
 
+bool canard_subscription_reserve(canard_t* const              self,
+                                 canard_subscription_t* const subscription,
+                                 const size_t                 sessions,
+                                 const size_t                 slots)
+{
+    if ((self == NULL) || (subscription == NULL) || (subscription->owner != self) ||
+        (sessions > CANARD_NODE_ID_CAPACITY)) {
+        return false;
+    }
+    canard_subscription_t* const sub = subscription;
+    if ((sub->reserved_slots == 0) && (slots > 0)) {
+        sub->reserved_slot_size = rx_slot_alloc_size(sub);
+    }
+    // Sessions that exist already were allocated from the general resource, they need room in the array as well.
+    const size_t capacity = smaller(sessions + rx_session_count(sub), CANARD_NODE_ID_CAPACITY);
+    if ((sessions > 0) && (capacity > sub->session_capacity) && !rx_session_array_resize(sub, capacity)) {
+        return false;
+    }
+    const size_t reserved_sessions = sub->reserved_sessions;
+    const size_t reserved_slots    = sub->reserved_slots;
+    bool         ok                = true;
+    while (ok && (sub->reserved_sessions < sessions)) {
+        void* const ses = mem_alloc(self->mem.rx_session, sizeof(rx_session_t));
+        if (ses != NULL) {
+            freelist_push(&sub->free_sessions, ses);
+            sub->reserved_sessions++;
+        }
+        ok = ses != NULL;
+    }
+    while (ok && (sub->reserved_slots < slots)) {
+        void* const slot = mem_alloc(self->mem.rx_payload, sub->reserved_slot_size);
+        if (slot != NULL) {
+            freelist_push(&sub->free_slots, slot);
+            sub->reserved_slots++;
+        }
+        ok = slot != NULL;
+    }
+    // On failure, the blocks added by this call are on top of the free lists; give them back to keep the old reserve.
+    while (!ok && (sub->reserved_sessions > reserved_sessions)) {
+        mem_free(self->mem.rx_session, sizeof(rx_session_t), freelist_pop(&sub->free_sessions));
+        sub->reserved_sessions--;
+    }
+    while (!ok && (sub->reserved_slots > reserved_slots)) {
+        mem_free(self->mem.rx_payload, sub->reserved_slot_size, freelist_pop(&sub->free_slots));
+        sub->reserved_slots--;
+    }
+    return ok;
+}
+
 canard_subscription_t* canard_subscribe_16b(canard_t* const                           self,
                                             canard_subscription_t* const              subscription,
                                             const uint16_t                            subject_id,
@@ -1891,11 +4658,15 @@ canard_subscription_t* canard_v0_subscribe_response(canard_t* const
 void canard_unsubscribe(canard_t* const self, canard_subscription_t* const subscription)
 {
     CANARD_ASSERT((self != NULL) && (subscription != NULL) && (subscription->owner == self));
-    while (subscription->sessions != NULL) {
-        rx_session_destroy((rx_session_t*)(void*)cavl2_min(subscription->sessions));
+    while (rx_session_count(subscription) > 0) { // Destroy from the end of the array to avoid shifting.
+        rx_session_destroy((rx_session_t*)subscription->sessions[rx_session_count(subscription) - 1U]);
     }
+    rx_reserve_release(subscription);
     cavl2_remove(&self->rx.subscriptions[subscription->kind], &subscription->index_port_id);
-    self->rx.filters_dirty = true;
+#if CANARD_RX_SUBSCRIPTION_TABLE
+    rx_table_remove(self, subscription);
+#endif
+    rx_routing_changed(self);
 }
 
 // ---------------------------------------------           MISC            ---------------------------------------------
@@ -1950,7 +4721,7 @@ static void node_id_occupancy_update(canard_t* const self, const byte_t src)
 
         // Update dependent states.
         tx_purge_continuations(self);
-        self->rx.filters_dirty = true;
+        rx_routing_changed(self);
         self->err.collision++;
     }
 
@@ -1986,6 +4757,9 @@ bool canard_new(canard_t* const              self,
         self->prng_state        = prng_seed ^ (uintptr_t)self;
         self->vtable            = vtable;
         self->node_id           = (byte_t)(random(self, CANARD_NODE_ID_MAX) + 1U); // [1, 127]
+        FOREACH_PRIO (i) {
+            self->tx.queue_limit[i] = tx_queue_capacity;
+        }
         node_id_occupancy_reset(self);
     }
     return ok;
@@ -1997,12 +4771,17 @@ void canard_destroy(canard_t* const self)
     // The application MUST destroy all subscriptions before destroying the instance.
     for (size_t i = 0; i < (sizeof(self->rx.subscriptions) / sizeof(self->rx.subscriptions[0])); i++) {
         CANARD_ASSERT(self->rx.subscriptions[i] == NULL);
+#if CANARD_RX_SUBSCRIPTION_TABLE
+        CANARD_ASSERT(self->rx.subscription_table[i] == NULL);
+#endif
+    }
+    for (size_t i = 0; i < CANARD_RX_WHEEL_SIZE; i++) {
+        CANARD_ASSERT(self->rx.wheel[i].head == NULL);
+        CANARD_ASSERT(self->rx.wheel[i].tail == NULL);
     }
-    CANARD_ASSERT(self->rx.list_session_by_animation.head == NULL);
-    CANARD_ASSERT(self->rx.list_session_by_animation.tail == NULL);
     while (self->tx.agewise.head != NULL) {
         tx_transfer_t* const tr = LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
-        tx_retire(self, tr);
+        tx_retire(self, tr, canard_tx_outcome_canceled);
     }
     (void)memset(self, 0, sizeof(*self)); // UAF safety
 }
@@ -2015,7 +4794,18 @@ bool canard_set_node_id(canard_t* const self, const uint_least8_t node_id)
         // If the source node-ID changes, started multi-frame continuations become invalid and must be canceled.
         tx_purge_continuations(self);
         node_id_occupancy_reset(self);
-        self->rx.filters_dirty = true;
+        rx_routing_changed(self);
+    }
+    return ok;
+}
+
+bool canard_set_protocols(canard_t* const self, const uint_least8_t protocols)
+{
+    const bool   ok       = (self != NULL) && (protocols != 0U) && ((protocols & CANARD_PROTOCOL_ALL) == protocols);
+    const byte_t disabled = (byte_t)(CANARD_PROTOCOL_ALL & ~(unsigned)protocols);
+    if (ok && (disabled != self->protocols_disabled)) {
+        self->protocols_disabled = disabled;
+        self->rx.filters_dirty   = true; // The routing is unaffected because the protocols are checked when parsing.
     }
     return ok;
 }
@@ -2025,22 +4815,9 @@ void canard_poll(canard_t* const self, const uint_least8_t tx_ready_iface_bitmap
     if (self != NULL) {
         self->rx.filters_dirty = self->rx.filters_dirty && !rx_filter_configure(self);
 
-        // Drop stale sessions to reclaim memory. This happens when remote peers cease sending data.
-        // The oldest is held alive until its session timeout has expired, but notice that it may be different
-        // depending on the subscription instance if large transfer-ID values are used.
-        // This means that a stale session that belongs to a subscription with a long timeout may keep other sessions
-        // with a shorter timeout alive beyond their expiration time.
-        // We accept this because it does not affect correctness (the transfer-ID timeout is checked on reception
-        // always); the only downside is that memory reclamation time is bounded in the worst case by the longest
-        // transfer-ID timeout among all subscriptions, but this is a reasonable tradeoff for the reduced complexity.
-        rx_session_t* const ses = LIST_HEAD(self->rx.list_session_by_animation, rx_session_t, list_animation);
-        const canard_us_t   now = self->vtable->now(self);
-        if (ses != NULL) {
-            const size_t in_progress_slots = rx_session_cleanup(ses, now);
-            if ((in_progress_slots == 0) && (ses->last_admission_ts < (now - ses->owner->transfer_id_timeout))) {
-                rx_session_destroy(ses);
-            }
-        }
+        // Drop stale sessions and slots to reclaim memory. This happens when remote peers cease sending data.
+        const canard_us_t now = self->vtable->now(self);
+        rx_wheel_advance(self, now);
 
         // Process the TX pipeline.
         tx_expire(self, now); // deadline maintenance first to keep queue pressure bounded
@@ -2052,20 +4829,87 @@ void canard_poll(canard_t* const self, const uint_least8_t tx_ready_iface_bitmap
     }
 }
 
-static void ingest_frame(canard_t* const     self,
-                         const canard_us_t   timestamp,
-                         const uint_least8_t iface_index,
-                         const frame_t       frame)
+// Routing state that depends only on the CAN ID, memoized across consecutive frames sharing the same CAN ID.
+// Such runs are typical because multi-frame transfers are usually received back-to-back.
+// The memo is only valid while rx.epoch is unchanged; e.g., the callbacks may unsubscribe, invalidating it.
+typedef struct
+{
+    uint32_t          can_id;     // Above CAN_EXT_ID_MASK if empty.
+    uint32_t          epoch;      // The value of rx.epoch when the memo was populated.
+    canard_rx_route_t route;      // Parsed CAN ID and the resolved subscriptions.
+    rx_session_t*     session[2]; // Indexed by the protocol version; NULL until looked up.
+} rx_memo_t;
+
+static void rx_memo_load(canard_t* const self, rx_memo_t* const memo, const uint32_t can_id)
+{
+    memo->can_id     = can_id;
+    memo->epoch      = self->rx.epoch;
+    memo->session[0] = NULL;
+    memo->session[1] = NULL;
+    rx_route_resolve(self, can_id, &memo->route);
+}
+
+static void ingest_frame(canard_t* const      self,
+                         const canard_us_t    timestamp,
+                         const byte_t         iface_index,
+                         const frame_t* const frame,
+                         rx_memo_t* const     memo)
 {
+    const byte_t version = canard_kind_version(frame->kind);
+    CANARD_ASSERT(version < 2U);
     // Update the node-ID occupancy/collision before routing. Only on start frames to manage load.
-    if (frame.start) {
-        node_id_occupancy_update(self, frame.src);
+    if (frame->start) {
+        node_id_occupancy_update(self, frame->src);
+    }
+    // Re-resolve the route if it may have been invalidated by a subscription or node-ID change.
+    if (memo->epoch != self->rx.epoch) {
+        rx_memo_load(self, memo, memo->can_id);
     }
-    // Route the frame to the appropriate destination internally.
-    canard_subscription_t* const sub = rx_route(self, &frame);
+    canard_subscription_t* const sub = memo->route.version[version].subscription;
     if (sub != NULL) {
-        rx_session_update(sub, timestamp, &frame, iface_index);
+        rx_session_update(sub, timestamp, frame, iface_index, &memo->session[version]);
+    }
+}
+
+// The arguments shall be validated by the caller.
+static void ingest(canard_t* const          self,
+                   const canard_us_t        timestamp,
+                   const byte_t             iface_index,
+                   const uint32_t           extended_can_id,
+                   const canard_bytes_t     can_data,
+                   const canard_rx_buffer_t buffer,
+                   rx_memo_t* const         memo)
+{
+    if ((memo->can_id != extended_can_id) || (memo->epoch != self->rx.epoch)) {
+        rx_memo_load(self, memo, extended_can_id);
+    }
+    frame_t      frs[2];
+    const byte_t protocols = (byte_t)~self->protocols_disabled;
+    const byte_t parsed    = rx_parse_frame(extended_can_id, can_data, &memo->route, protocols, &frs[0], &frs[1]);
+    if (parsed == 0) {
+        self->err.rx_frame++;
+    }
+    frs[0].buffer = buffer;
+    frs[1].buffer = buffer;
+    if ((parsed & 1U) != 0) {
+        CANARD_ASSERT(canard_kind_version(frs[0].kind) == 0);
+        ingest_frame(self, timestamp, iface_index, &frs[0], memo);
     }
+    if ((parsed & 2U) != 0) {
+        CANARD_ASSERT(canard_kind_version(frs[1].kind) == 1);
+        ingest_frame(self, timestamp, iface_index, &frs[1], memo);
+    }
+}
+
+static bool ingest_args_valid(const canard_us_t        timestamp,
+                              const uint_least8_t      iface_index,
+                              const uint32_t           extended_can_id,
+                              const canard_bytes_t     can_data,
+                              const canard_rx_buffer_t buffer)
+{
+    return (timestamp >= 0) && (iface_index < CANARD_IFACE_COUNT) && (extended_can_id <= CAN_EXT_ID_MASK) &&
+           ((can_data.size == 0) || (can_data.data != NULL)) &&
+           ((buffer.vtable == NULL) || ((buffer.vtable->retain != NULL) && (buffer.vtable->release != NULL)));
 }
 
 bool canard_ingest_frame(canard_t* const      self,
@@ -2074,26 +4918,48 @@ bool canard_ingest_frame(canard_t* const      self,
                          const uint32_t       extended_can_id,
                          const canard_bytes_t can_data)
 {
-    const bool ok = (self != NULL) && (timestamp >= 0) && (iface_index < CANARD_IFACE_COUNT) &&
-                    (extended_can_id <= CAN_EXT_ID_MASK) && ((can_data.size == 0) || (can_data.data != NULL));
+    const canard_rx_buffer_t none = { .vtable = NULL, .context = NULL };
+    return canard_ingest_frame_retainable(self, timestamp, iface_index, extended_can_id, can_data, none);
+}
+
+bool canard_ingest_frame_retainable(canard_t* const          self,
+                                    const canard_us_t        timestamp,
+                                    const uint_least8_t      iface_index,
+                                    const uint32_t           extended_can_id,
+                                    const canard_bytes_t     can_data,
+                                    const canard_rx_buffer_t buffer)
+{
+    const bool ok = (self != NULL) && ingest_args_valid(timestamp, iface_index, extended_can_id, can_data, buffer);
     if (ok) {
-        frame_t      frs[2] = { { 0 }, { 0 } };
-        const byte_t parsed = rx_parse(extended_can_id, can_data, &frs[0], &frs[1]);
-        if (parsed == 0) {
-            self->err.rx_frame++;
-        }
-        if ((parsed & 1U) != 0) {
-            CANARD_ASSERT(canard_kind_version(frs[0].kind) == 0);
-            ingest_frame(self, timestamp, iface_index, frs[0]);
-        }
-        if ((parsed & 2U) != 0) {
-            CANARD_ASSERT(canard_kind_version(frs[1].kind) == 1);
-            ingest_frame(self, timestamp, iface_index, frs[1]);
-        }
+        rx_memo_t memo = { .can_id = UINT32_MAX };
+        ingest(self, timestamp, iface_index, extended_can_id, can_data, buffer, &memo);
     }
     return ok;
 }
 
+size_t canard_ingest_frames(canard_t* const self, const size_t count, const canard_frame_t* const frames)
+{
+    size_t processed = 0;
+    if ((self != NULL) && (frames != NULL)) {
+        rx_memo_t memo = { .can_id = UINT32_MAX };
+        for (size_t i = 0; i < count; i++) {
+            const canard_frame_t* const fr = &frames[i];
+            if (ingest_args_valid(fr->timestamp, fr->iface_index, fr->extended_can_id, fr->can_data, fr->buffer)) {
+                ingest(self, fr->timestamp, fr->iface_index, fr->extended_can_id, fr->can_data, fr->buffer, &memo);
+                processed++;
+            }
+        }
+    }
+    return processed;
+}
+
+void canard_payload_chain_free(canard_t* const self, const canard_payload_chain_t payload)
+{
+    if ((self != NULL) && (payload.head != NULL)) {
+        rx_fragment_free(self, (rx_fragment_t*)ptr_unbias(payload.head, offsetof(rx_fragment_t, link)));
+    }
+}
+
 uint16_t canard_v0_crc_seed_from_data_type_signature(const uint64_t data_type_signature)
 {
     uint16_t crc = CRC_INITIAL;
@@ -57,6 +57,136 @@ extern "C"
 #endif
 #define CANARD_IFACE_BITMAP_ALL ((1U << CANARD_IFACE_COUNT) - 1U)
 
+/// Received frames are routed via a small direct-mapped cache indexed by the CAN ID, where the priority and the
+/// source node-ID are disregarded. A hit avoids the CAN ID parsing and the subscription lookup; the cache holds
+/// negative entries for CAN IDs that have no subscriber as well. The cache is stored inside canard_t;
+/// each entry takes approx. 40 bytes on a 64-bit platform. See canard_t::rx for the hit/miss counters.
+/// The value must be a power of two; zero disables the cache.
+#ifndef CANARD_RX_ROUTE_CACHE_SIZE
+#define CANARD_RX_ROUTE_CACHE_SIZE 16U
+#endif
+#if (CANARD_RX_ROUTE_CACHE_SIZE > 65536) || ((CANARD_RX_ROUTE_CACHE_SIZE & (CANARD_RX_ROUTE_CACHE_SIZE - 1)) != 0)
+#error "CANARD_RX_ROUTE_CACHE_SIZE must be zero or a power of two not greater than 65536"
+#endif
+
+/// The subscriptions are indexed by port-ID in AVL trees, so that the lookup takes logarithmic time.
+/// If this option is enabled, the subscriptions are additionally indexed in two-level radix tables with 256-entry
+/// leaves for constant-time lookup, which is beneficial when there are hundreds of subscriptions.
+/// The tables are allocated on demand using canard_mem_set_t::rx_payload and released when no longer needed,
+/// so the memory cost is proportional to the number of distinct 256-port-ID blocks in use per transfer kind;
+/// e.g., a leaf takes 2 KiB on a 64-bit platform.
+#ifndef CANARD_RX_SUBSCRIPTION_TABLE
+#define CANARD_RX_SUBSCRIPTION_TABLE 0
+#endif
+
+/// Stale RX sessions and in-progress reassembly slots are reclaimed by canard_poll() using a hashed timer wheel,
+/// where each session is filed under the tick of its earliest pending expiry event. Each poll visits only the buckets
+/// of the ticks elapsed since the previous poll, so the work is proportional to the number of expired sessions plus
+/// the sessions that share a bucket with them but are due in a later rotation of the wheel.
+/// The wheel is stored inside canard_t; each bucket takes two pointers. The size must be a power of two.
+/// The tick should be comparable to the shortest transfer-ID timeout in use; one rotation of the wheel should span
+/// a typical transfer-ID timeout to keep the number of sessions skipped per bucket visit low.
+#ifndef CANARD_RX_WHEEL_SIZE
+#define CANARD_RX_WHEEL_SIZE 16U
+#endif
+#if (CANARD_RX_WHEEL_SIZE < 1) || (CANARD_RX_WHEEL_SIZE > 256) || \
+  ((CANARD_RX_WHEEL_SIZE & (CANARD_RX_WHEEL_SIZE - 1)) != 0)
+#error "CANARD_RX_WHEEL_SIZE must be a power of two between 1 and 256"
+#endif
+#ifndef CANARD_RX_WHEEL_TICK_us
+#define CANARD_RX_WHEEL_TICK_us 250000L
+#endif
+#if CANARD_RX_WHEEL_TICK_us < 1
+#error "CANARD_RX_WHEEL_TICK_us must be positive"
+#endif
+
+/// The enqueued TX transfers are indexed by deadline for expiration. By default, the index is an AVL tree, which
+/// costs a logarithmic-time insertion and removal per transfer. If this option is nonzero, a timer wheel of the
+/// specified number of buckets is used instead, where each transfer is filed under the tick of its deadline and the
+/// buckets are kept sorted by deadline. With mostly monotonic deadlines, this makes insertion and removal
+/// constant-time and expiration amortized constant-time per transfer, which is beneficial when thousands of
+/// short-deadline transfers are queued. One rotation of the wheel should span the typical transmission deadline,
+/// otherwise the transfers due in later rotations share buckets and make insertion costlier.
+/// The wheel is stored inside canard_t; each bucket takes two pointers.
+/// The value must be a power of two; zero selects the AVL tree.
+#ifndef CANARD_TX_DEADLINE_WHEEL_SIZE
+#define CANARD_TX_DEADLINE_WHEEL_SIZE 0U
+#endif
+#if (CANARD_TX_DEADLINE_WHEEL_SIZE > 65536) || \
+  ((CANARD_TX_DEADLINE_WHEEL_SIZE & (CANARD_TX_DEADLINE_WHEEL_SIZE - 1)) != 0)
+#error "CANARD_TX_DEADLINE_WHEEL_SIZE must be zero or a power of two not greater than 65536"
+#endif
+#ifndef CANARD_TX_DEADLINE_WHEEL_TICK_us
+#define CANARD_TX_DEADLINE_WHEEL_TICK_us 1000L
+#endif
+#if CANARD_TX_DEADLINE_WHEEL_TICK_us < 1
+#error "CANARD_TX_DEADLINE_WHEEL_TICK_us must be positive"
+#endif
+
+/// By default, every TX frame is a separate allocation from the tx_frame memory resource, so a multi-frame transfer
+/// costs one allocation and one deallocation per frame. If this option is enabled, all frames of a multi-frame
+/// transfer are carved out of a single tx_frame allocation sized for the whole transfer, which is released when the
+/// last of its frames is released. The frames are still reference-counted individually, so canard_refcount_inc() and
+/// canard_refcount_dec() work as usual, but a retained frame keeps the memory of the entire transfer alive.
+/// If the block cannot be allocated, the frames are allocated one by one as usual. Single-frame transfers are
+/// unaffected. Each frame carries one extra pointer of overhead.
+#ifndef CANARD_TX_CONTIGUOUS_SPOOL
+#define CANARD_TX_CONTIGUOUS_SPOOL 0
+#endif
+
+/// A single-frame TX transfer takes two allocations: the transfer object from tx_transfer and the frame from tx_frame.
+/// If this option is nonzero, the transfer object embeds storage for one frame of up to the specified size
+/// (payload and tail byte), which single-frame transfers use if they fit, halving the allocator traffic for them.
+/// The transfer object grows by this size plus the frame header (two words), so the value should be chosen to keep it
+/// within the same allocator block; e.g., 8 fits all Classic CAN frames and 64 fits all CAN FD frames.
+/// A frame retained via canard_refcount_inc() keeps the transfer object allocated until it is released.
+#ifndef CANARD_TX_INLINE_FRAME_SIZE
+#define CANARD_TX_INLINE_FRAME_SIZE 0U
+#endif
+#if CANARD_TX_INLINE_FRAME_SIZE > 64
+#error "CANARD_TX_INLINE_FRAME_SIZE must not exceed the CAN FD MTU"
+#endif
+
+/// The maximum number of frames passed to the tx_batch() vtable function per call, see canard_vtable_t.
+/// The frame descriptors are collected on the stack of canard_poll(); each takes 40 bytes on a 64-bit platform.
+/// Up to this many frames of a lazy transfer may be generated ahead of the transmission to fill a batch.
+#ifndef CANARD_TX_BATCH_SIZE
+#define CANARD_TX_BATCH_SIZE 8U
+#endif
+#if (CANARD_TX_BATCH_SIZE < 1) || (CANARD_TX_BATCH_SIZE > 255)
+#error "CANARD_TX_BATCH_SIZE must be in [1, 255]"
+#endif
+
+/// If enabled, every TX transfer records the time when it was enqueued and when its first and last frames were
+/// submitted, which are reported via the tx_done() vtable function, see canard_vtable_t; otherwise, those times are
+/// reported as negative values. The transfer object grows by three timestamps (24 bytes), and the now() vtable
+/// function is invoked on enqueueing, on the first frame submission, and on each interface completion of a transfer
+/// while tx_done() is set. The other information is reported regardless of this option at no extra cost.
+#ifndef CANARD_TX_TIMESTAMPS
+#define CANARD_TX_TIMESTAMPS 0
+#endif
+
+/// Either protocol version can be excluded at build time. For example, a pure Cyphal node can set CANARD_ENABLE_V0=0
+/// to drop the UAVCAN v0 (DroneCAN) CAN ID parsing, routing, acceptance filters, and TX serialization; this saves ROM
+/// and halves the parsing work per non-first frame, which otherwise has to be attempted as both versions.
+/// The functions of a disabled version remain declared but they treat every call as invalid.
+/// The enabled versions can be narrowed down further at runtime using canard_set_protocols().
+#ifndef CANARD_ENABLE_V0
+#define CANARD_ENABLE_V0 1
+#endif
+#ifndef CANARD_ENABLE_V1
+#define CANARD_ENABLE_V1 1
+#endif
+#if !CANARD_ENABLE_V0 && !CANARD_ENABLE_V1
+#error "At least one of CANARD_ENABLE_V0 and CANARD_ENABLE_V1 must be nonzero"
+#endif
+
+/// The maximum number of size classes in canard_slab_t. Each class takes approx. 56 bytes on a 64-bit platform.
+/// One class is needed per distinct subscription extent (see canard_slab_t); other sizes bypass the slab.
+#ifndef CANARD_SLAB_CLASS_COUNT
+#define CANARD_SLAB_CLASS_COUNT 8U
+#endif
+
 /// Parameter ranges are inclusive; the lower bound is zero for all.
 #define CANARD_SUBJECT_ID_MAX     0xFFFFU // Applies to Cyphal v1.1 and UAVCAN v0/DroneCAN message data type IDs.
 #define CANARD_SUBJECT_ID_MAX_13b 8191U   // Cyphal v1.0 supports only 13-bit subject-IDs.
@@ -109,6 +239,12 @@ static inline uint_least8_t canard_kind_version(const canard_kind_t kind)
     return (kind < canard_kind_v0_message) ? 1 : 0;
 }
 
+/// Protocol version bits as used by canard_set_protocols(); bit N stands for canard_kind_version()==N.
+/// CANARD_PROTOCOL_ALL contains the versions enabled at build time.
+#define CANARD_PROTOCOL_V0  1U
+#define CANARD_PROTOCOL_V1  2U
+#define CANARD_PROTOCOL_ALL ((CANARD_ENABLE_V0 ? 1U : 0U) | (CANARD_ENABLE_V1 ? 2U : 0U))
+
 typedef struct canard_t canard_t;
 
 /// Monotonic time in microseconds; the current time is never negative.
@@ -132,6 +268,37 @@ typedef enum canard_prio_t
 #define CANARD_PRIO_COUNT 8U
 #define CANARD_PRIO_BITS  3U
 
+/// When the TX queue is full, enqueued transfers are sacrificed to make room for a new one; see tx.sacrifice_policy.
+/// The default policy evicts the oldest transfers one by one until there is enough room or nothing is left to evict.
+/// Under the other policies, the new transfer is a candidate as well, and all victims are chosen before any of them
+/// is removed: if the policy chooses the new transfer before enough room is made, or if the eligible transfers cannot
+/// make enough room (e.g., because the driver still holds their frames), the new transfer is rejected (counted as
+/// err.tx_capacity) and the enqueued transfers are left intact.
+/// If per-priority quotas are configured (see tx.queue_reserve), only the transfers whose removal makes room for
+/// the new one are considered.
+/// The selection takes constant time, except for the latest-deadline policy, which is logarithmic in the number of
+/// enqueued transfers, or proportional to CANARD_TX_DEADLINE_WHEEL_SIZE if the deadline wheel is used; with quotas,
+/// it is also proportional to the number of transfers with a later deadline that are skipped. Under the non-default
+/// policies, each selection also skips the victims chosen before it, and counting the frames a victim would free
+/// is linear in its frame count.
+typedef enum canard_tx_sacrifice_policy_t
+{
+    canard_tx_sacrifice_oldest                 = 0, ///< The oldest enqueued transfer regardless of priority (default).
+    canard_tx_sacrifice_lowest_priority        = 1, ///< The transfer that would be transmitted last.
+    canard_tx_sacrifice_latest_deadline        = 2, ///< The transfer with the latest deadline.
+    canard_tx_sacrifice_oldest_lowest_priority = 3, ///< The oldest transfer at the lowest priority level.
+} canard_tx_sacrifice_policy_t;
+
+/// The reason why a TX transfer has left the queue, as reported via the tx_done() vtable function.
+typedef enum canard_tx_outcome_t
+{
+    canard_tx_outcome_completed  = 0, ///< Transmitted via all of its interfaces.
+    canard_tx_outcome_expired    = 1, ///< The deadline has passed before the transmission was completed.
+    canard_tx_outcome_sacrificed = 2, ///< Removed to make room for another one, see canard_tx_sacrifice_policy_t.
+    canard_tx_outcome_superseded = 3, ///< Replaced by a newer transfer, see canard_publish_16b_latest().
+    canard_tx_outcome_canceled   = 4, ///< Canceled on node-ID change or by canard_destroy().
+} canard_tx_outcome_t;
+
 typedef struct canard_tree_t
 {
     struct canard_tree_t* up;
@@ -201,6 +368,37 @@ typedef struct canard_payload_t
     canard_bytes_mut_t origin; ///< Use this to free the memory, unless NULL/empty.
 } canard_payload_t;
 
+/// Represents received transfer payload delivered without reassembly copying; see on_message_chain.
+/// The fragments reference the CAN frame buffers retained by the library (see canard_rx_buffer_t), with the tail bytes
+/// and the transfer CRC excluded; fragments of frames that were ingested without a retainable buffer hold a copy.
+/// The chain is owned by the application and shall be released using canard_payload_chain_free().
+typedef struct canard_payload_chain_t
+{
+    size_t                      size; ///< Total size of the payload across all fragments.
+    const canard_bytes_chain_t* head; ///< The first fragment; NULL if the payload is empty.
+} canard_payload_chain_t;
+
+/// A reference-counted CAN frame buffer owned by the driver, such as an entry of a DMA ring buffer.
+/// Frames ingested with a buffer can be retained by the library until the transfer they belong to is consumed,
+/// which enables zero-copy reassembly of multi-frame transfers (see on_message_chain).
+/// The library invokes retain() when it keeps a reference to the frame data beyond the ingestion call, and release()
+/// exactly once per retain() when the reference is dropped; the data must remain valid and unmodified until then.
+/// The functions may be invoked from any library function that takes canard_t, including canard_payload_chain_free().
+/// A buffer with a NULL vtable is not retainable; this is also what zero-initialization yields.
+/// Like canard_mem_t, this is passed by value.
+typedef struct canard_rx_buffer_t        canard_rx_buffer_t;
+typedef struct canard_rx_buffer_vtable_t canard_rx_buffer_vtable_t;
+struct canard_rx_buffer_vtable_t
+{
+    void (*retain)(canard_rx_buffer_t);
+    void (*release)(canard_rx_buffer_t);
+};
+struct canard_rx_buffer_t
+{
+    const canard_rx_buffer_vtable_t* vtable;
+    void*                            context;
+};
+
 /// The filter only matches extended CAN IDs on data frames (no std/rtr). Bits above 29 are always zero.
 typedef struct canard_filter_t
 {
@@ -208,15 +406,36 @@ typedef struct canard_filter_t
     uint32_t extended_mask;
 } canard_filter_t;
 
+/// A received CAN frame as passed to canard_ingest_frames(); the fields match the arguments of canard_ingest_frame().
+typedef struct canard_frame_t
+{
+    canard_us_t        timestamp;
+    uint_least8_t      iface_index;
+    uint32_t           extended_can_id;
+    canard_bytes_t     can_data;
+    canard_rx_buffer_t buffer; ///< Optional, see canard_ingest_frame_retainable(); zero if not retainable.
+} canard_frame_t;
+
+/// A TX frame as passed to the tx_batch() vtable function; the fields match the arguments of the tx() function.
+typedef struct canard_tx_frame_t
+{
+    void*          user_context;
+    canard_us_t    deadline;
+    bool           fd;
+    uint32_t       extended_can_id;
+    canard_bytes_t can_data;
+} canard_tx_frame_t;
+
 /// Each resource is used for allocating memory for a specific purpose.
 /// This enables fine-tuning in memory-conscious applications.
 /// Ordinary applications can use the same resource for everything; alloc/free are assumed O(1) [e.g., use o1heap].
+/// The rx_payload allocations can be pooled per subscription extent using canard_slab_t.
 typedef struct canard_mem_set_t
 {
     canard_mem_t tx_transfer; ///< TX transfer objects, fixed-size, one per enqueued transfer.
-    canard_mem_t tx_frame;    ///< One per enqueued frame, at least one per TX transfer, size MTU+overhead.
+    canard_mem_t tx_frame;    ///< Per enqueued frame (MTU+overhead); also CANARD_TX_CONTIGUOUS_SPOOL and lazy TX.
     canard_mem_t rx_session;  ///< Remote-associated sessions per subscriber, fixed-size.
-    canard_mem_t rx_payload;  ///< Variable-size, max size approx. extent+sizeof(rx_slot_t).
+    canard_mem_t rx_payload;  ///< Variable-size: payloads (approx. extent+sizeof(rx_slot_t)) and RX index tables.
     canard_mem_t rx_filters;  ///< For canard_filter_t[filter_count] temporary storage. Not needed if filters not used.
 } canard_mem_set_t;
 
@@ -234,11 +453,26 @@ struct canard_subscription_vtable_t
                        uint_least8_t          source_node_id,
                        uint_least8_t          transfer_id,
                        canard_payload_t       payload);
+
+    /// Optional zero-copy delivery of multi-frame transfers; leave NULL to reassemble them into contiguous buffers.
+    /// If set, multi-frame transfers are delivered here instead of on_message, while single-frame transfers are still
+    /// delivered via on_message. The payload is not copied into an extent-sized buffer; instead, the frames are
+    /// retained (see canard_ingest_frame_retainable()) and chained, the CRC is verified in place, and the chain is
+    /// truncated at the extent. No memory is allocated per transfer except for one small fragment object per frame,
+    /// plus a copy of the payload for frames ingested without a retainable buffer.
+    /// The other semantics, including the timestamp and the reentrancy constraints, are the same as for on_message.
+    void (*on_message_chain)(canard_subscription_t* self,
+                             canard_us_t            timestamp,
+                             canard_prio_t          priority,
+                             uint_least8_t          source_node_id,
+                             uint_least8_t          transfer_id,
+                             canard_payload_chain_t payload);
 };
 
 /// Subscription instances must not be moved while in use.
-/// Each subscription is indexed by its port-ID inside the canard instance, and in turn contains a tree of sessions
-/// indexed by remote node-ID. Two log-time lookups are thus required to handle an incoming frame.
+/// Each subscription is indexed by its port-ID inside the canard instance, and in turn contains a table of sessions
+/// indexed by remote node-ID. A log-time and a constant-time lookup are thus required to handle an incoming frame;
+/// the first one is also constant-time if CANARD_RX_SUBSCRIPTION_TABLE is enabled.
 /// None of the fields may be mutated by the application after initialization except for the user context and extent.
 struct canard_subscription_t
 {
@@ -250,13 +484,45 @@ struct canard_subscription_t
     uint16_t      crc_seed; ///< For v0 this is set at subscription time, for v1 this is always 0xFFFF.
     canard_kind_t kind;
 
-    canard_t*                           owner;
-    canard_tree_t*                      sessions;
+    canard_t* owner;
+
+    /// Per-remote sessions indexed by node-ID: bit N of the bitmap is set iff there is a session for remote node N,
+    /// which is then found in the array at the index equal to the number of set bits below N (i.e., its rank).
+    /// The array is allocated using canard_mem_set_t::rx_payload and grows/shrinks geometrically; NULL if empty.
+    uint64_t      session_bitmap[2];
+    void**        sessions;
+    uint_least8_t session_capacity;
+
+    /// Capacity reserved using canard_subscription_reserve(); zero if the general memory resources are used.
+    /// The unused reserved sessions and slots are kept in singly-linked free lists.
+    size_t reserved_sessions;
+    size_t reserved_slots;
+    size_t reserved_slot_size; ///< The slots of other sizes, caused by a later change of the extent, are not pooled.
+    void*  free_sessions;
+    void*  free_slots;
+
     const canard_subscription_vtable_t* vtable;
 
     void* user_context;
 };
 
+/// The outcome of parsing the CAN ID of a received frame and routing it to the matching subscription.
+/// Both protocol versions are represented because the version cannot be detected from the CAN ID alone.
+/// This is used internally by the library; the application should not access it.
+typedef struct canard_rx_route_t
+{
+    uint32_t key; ///< The CAN ID sans priority and source node-ID with a few flag bits; zero if the entry is empty.
+    struct
+    {
+        canard_subscription_t* subscription; ///< NULL if no matching subscription.
+        canard_kind_t          kind;
+        uint16_t               port_id;
+        uint_least8_t          dst;       ///< CANARD_NODE_ID_ANONYMOUS if not a service transfer.
+        bool                   anonymous; ///< The source is anonymous, so only single-frame transfers are valid.
+        bool                   valid;     ///< The CAN ID is valid for this version, excepting the source checks.
+    } version[2];
+} canard_rx_route_t;
+
 typedef struct canard_vtable_t
 {
     /// The current monotonic time in microseconds. Must be a non-negative non-decreasing value.
@@ -282,6 +548,51 @@ typedef struct canard_vtable_t
     /// This function is only invoked from canard_poll().
     /// Returns true on success, false on failure.
     bool (*filter)(canard_t*, size_t filter_count, const canard_filter_t* filters);
+
+    // Optional extensions; new members are appended here so that the existing initializers remain valid.
+
+    /// Like tx(), but the frame data is given as a chain of fragments whose concatenation is the frame.
+    /// Used only for the frames of zero-copy transfers, see canard_publish_16b_zero_copy(). The fragments reference
+    /// the application payload, except for the last one, which holds the frame trailer (padding, CRC, tail byte);
+    /// if the payload part of the frame is scattered across too many fragments, the whole frame is passed as one
+    /// copied fragment instead. At most four fragments are passed. Only the payload fragments remain valid after the
+    /// call (until the transfer is released); the trailer, the copied frame, and the chain nodes do not.
+    /// The frames cannot be retained via canard_refcount_inc(). The contract is the same as tx() otherwise.
+    /// This function may be NULL, in which case the frames of zero-copy transfers are copied and submitted via tx().
+    bool (*tx_gather)(canard_t*,
+                      void*                user_context,
+                      canard_us_t          deadline,
+                      uint_least8_t        iface_index,
+                      bool                 fd,
+                      uint32_t             extended_can_id,
+                      canard_bytes_chain_t can_data);
+
+    /// Like tx(), but submits several frames at once, which allows the driver to use vectored I/O such as sendmmsg()
+    /// or to load multiple hardware mailboxes in one go. The frames are ready for transmission via the specified
+    /// interface and are given in the transmission order, possibly spanning several transfers; there are at least one
+    /// and at most CANARD_TX_BATCH_SIZE of them. Returns the number of frames accepted from the beginning of the
+    /// array, which shall not exceed the count; accepting fewer frames than given means that there are no more free
+    /// mailboxes, like tx() returning false, and the rest will be offered again later. The contract is the same as
+    /// tx() otherwise. This function may be NULL; if not, it is used instead of tx() for all frames except those
+    /// passed to tx_gather(), which are submitted one by one.
+    size_t (*tx_batch)(canard_t*, uint_least8_t iface_index, const canard_tx_frame_t* frames, size_t count);
+
+    /// Invoked once per enqueued transfer when it leaves the queue for any reason, which allows the application to
+    /// measure the queueing and transmission latencies and to implement flow control without polling the queue.
+    /// The timestamps are those of the enqueueing, of the submission of the first frame via any interface, and of the
+    /// submission of the last frame via the last interface that has completed the transmission; those not
+    /// applicable (e.g., nothing has been submitted before expiration) or not recorded are negative, see
+    /// CANARD_TX_TIMESTAMPS. The iface_bitmap contains the interfaces that have completed the transmission, which
+    /// may be a subset of the enqueued ones unless the outcome is canard_tx_outcome_completed.
+    /// Frames retained via canard_refcount_inc() are not affected. The callback must not mutate the TX pipeline.
+    /// This function may be NULL if the notifications are not needed.
+    void (*tx_done)(canard_t*,
+                    void*               user_context,
+                    canard_tx_outcome_t outcome,
+                    canard_us_t         enqueue_ts,
+                    canard_us_t         first_frame_ts,
+                    canard_us_t         last_frame_ts,
+                    uint_least8_t       iface_bitmap);
 } canard_vtable_t;
 
 /// Main instance object. Usage: new -> subscribe/publish/ingest/poll -> unsubscribe/destroy.
@@ -301,6 +612,10 @@ struct canard_t
     /// Bitmap of interfaces available on this node; the enqueue interface bitmap is ANDed with it. Zero is listen-only.
     uint_least8_t iface_bitmap;
 
+    /// Bitmap of the protocol versions disabled at runtime (CANARD_PROTOCOL_*); zero by default.
+    /// Use canard_set_protocols() to change it. The versions disabled at build time are not included.
+    uint_least8_t protocols_disabled;
+
     struct
     {
         /// By default, CAN FD mode is used; this flag can be used to change the mode to Classic CAN if needed;
@@ -323,20 +638,70 @@ struct canard_t
         size_t queue_capacity;
         size_t queue_size;
 
+        /// Optional per-priority frame quotas indexed by canard_prio_t, which guarantee queue space for critical
+        /// traffic under load without over-provisioning the whole queue. A transfer may use the space reserved for
+        /// its priority level and the unreserved space, but not the unused reservations of the other levels;
+        /// the reservations should add up to at most queue_capacity. A transfer that would take its level above
+        /// the limit is treated as if the queue was full, except that only transfers of the same level are
+        /// sacrificed for it. Changes take full effect once the queue has drained.
+        /// canard_new() sets no reservations and all limits to queue_capacity, which disables the quotas.
+        size_t queue_reserve[CANARD_PRIO_COUNT];
+        size_t queue_limit[CANARD_PRIO_COUNT];
+        size_t queue_size_by_prio[CANARD_PRIO_COUNT]; ///< Same as queue_size, per priority level.
+
         /// Incremented with every enqueued transfer. Used internally but also works as a stats counter.
         uint64_t seqno;
 
-        canard_tree_t* pending[CANARD_IFACE_COUNT]; ///< Next to transmit on the left.
-        canard_tree_t* deadline;                    ///< Soonest to expire on the left.
-        canard_list_t  agewise;                     ///< ALL transfers FIFO, oldest at the head.
+        /// Incremented with every enqueued transfer replaced by a newer one; see canard_publish_16b_latest().
+        uint64_t coalesced;
+
+        /// Chooses the transfers to sacrifice when the queue is full; the oldest one by default.
+        /// The policy can be changed at any time.
+        canard_tx_sacrifice_policy_t sacrifice_policy;
+
+        /// Used internally to mark the transfers chosen to be sacrificed.
+        uint16_t sacrifice_epoch;
+
+        /// Per interface, bucketed by priority; each bucket is in the arbitration order with the next to transmit
+        /// at the head, and is indexed by the last transfer of each CAN ID in it.
+        /// The bitmaps have a bit set per nonempty bucket.
+        canard_list_t  pending[CANARD_IFACE_COUNT][CANARD_PRIO_COUNT];
+        canard_tree_t* pending_by_can_id[CANARD_IFACE_COUNT][CANARD_PRIO_COUNT];
+        uint_least8_t  pending_prio_bitmap[CANARD_IFACE_COUNT];
+#if CANARD_TX_DEADLINE_WHEEL_SIZE > 0
+        canard_list_t deadline[CANARD_TX_DEADLINE_WHEEL_SIZE]; ///< Bucketed by the tick of the deadline.
+        int64_t       deadline_tick; ///< The earliest tick that may have unprocessed transfers.
+#else
+        canard_tree_t* deadline; ///< Soonest to expire on the left.
+#endif
+        canard_list_t agewise;                            ///< ALL transfers FIFO, oldest at the head.
+        canard_list_t agewise_by_prio[CANARD_PRIO_COUNT]; ///< Same but per priority level.
     } tx;
 
     struct
     {
         canard_tree_t* subscriptions[CANARD_KIND_COUNT];
-        canard_list_t  list_session_by_animation; ///< Oldest at the head.
+        canard_list_t  wheel[CANARD_RX_WHEEL_SIZE]; ///< Sessions bucketed by the tick of their next expiry event.
+        int64_t        wheel_tick;                  ///< The earliest tick that may have unprocessed sessions.
         size_t         filter_count;
         bool           filters_dirty; ///< Set when subscribed/unsubscribed or node-ID is changed.
+        uint32_t       epoch;         ///< Incremented when the routing may change or an RX session is destroyed.
+
+        /// The reserved slot lent to on_message for the duration of the callback, and the subscription owning it.
+        /// The slot is returned to the subscription after the callback unless the subscription is removed inside.
+        void*                  lent_slot;
+        canard_subscription_t* lent_slot_owner;
+
+        /// Route cache statistics. The counters are never reset by the library; the application may reset them.
+        /// If the hit rate is low while the number of CAN IDs on the bus is moderate, consider a larger cache.
+        uint64_t route_cache_hits;
+        uint64_t route_cache_misses;
+#if CANARD_RX_ROUTE_CACHE_SIZE > 0
+        canard_rx_route_t route_cache[CANARD_RX_ROUTE_CACHE_SIZE];
+#endif
+#if CANARD_RX_SUBSCRIPTION_TABLE
+        canard_subscription_t*** subscription_table[CANARD_KIND_COUNT]; ///< Radix table roots; NULL if empty.
+#endif
     } rx;
 
     /// Error counters incremented automatically when the corresponding error condition occurs.
@@ -350,6 +715,9 @@ struct canard_t
         uint64_t rx_frame;      ///< A received frame was malformed and thus dropped.
         uint64_t rx_transfer;   ///< A transfer could not be reassembled correctly.
         uint64_t collision;     ///< Number of times the local node-ID was changed to repair a collision.
+
+        /// The tx_sacrifice counter broken down by the priority of the sacrificed transfers.
+        uint64_t tx_sacrifice_by_prio[CANARD_PRIO_COUNT];
     } err;
 
     canard_mem_set_t mem;
@@ -408,6 +776,15 @@ void canard_destroy(canard_t* const self);
 /// Returns false if any of the arguments are invalid.
 bool canard_set_node_id(canard_t* const self, const uint_least8_t node_id);
 
+/// Restricts the protocol versions in use to the given subset of CANARD_PROTOCOL_ALL, e.g., CANARD_PROTOCOL_V1.
+/// Received frames of the disabled versions are not parsed as such; since there is no reliable way to tell them apart
+/// from malformed frames, they may be counted in err.rx_frame. New subscriptions and transmissions of the disabled
+/// versions are rejected as invalid. Existing subscriptions and enqueued transfers are unaffected, except that
+/// the subscriptions of the disabled versions no longer receive transfers nor occupy acceptance filters.
+/// Filter reconfiguration is scheduled at next canard_poll().
+/// Returns false if any of the arguments are invalid, including an empty set or a version disabled at build time.
+bool canard_set_protocols(canard_t* const self, const uint_least8_t protocols);
+
 /// This must be invoked periodically to ensure liveliness.
 /// The function must be called asap once any of the interfaces for which there are pending outgoing transfers
 /// become writable, and not less frequently than once in a few milliseconds. The invocation rate defines the
@@ -432,6 +809,30 @@ bool canard_ingest_frame(canard_t* const      self,
                          const uint32_t       extended_can_id,
                          const canard_bytes_t can_data);
 
+/// Like canard_ingest_frame(), but the library may retain the buffer holding can_data instead of copying the data,
+/// if the frame is part of a multi-frame transfer received by a subscription that implements on_message_chain.
+/// The can_data must reside in the buffer. The driver may drop its own reference to the buffer after this returns.
+bool canard_ingest_frame_retainable(canard_t* const          self,
+                                    const canard_us_t        timestamp,
+                                    const uint_least8_t      iface_index,
+                                    const uint32_t           extended_can_id,
+                                    const canard_bytes_t     can_data,
+                                    const canard_rx_buffer_t buffer);
+
+/// Equivalent to invoking canard_ingest_frame() on each frame in the array in order, but cheaper per frame.
+/// This is intended for drivers that drain several frames from the hardware or the OS per wakeup.
+/// The instance is validated once per call; the routing and the remote session lookup are reused across
+/// consecutive frames sharing the same CAN ID, which is the common case for multi-frame transfers.
+/// Frames with invalid fields are skipped and do not affect the processing of the other frames.
+/// Returns the number of frames that were processed, or zero if self is NULL or frames is NULL.
+/// The frame buffers are retainable as in canard_ingest_frame_retainable(), unless the buffer vtable is NULL.
+/// The other semantics, including the callback reentrancy constraints, are the same as for canard_ingest_frame().
+size_t canard_ingest_frames(canard_t* const self, const size_t count, const canard_frame_t* const frames);
+
+/// Release a payload chain received via on_message_chain, including the references to the retained frame buffers.
+/// self shall own the rx_payload resource used to allocate the chain. No effect if the chain is empty.
+void canard_payload_chain_free(canard_t* const self, const canard_payload_chain_t payload);
+
 /// Retain a TX frame view obtained from tx() so it may outlive the callback and the TX queue entry.
 /// The retained view must be released before canard_destroy() is invoked on the owning instance.
 /// This is not applicable to RX payload views.
@@ -471,6 +872,188 @@ bool canard_publish_13b(canard_t* const            self,
                         const canard_bytes_chain_t payload,
                         void* const                user_context);
 
+/// Like canard_publish_16b()/canard_publish_13b(), but latest-value-wins, which is intended for high-rate state
+/// topics where only the newest sample matters. If the newest enqueued transfer of the same subject and priority
+/// targets the same interfaces and has not started transmission on any of them yet, it is dropped and the new one
+/// takes its place at the end of the queue, reusing the transfer object. This bounds the backlog of such a subject
+/// to one transfer per publication that actually reaches the bus, which cuts the queue memory and the staleness of
+/// the transmitted samples during bus congestion. The skipped transfer-IDs are seen by the receivers as lost.
+/// Replacements are counted in tx.coalesced. If the new transfer cannot be enqueued, the old one is lost as well.
+/// The added cost is logarithmic in the number of distinct subjects enqueued at the same priority level.
+bool canard_publish_16b_latest(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const canard_bytes_chain_t payload,
+                               void* const                user_context);
+bool canard_publish_13b_latest(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const canard_bytes_chain_t payload,
+                               void* const                user_context);
+
+/// Returns the payload of a lazy transfer to the application; see canard_publish_16b_lazy().
+/// The user_context is the one the transfer was enqueued with.
+typedef void (*canard_tx_release_t)(canard_t* self, void* user_context);
+
+/// Like canard_publish_16b()/canard_publish_13b(), but the frames of a multi-frame transfer are generated one at a
+/// time as the transmission progresses instead of all at once, so the TX memory needed for a large transfer does not
+/// grow with its size. The payload is referenced rather than copied: the chain and the data it points to shall stay
+/// valid and unchanged until release() is invoked, which happens exactly once, either when the last frame has been
+/// generated or when the transfer is removed from the queue for any reason (expiration, sacrifice, cancellation on
+/// node-ID change, canard_destroy()), whichever comes first. If false is returned, release() is not invoked and the
+/// payload is not referenced anymore. A payload that fits into a single frame is copied as usual and released before
+/// the function returns. The release may be NULL; it is invoked from within the library and shall not mutate the
+/// TX pipeline.
+///
+/// A lazy transfer takes one tx_frame allocation for its state plus at most one frame being transmitted and one
+/// ahead, as long as its interfaces progress at a similar pace; the frames not yet transmitted via a lagging
+/// interface are retained until it catches up. One TX queue slot is held for the next frame to keep the transfer
+/// from being starved by newer ones. If the next frame cannot be generated due to OOM (see err.oom) or lack of queue
+/// space, the interface stalls until the next canard_poll().
+bool canard_publish_16b_lazy(canard_t* const            self,
+                             const canard_us_t          deadline,
+                             const uint_least8_t        iface_bitmap,
+                             const canard_prio_t        priority,
+                             const uint16_t             subject_id,
+                             const uint_least8_t        transfer_id,
+                             const canard_bytes_chain_t payload,
+                             const canard_tx_release_t  release,
+                             void* const                user_context);
+bool canard_publish_13b_lazy(canard_t* const            self,
+                             const canard_us_t          deadline,
+                             const uint_least8_t        iface_bitmap,
+                             const canard_prio_t        priority,
+                             const uint16_t             subject_id,
+                             const uint_least8_t        transfer_id,
+                             const canard_bytes_chain_t payload,
+                             const canard_tx_release_t  release,
+                             void* const                user_context);
+
+/// Like canard_publish_16b_lazy()/canard_publish_13b_lazy(), but the frames reference the payload instead of
+/// holding a copy of it: only the trailer of each frame (padding, CRC, and the tail byte) is stored by the library, and
+/// the frames are submitted via the tx_gather() vtable function as fragment chains. Consequently, the payload shall
+/// stay valid and unchanged until the transfer is removed from the queue, which happens once every interface has
+/// ejected the last frame, or the transfer is expired, sacrificed, canceled on node-ID change, or destroyed; then
+/// release() is invoked exactly once. If tx_gather() is NULL, the frames are copied one at a time as with the lazy
+/// variant, but the payload is still held until the transfer is removed. Other semantics match the lazy variant,
+/// including the handling of single-frame payloads, which are copied and released at once.
+bool canard_publish_16b_zero_copy(canard_t* const            self,
+                                  const canard_us_t          deadline,
+                                  const uint_least8_t        iface_bitmap,
+                                  const canard_prio_t        priority,
+                                  const uint16_t             subject_id,
+                                  const uint_least8_t        transfer_id,
+                                  const canard_bytes_chain_t payload,
+                                  const canard_tx_release_t  release,
+                                  void* const                user_context);
+bool canard_publish_13b_zero_copy(canard_t* const            self,
+                                  const canard_us_t          deadline,
+                                  const uint_least8_t        iface_bitmap,
+                                  const canard_prio_t        priority,
+                                  const uint16_t             subject_id,
+                                  const uint_least8_t        transfer_id,
+                                  const canard_bytes_chain_t payload,
+                                  const canard_tx_release_t  release,
+                                  void* const                user_context);
+
+/// Supplies the payload of a streamed transfer piecewise; see canard_publish_16b_stream().
+/// Copies the payload bytes [offset, offset+size) into the destination, which has room for exactly that many, and
+/// returns true. The size never exceeds 63 bytes. If the data is not available yet, returns false; the same range
+/// is then requested again at the next canard_poll(). A range may be requested more than once, e.g., after an
+/// allocation failure, so the payload shall not change while the transfer is being streamed.
+typedef bool (*canard_tx_producer_t)(canard_t* self, void* user_context, size_t offset, size_t size, void* destination);
+
+/// Like canard_publish_16b_lazy()/canard_publish_13b_lazy(), but the payload is not held in memory at all: it is
+/// pulled from the producer one frame at a time as the transmission progresses, so a blob larger than the available
+/// RAM, e.g., a firmware image read from flash, can be sent as a single transfer. Only the payload size is needed
+/// upfront, as it determines the frame layout; the transfer CRC is computed incrementally. The producer is invoked
+/// from within this function for the first frame and from canard_poll() for the others; it shall not mutate the TX
+/// pipeline. If it cannot supply the first frame, the transfer is not enqueued and false is returned; later on, it
+/// merely stalls the interfaces until the next poll, while the deadline keeps running. The release() is invoked
+/// once the producer is no longer needed, following the rules of the lazy variant.
+///
+/// The memory held is that of the lazy variant plus a frame-sized buffer for the chunk being pulled. Long transfers
+/// need a deadline to match; use a low priority to avoid starving the other traffic.
+bool canard_publish_16b_stream(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const size_t               payload_size,
+                               const canard_tx_producer_t producer,
+                               const canard_tx_release_t  release,
+                               void* const                user_context);
+bool canard_publish_13b_stream(canard_t* const            self,
+                               const canard_us_t          deadline,
+                               const uint_least8_t        iface_bitmap,
+                               const canard_prio_t        priority,
+                               const uint16_t             subject_id,
+                               const uint_least8_t        transfer_id,
+                               const size_t               payload_size,
+                               const canard_tx_producer_t producer,
+                               const canard_tx_release_t  release,
+                               void* const                user_context);
+
+/// A transfer reserved for serialization in place; see canard_reserve_16b(). The payload is exposed as a sequence of
+/// writable spans that map directly onto the data regions of the frames, so the serializer writes straight into the
+/// frames and the payload is never copied. The spans are split at the frame boundaries, skipping the tail bytes.
+/// The fields other than span and offset are private.
+typedef struct canard_tx_reservation_t
+{
+    canard_bytes_mut_t span;   ///< The current span; empty past the end of the payload. Initially the first one.
+    size_t             offset; ///< The offset of the current span from the beginning of the payload.
+    size_t             size;   ///< The total payload size.
+    void*              transfer;
+    void*              spool;
+    void*              frame;
+    uint_least8_t      iface_bitmap;
+} canard_tx_reservation_t;
+
+/// Like canard_publish_16b()/canard_publish_13b(), but instead of taking the payload, allocates the frames for a
+/// payload of the specified size and stores the reservation at the specified pointer. The application then writes the
+/// payload into the spans, advancing with canard_reservation_next(), and finally either commits the reservation with
+/// canard_reservation_commit(), which fills in the CRC and enqueues the transfer, or cancels it with
+/// canard_reservation_cancel(). The span contents are unspecified until written; every byte shall be written before
+/// the commit. Until then the transfer is not in the queue, so it is neither transmitted nor expired nor sacrificed,
+/// but its frames count toward the queue size. Every reservation shall be committed or canceled before
+/// canard_destroy(). Failure modes match canard_publish_16b(); on failure, nothing is held.
+bool canard_reserve_16b(canard_t* const                self,
+                        canard_tx_reservation_t* const reservation,
+                        const canard_us_t              deadline,
+                        const uint_least8_t            iface_bitmap,
+                        const canard_prio_t            priority,
+                        const uint16_t                 subject_id,
+                        const uint_least8_t            transfer_id,
+                        const size_t                   payload_size,
+                        void* const                    user_context);
+bool canard_reserve_13b(canard_t* const                self,
+                        canard_tx_reservation_t* const reservation,
+                        const canard_us_t              deadline,
+                        const uint_least8_t            iface_bitmap,
+                        const canard_prio_t            priority,
+                        const uint16_t                 subject_id,
+                        const uint_least8_t            transfer_id,
+                        const size_t                   payload_size,
+                        void* const                    user_context);
+
+/// Advances the reservation to the next span. Returns false if the end of the payload is reached; the span is
+/// then empty. A payload that fits into a single frame is covered by one span.
+bool canard_reservation_next(canard_tx_reservation_t* const self);
+
+/// Completes the frames of a reservation (the CRC of a multi-frame transfer) and enqueues the transfer, which is then
+/// ordered after the transfers enqueued before the commit. The reservation is cleared; it cannot fail.
+void canard_reservation_commit(canard_t* const self, canard_tx_reservation_t* const reservation);
+
+/// Frees a reservation without transmitting anything. The reservation is cleared.
+void canard_reservation_cancel(canard_t* const self, canard_tx_reservation_t* const reservation);
+
 /// Enqueue a service request on all ifaces; other semantics, failure modes, and memory model match canard_publish().
 bool canard_request(canard_t* const            self,
                     const canard_us_t          deadline,
@@ -501,6 +1084,8 @@ bool canard_respond(canard_t* const            self,
 ///
 /// Returns the passed subscription on success, the incumbent if there is already a subscription for the same subject,
 /// or NULL if any of the arguments are invalid. Clobbers the passed subscription on failure.
+/// If CANARD_RX_SUBSCRIPTION_TABLE is enabled, this and the other subscription functions may also return NULL
+/// on memory exhaustion, which increments the OOM error counter.
 canard_subscription_t* canard_subscribe_16b(canard_t* const                           self,
                                             canard_subscription_t* const              subscription,
                                             const uint16_t                            subject_id,
@@ -537,8 +1122,33 @@ canard_subscription_t* canard_subscribe_response(canard_t* const
                                                  const size_t                              extent,
                                                  const canard_subscription_vtable_t* const vtable);
 
+/// Reserve the memory for the specified number of remote sessions and in-progress multi-frame transfers (slots)
+/// of the subscription up front, for deterministic latency of the reception path.
+/// Once reserved, the sessions and the slots of this subscription are taken only from the reserve, so that the
+/// general memory resources are not involved in the reception of the subscription at all, except for the fragments
+/// of on_message_chain, which are still allocated per frame. If the reserve is exhausted, the frames that need a new
+/// session or a new slot are dropped, and err.oom is incremented.
+/// The session array is pre-sized to accommodate the reserved sessions and it is not shrunk while reserved.
+/// Each session can have up to one slot per priority level in progress, so the number of slots needed is at most the
+/// number of sessions times the number of priority levels in use by the remotes.
+///
+/// Transfers reassembled in reserved slots are delivered via on_message with an empty payload origin; the payload
+/// view is valid only until the callback returns, after which the slot is put back into the reserve.
+/// The reserve is sized by the extent at the time of the call; if the extent is changed afterward,
+/// the new slots are allocated from canard_mem_set_t::rx_payload as if there was no slot reserve.
+///
+/// The sessions are allocated using canard_mem_set_t::rx_session and the slots using rx_payload.
+/// The reserve can be grown by calling this again; it is released when the subscription is removed.
+/// The sessions and slots that were allocated from the general resources before the call are returned there.
+/// Returns false if the arguments are invalid or on OOM; in the latter case, the reserve is left as it was before the
+/// call, although the session array may have been grown.
+bool canard_subscription_reserve(canard_t* const              self,
+                                 canard_subscription_t* const subscription,
+                                 const size_t                 sessions,
+                                 const size_t                 slots);
+
 /// Returns the installed subscription if found, otherwise NULL. Invalid kind values also return NULL.
-/// Complexity is log-time in the subscription set of the requested kind.
+/// Complexity is log-time in the subscription set of the requested kind, or constant if CANARD_RX_SUBSCRIPTION_TABLE.
 canard_subscription_t* canard_find_subscription(const canard_t* const self,
                                                 const canard_kind_t   kind,
                                                 const uint16_t        port_id);
@@ -547,6 +1157,65 @@ canard_subscription_t* canard_find_subscription(const canard_t* const self,
 /// Complexity is log-time in the subscription set plus linear in the number of remote sessions owned by it.
 void canard_unsubscribe(canard_t* const self, canard_subscription_t* const subscription);
 
+// ------------------------------------------------   Slab allocator   -------------------------------------------------
+
+/// The statistics of one size class of canard_slab_t.
+typedef struct canard_slab_stats_t
+{
+    uint64_t hits;       ///< Allocations served from the free list.
+    uint64_t misses;     ///< Allocations that had to be forwarded to the upstream resource.
+    size_t   in_use;     ///< Blocks currently allocated from the class.
+    size_t   in_use_max; ///< The high-water mark of in_use.
+    size_t   cached;     ///< Blocks in the free list, available without involving the upstream resource.
+} canard_slab_stats_t;
+
+typedef struct canard_slab_class_t
+{
+    size_t              size;      ///< Every block of the class is of this size exactly.
+    void*               free_list; ///< Singly-linked through the first bytes of each block.
+    canard_slab_stats_t stats;
+} canard_slab_class_t;
+
+/// A size-class pool for canard_mem_set_t::rx_payload, which eliminates the variable-size heap allocations of the
+/// multi-frame transfer reassembly buffers. Each buffer takes a fixed overhead plus the subscription extent,
+/// so there are only as many distinct sizes as there are distinct extents.
+///
+/// Each class has a free list of blocks of one size. Freed blocks go to the free list of their class and are reused
+/// by the next allocation of the same size in constant time; they are returned upstream only by canard_slab_destroy().
+/// Thus, the footprint of a class stays at its high-water mark. A class is created automatically when a subscription
+/// is registered on an instance that uses the slab as its rx_payload resource, and the slab pre-allocates
+/// prewarm blocks for it at that time, so that the first transfers do not involve the upstream resource at all.
+/// Classes can also be created and pre-allocated manually using canard_slab_reserve().
+/// Allocations of sizes without a class, such as the session index arrays, are forwarded to the upstream resource.
+///
+/// The slab is not thread-safe and must outlive every canard_t instance that uses it.
+typedef struct canard_slab_t
+{
+    canard_mem_t        upstream;    ///< Where the blocks come from.
+    size_t              prewarm;     ///< Blocks to pre-allocate per new subscription; zero to allocate on demand.
+    uint64_t            passthrough; ///< Allocations of sizes without a class, forwarded to the upstream resource.
+    size_t              class_count;
+    canard_slab_class_t classes[CANARD_SLAB_CLASS_COUNT];
+} canard_slab_t;
+
+/// Initializes the slab with no classes. Returns false if the arguments are invalid.
+bool canard_slab_new(canard_slab_t* const self, const canard_mem_t upstream, const size_t prewarm);
+
+/// Returns all cached blocks to the upstream resource. The blocks in use are not affected; this shall be invoked
+/// after all canard_t instances using the slab are destroyed and all payloads they delivered are freed.
+void canard_slab_destroy(canard_slab_t* const self);
+
+/// The memory resource to be used as canard_mem_set_t::rx_payload (or elsewhere, if desired).
+canard_mem_t canard_slab_mem(canard_slab_t* const self);
+
+/// Ensures that there is a class for the specified block size and that at least count blocks are cached in it.
+/// Returns false if the class cannot be created because all CANARD_SLAB_CLASS_COUNT classes are taken,
+/// or if the upstream resource is exhausted; the blocks allocated before the exhaustion are kept.
+bool canard_slab_reserve(canard_slab_t* const self, const size_t size, const size_t count);
+
+/// Returns the statistics of the class for the specified block size, or NULL if there is no such class.
+const canard_slab_stats_t* canard_slab_stats(const canard_slab_t* const self, const size_t size);
+
 // ---------------------------------   UAVCAN v0 & DroneCAN legacy compatibility API   ---------------------------------
 
 /// ATTENTION: Due to the v0 design, the problem of protocol version detection for correct frame parsing given
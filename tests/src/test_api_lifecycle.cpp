@@ -84,8 +84,22 @@ static bool capture_filter(canard_t* const self, const size_t filter_count, cons
     return true;
 }
 
-static const canard_vtable_t capture_vtable        = { .now = capture_now, .tx = capture_tx, .filter = nullptr };
-static const canard_vtable_t capture_filter_vtable = { .now = capture_now, .tx = capture_tx, .filter = capture_filter };
+static const canard_vtable_t capture_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
+static const canard_vtable_t capture_filter_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = capture_filter,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 // Minimal callbacks for canard_new() validity tests.
 static canard_us_t mock_now(const canard_t* const) { return 0; }
@@ -99,7 +113,14 @@ static bool        mock_tx(canard_t* const,
 {
     return false;
 }
-static const canard_vtable_t test_vtable = { .now = mock_now, .tx = mock_tx, .filter = nullptr };
+static const canard_vtable_t test_vtable = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 static canard_mem_set_t make_std_memory()
 {
@@ -169,8 +190,13 @@ static void capture_on_message(canard_subscription_t* const self,
     }
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t capture_sub_vtable = { .on_message = capture_on_message };
 
+#pragma GCC diagnostic pop
+
 // =====================================================================================================================
 //                                         CAN Frame Construction Helpers
 // =====================================================================================================================
@@ -264,11 +290,25 @@ static void test_canard_new_invalid_params()
     TEST_ASSERT_FALSE(canard_new(&self, nullptr, mem, CANARD_IFACE_BITMAP_ALL, 16U, 0U, 0U));
 
     // Null vtable->now.
-    canard_vtable_t bad_vtable = { .now = nullptr, .tx = mock_tx, .filter = nullptr };
+    canard_vtable_t bad_vtable = {
+        .now       = nullptr,
+        .tx        = mock_tx,
+        .filter    = nullptr,
+        .tx_gather = nullptr,
+        .tx_batch  = nullptr,
+        .tx_done   = nullptr,
+    };
     TEST_ASSERT_FALSE(canard_new(&self, &bad_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 0U, 0U));
 
     // Null vtable->tx.
-    bad_vtable = { .now = mock_now, .tx = nullptr, .filter = nullptr };
+    bad_vtable = {
+        .now       = mock_now,
+        .tx        = nullptr,
+        .filter    = nullptr,
+        .tx_gather = nullptr,
+        .tx_batch  = nullptr,
+        .tx_done   = nullptr,
+    };
     TEST_ASSERT_FALSE(canard_new(&self, &bad_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 0U, 0U));
 
     // Zero bitmap is valid: it declares a listen-only node.
@@ -909,7 +949,14 @@ static void test_redundant_rx_dedup_multiframe()
 // =====================================================================================================================
 
 static bool                  mock_filter_cb(canard_t* const, const size_t, const canard_filter_t*) { return true; }
-static const canard_vtable_t vtable_with_filter = { .now = mock_now, .tx = mock_tx, .filter = mock_filter_cb };
+static const canard_vtable_t vtable_with_filter = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = mock_filter_cb,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 static void test_canard_new_validation_branches()
 {
@@ -931,13 +978,27 @@ static void test_canard_new_validation_branches()
 
     // vtable->now == NULL.
     {
-        const canard_vtable_t bad = { .now = nullptr, .tx = mock_tx, .filter = nullptr };
+        const canard_vtable_t bad = {
+            .now       = nullptr,
+            .tx        = mock_tx,
+            .filter    = nullptr,
+            .tx_gather = nullptr,
+            .tx_batch  = nullptr,
+            .tx_done   = nullptr,
+        };
         TEST_ASSERT_FALSE(canard_new(&self, &bad, mem, CANARD_IFACE_BITMAP_ALL, 16U, 0U, 0U));
     }
 
     // vtable->tx == NULL.
     {
-        const canard_vtable_t bad = { .now = mock_now, .tx = nullptr, .filter = nullptr };
+        const canard_vtable_t bad = {
+            .now       = mock_now,
+            .tx        = nullptr,
+            .filter    = nullptr,
+            .tx_gather = nullptr,
+            .tx_batch  = nullptr,
+            .tx_done   = nullptr,
+        };
         TEST_ASSERT_FALSE(canard_new(&self, &bad, mem, CANARD_IFACE_BITMAP_ALL, 16U, 0U, 0U));
     }
 
@@ -1001,6 +1062,85 @@ static void test_canard_ingest_frame_validation()
     canard_destroy(&self);
 }
 
+// =====================================================================================================================
+//                                         Protocol Selection Tests
+// =====================================================================================================================
+
+// 23. Protocol versions can be disabled at runtime: they are rejected on TX and on subscription, ignored on RX,
+// and their subscriptions do not occupy acceptance filters. Adapts to the versions enabled at build time.
+static void test_canard_set_protocols()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    init_capture(&self, &cap, 42U, 16U, 4U, &capture_filter_vtable);
+    TEST_ASSERT_EQUAL_UINT8(0U, self.protocols_disabled);
+    TEST_ASSERT_FALSE(canard_set_protocols(nullptr, CANARD_PROTOCOL_V1));
+    TEST_ASSERT_FALSE(canard_set_protocols(&self, 0U));
+    TEST_ASSERT_FALSE(canard_set_protocols(&self, 4U));
+    TEST_ASSERT_EQUAL_UINT8(0U, self.protocols_disabled);
+
+    // One subscription per version; the v0 one only exists if v0 is enabled at build time.
+    rx_capture_t          rx_v1 = {};
+    rx_capture_t          rx_v0 = {};
+    canard_subscription_t sub_v1{};
+    canard_subscription_t sub_v0{};
+    TEST_ASSERT_EQUAL_PTR(&sub_v1, canard_subscribe_16b(&self, &sub_v1, 1000U, 256U, 0, &capture_sub_vtable));
+    sub_v1.user_context = &rx_v1;
+    canard_subscription_t* const v0_result =
+      canard_v0_subscribe(&self, &sub_v0, 1000U, 0xFFFFU, 256U, 0, &capture_sub_vtable);
+    TEST_ASSERT_EQUAL_PTR(CANARD_ENABLE_V0 ? &sub_v0 : nullptr, v0_result);
+    sub_v0.user_context = &rx_v0;
+    // Subscriptions plus the forced Heartbeat and (if v0 is enabled) NodeStatus filters.
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(CANARD_ENABLE_V0 ? 4U : 2U, cap.filter_rec.last_filter_count);
+
+    // Single-frame messages of both versions on the same ID from node 10. v0 toggle starts from zero.
+    const uint32_t       can_id_v1  = make_v1v1_msg_can_id(canard_prio_nominal, 1000U, 10U);
+    const uint32_t       can_id_v0  = (UINT32_C(16) << 24U) | (UINT32_C(1000) << 8U) | 10U;
+    uint_least8_t        frame_v1[] = { 0xAAU, 0 };
+    uint_least8_t        frame_v0[] = { 0xBBU, 0 };
+    const canard_bytes_t data_v1    = { .size = sizeof(frame_v1), .data = frame_v1 };
+    const canard_bytes_t data_v0    = { .size = sizeof(frame_v0), .data = frame_v0 };
+    const auto           ingest_tid = [&](const uint_least8_t tid) {
+        frame_v1[1] = make_v1_single_tail(tid);
+        frame_v0[1] = static_cast<uint_least8_t>(0xC0U | tid);
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, 100, 0U, can_id_v1, data_v1));
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, 100, 0U, can_id_v0, data_v0));
+    };
+    ingest_tid(0U);
+    TEST_ASSERT_EQUAL_size_t(1U, rx_v1.count);
+    TEST_ASSERT_EQUAL_size_t(CANARD_ENABLE_V0 ? 1U : 0U, rx_v0.count);
+
+    // Disable v0: the v0 subscription stops receiving and its filter and the NodeStatus filter are removed.
+    TEST_ASSERT_TRUE(canard_set_protocols(&self, CANARD_PROTOCOL_V1));
+    TEST_ASSERT_EQUAL_UINT8(CANARD_ENABLE_V0 ? CANARD_PROTOCOL_V0 : 0U, self.protocols_disabled);
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.filter_rec.last_filter_count);
+    ingest_tid(1U);
+    TEST_ASSERT_EQUAL_size_t(2U, rx_v1.count);
+    TEST_ASSERT_EQUAL_size_t(CANARD_ENABLE_V0 ? 1U : 0U, rx_v0.count);
+    canard_subscription_t sub_extra{};
+    TEST_ASSERT_NULL(canard_v0_subscribe(&self, &sub_extra, 2000U, 0xFFFFU, 256U, 0, &capture_sub_vtable));
+    const uint_least8_t        tx_data[] = { 1, 2, 3 };
+    const canard_bytes_chain_t tx_chain  = { .bytes = { .size = sizeof(tx_data), .data = tx_data }, .next = nullptr };
+    TEST_ASSERT_FALSE(canard_v0_publish(&self, 1000, 1U, canard_prio_nominal, 1000U, 0xFFFFU, 0U, tx_chain, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 1000, 1U, canard_prio_nominal, 1000U, 0U, tx_chain, nullptr));
+
+    // Re-enabling restores the original behavior, if v0 is available at all.
+    TEST_ASSERT_EQUAL(CANARD_ENABLE_V0 != 0, canard_set_protocols(&self, CANARD_PROTOCOL_V0 | CANARD_PROTOCOL_V1));
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(CANARD_ENABLE_V0 ? 4U : 2U, cap.filter_rec.last_filter_count);
+    ingest_tid(2U);
+    TEST_ASSERT_EQUAL_size_t(3U, rx_v1.count);
+    TEST_ASSERT_EQUAL_size_t(CANARD_ENABLE_V0 ? 2U : 0U, rx_v0.count);
+
+    canard_unsubscribe(&self, &sub_v1);
+    if (v0_result != nullptr) {
+        canard_unsubscribe(&self, &sub_v0);
+    }
+    canard_destroy(&self);
+}
+
 // =====================================================================================================================
 //                                              Test Runner
 // =====================================================================================================================
@@ -1052,5 +1192,8 @@ int main()
     RUN_TEST(test_canard_poll_null);
     RUN_TEST(test_canard_ingest_frame_validation);
 
+    // Protocol selection.
+    RUN_TEST(test_canard_set_protocols);
+
     return UNITY_END();
 }
@@ -78,7 +78,14 @@ static bool tx_capture_tx(canard_t* const self,
     return true; // Always accept.
 }
 
-static const canard_vtable_t tx_vtable = { .now = tx_capture_now, .tx = tx_capture_tx, .filter = nullptr };
+static const canard_vtable_t tx_vtable = {
+    .now       = tx_capture_now,
+    .tx        = tx_capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 // ------------------------------------------------  RX Capture  -------------------------------------------------------
 
@@ -118,8 +125,13 @@ static void roundtrip_on_message(canard_subscription_t* const self,
     }
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t roundtrip_sub_vtable = { .on_message = roundtrip_on_message };
 
+#pragma GCC diagnostic pop
+
 // ------------------------------------------------  RX Helper (mock now)  ---------------------------------------------
 
 struct rx_context_t
@@ -144,7 +156,14 @@ static bool rx_tx(canard_t* const,
     return false; // RX instance never transmits.
 }
 
-static const canard_vtable_t rx_vtable = { .now = rx_now, .tx = rx_tx, .filter = nullptr };
+static const canard_vtable_t rx_vtable = {
+    .now       = rx_now,
+    .tx        = rx_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 // ------------------------------------------------  Roundtrip Harness  ------------------------------------------------
 
@@ -27,7 +27,14 @@ static bool mock_tx(canard_t* const,
     return false;
 }
 
-static const canard_vtable_t     test_vtable    = { .now = mock_now, .tx = mock_tx, .filter = nullptr };
+static const canard_vtable_t test_vtable = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 static const canard_mem_vtable_t std_mem_vtable = { .free = std_free_mem, .alloc = std_alloc_mem };
 
 static canard_mem_set_t make_std_memory()
@@ -76,10 +83,19 @@ static void capture_on_message(canard_subscription_t* const self,
         const size_t n = (payload.view.size < sizeof(cap->payload_buf)) ? payload.view.size : sizeof(cap->payload_buf);
         std::memcpy(cap->payload_buf, payload.view.data, n);
     }
+    // Multi-frame payloads are owned by the application via origin; single-frame ones have an empty origin.
+    if ((payload.origin.size > 0) && (payload.origin.data != nullptr)) {
+        std::free(payload.origin.data);
+    }
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t capture_sub_vtable = { .on_message = capture_on_message };
 
+#pragma GCC diagnostic pop
+
 // -------------------------------------------  CAN Frame Construction Helpers  ----------------------------------------
 
 // v1.1 message: priority[28:26] | subject_id[25:8] | bit7=1(v1.1) | src[6:0]
@@ -136,7 +152,12 @@ static void test_subscribe_null_args()
     TEST_ASSERT_NULL(canard_subscribe_16b(&self, nullptr, 100U, 64U, 2000000, &capture_sub_vtable));
     TEST_ASSERT_NULL(canard_subscribe_16b(&self, &sub, 100U, 64U, 2000000, nullptr));
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
     const canard_subscription_vtable_t bad_vtable = { .on_message = nullptr };
+
+#pragma GCC diagnostic pop
     TEST_ASSERT_NULL(canard_subscribe_16b(&self, &sub, 100U, 64U, 2000000, &bad_vtable));
 }
 
@@ -148,7 +169,12 @@ static void test_subscribe_13b_null_args()
     TEST_ASSERT_NULL(canard_subscribe_13b(&self, nullptr, 100U, 64U, 2000000, &capture_sub_vtable));
     TEST_ASSERT_NULL(canard_subscribe_13b(&self, &sub, 100U, 64U, 2000000, nullptr));
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
     const canard_subscription_vtable_t bad_vtable = { .on_message = nullptr };
+
+#pragma GCC diagnostic pop
     TEST_ASSERT_NULL(canard_subscribe_13b(&self, &sub, 100U, 64U, 2000000, &bad_vtable));
 }
 
@@ -425,8 +451,13 @@ static void capture_on_message_simple(canard_subscription_t* const self,
     cap->payload_size   = payload.view.size;
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t simple_sub_vtable = { .on_message = capture_on_message_simple };
 
+#pragma GCC diagnostic pop
+
 static void test_multiple_subscriptions_routing()
 {
     canard_t    self    = {};
@@ -517,8 +548,13 @@ static void unsubscribe_on_message(canard_subscription_t* const self,
     TEST_ASSERT_NULL(payload.origin.data); // single-frame transfer: no owned storage
     canard_unsubscribe(self->owner, self);
 }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t unsubscribe_sub_vtable = { .on_message = unsubscribe_on_message };
 
+#pragma GCC diagnostic pop
+
 static void test_unsubscribe_within_callback()
 {
     // Instrumented session memory: fill-on-free turns a stale post-callback read into a detectable failure.
@@ -555,6 +591,876 @@ static void test_unsubscribe_within_callback()
     canard_destroy(&self);
 }
 
+// -------------------------------------------  Batch Ingestion  -----------------------------------------------------
+
+// CRC-16/CCITT-FALSE as used by multi-frame Cyphal/CAN transfers.
+static uint16_t crc16_ccitt_add(const uint16_t seed, const uint_least8_t* const data, const size_t size)
+{
+    uint32_t crc = seed;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= static_cast<uint32_t>(data[i]) << 8U;
+        for (size_t k = 0; k < 8; k++) {
+            crc = (((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U)) & 0xFFFFU;
+        }
+    }
+    return static_cast<uint16_t>(crc);
+}
+static uint16_t crc16_ccitt(const uint_least8_t* const data, const size_t size)
+{
+    return crc16_ccitt_add(0xFFFFU, data, size);
+}
+
+static void test_ingest_frames_null_args()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+    const canard_frame_t fr = {};
+    TEST_ASSERT_EQUAL_size_t(0U, canard_ingest_frames(nullptr, 1U, &fr));
+    TEST_ASSERT_EQUAL_size_t(0U, canard_ingest_frames(&self, 1U, nullptr));
+    TEST_ASSERT_EQUAL_size_t(0U, canard_ingest_frames(&self, 0U, &fr));
+    canard_destroy(&self);
+}
+
+static void test_ingest_frames_batch()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    rx_capture_t          cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1234U, 256U, 2000000, &capture_sub_vtable));
+    sub.user_context = (&cap);
+
+    // A multi-frame transfer with 10 bytes of payload from node 10, followed by a single-frame one from node 11.
+    const uint_least8_t payload[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const uint16_t      crc         = crc16_ccitt(payload, sizeof(payload));
+    const uint_least8_t f0[8]       = { 0, 1, 2, 3, 4, 5, 6, 0xA0U | 3U };
+    const uint_least8_t f1[6]       = {
+              7, 8, 9, static_cast<uint_least8_t>(crc >> 8U), static_cast<uint_least8_t>(crc & 0xFFU), 0x40U | 3U
+    };
+    const uint_least8_t f2[]     = { 0xEEU, make_v1_single_tail(4U) };
+    const uint_least8_t bad[]    = { 0x00U };
+    const uint32_t      can_id_a = make_v1v1_msg_can_id(canard_prio_fast, 1234U, 10U);
+    const uint32_t      can_id_b = make_v1v1_msg_can_id(canard_prio_fast, 1234U, 11U);
+
+    const canard_frame_t frames[] = {
+        { .timestamp       = 1000,
+          .iface_index     = 0U,
+          .extended_can_id = can_id_a,
+          .can_data        = { sizeof(f0), f0 },
+          .buffer          = {} },
+        { .timestamp       = 1001,
+          .iface_index     = 0U,
+          .extended_can_id = UINT32_MAX,
+          .can_data        = { sizeof(f2), f2 },
+          .buffer          = {} },
+        { .timestamp       = 1002,
+          .iface_index     = 0U,
+          .extended_can_id = can_id_a,
+          .can_data        = { sizeof(f1), f1 },
+          .buffer          = {} },
+        { .timestamp       = 1003,
+          .iface_index     = CANARD_IFACE_COUNT,
+          .extended_can_id = can_id_b,
+          .can_data        = { 1, f2 },
+          .buffer          = {} },
+        { .timestamp       = 1004,
+          .iface_index     = 0U,
+          .extended_can_id = can_id_b,
+          .can_data        = { sizeof(bad), nullptr },
+          .buffer          = {} },
+        { .timestamp       = 1005,
+          .iface_index     = 1U,
+          .extended_can_id = can_id_b,
+          .can_data        = { sizeof(f2), f2 },
+          .buffer          = {} },
+    };
+    now_val = 1005;
+    TEST_ASSERT_EQUAL_size_t(3U, canard_ingest_frames(&self, sizeof(frames) / sizeof(frames[0]), frames));
+
+    TEST_ASSERT_EQUAL_size_t(2U, cap.count);
+    TEST_ASSERT_EQUAL_INT64(1005, cap.timestamp);
+    TEST_ASSERT_EQUAL_UINT8(11U, cap.source_node_id);
+    TEST_ASSERT_EQUAL_UINT8(4U, cap.transfer_id);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.payload_size);
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, cap.payload_buf[0]);
+
+    // Re-deliver the multi-frame transfer alone and check its payload.
+    cap                             = {};
+    const uint_least8_t  f0b[8]     = { 0, 1, 2, 3, 4, 5, 6, 0xA0U | 5U };
+    const uint_least8_t  f1b[6]     = { 7, 8, 9, f1[3], f1[4], 0x40U | 5U };
+    const canard_frame_t frames_b[] = {
+        { .timestamp       = 2000,
+          .iface_index     = 0U,
+          .extended_can_id = can_id_a,
+          .can_data        = { sizeof(f0b), f0b },
+          .buffer          = {} },
+        { .timestamp       = 2001,
+          .iface_index     = 0U,
+          .extended_can_id = can_id_a,
+          .can_data        = { sizeof(f1b), f1b },
+          .buffer          = {} },
+    };
+    TEST_ASSERT_EQUAL_size_t(2U, canard_ingest_frames(&self, 2U, frames_b));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_INT64(2000, cap.timestamp);
+    TEST_ASSERT_EQUAL_UINT8(10U, cap.source_node_id);
+    TEST_ASSERT_EQUAL_UINT8(5U, cap.transfer_id);
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload), cap.payload_size);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, sizeof(payload));
+
+    canard_unsubscribe(&self, &sub);
+    canard_destroy(&self);
+}
+
+// The callback unsubscribes in the middle of a batch; the remaining frames with the same CAN ID must not reach it.
+static void test_ingest_frames_unsubscribe_within_callback()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    rx_capture_t          cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 601U, 64U, 2000000, &unsubscribe_sub_vtable));
+    sub.user_context = (&cap);
+
+    const uint32_t       can_id   = make_v1v1_msg_can_id(canard_prio_nominal, 601U, 24U);
+    const uint_least8_t  f0[]     = { 0xAAU, make_v1_single_tail(0U) };
+    const uint_least8_t  f1[]     = { 0xBBU, make_v1_single_tail(1U) };
+    const canard_frame_t frames[] = {
+        { .timestamp       = 100,
+          .iface_index     = 0U,
+          .extended_can_id = can_id,
+          .can_data        = { sizeof(f0), f0 },
+          .buffer          = {} },
+        { .timestamp       = 101,
+          .iface_index     = 0U,
+          .extended_can_id = can_id,
+          .can_data        = { sizeof(f1), f1 },
+          .buffer          = {} },
+    };
+    now_val = 101;
+    TEST_ASSERT_EQUAL_size_t(2U, canard_ingest_frames(&self, 2U, frames));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_16b, 601U));
+    canard_destroy(&self);
+}
+
+// -------------------------------------------  Zero-Copy Reception  -----------------------------------------------
+
+// A driver frame buffer with a reference counter; the driver's own reference is not counted.
+struct mock_buffer_t
+{
+    size_t        refs;
+    size_t        retained;
+    uint_least8_t data[8];
+};
+
+static void mock_buffer_retain(const canard_rx_buffer_t buffer)
+{
+    auto* const buf = static_cast<mock_buffer_t*>(buffer.context);
+    buf->refs++;
+    buf->retained++;
+}
+static void mock_buffer_release(const canard_rx_buffer_t buffer)
+{
+    auto* const buf = static_cast<mock_buffer_t*>(buffer.context);
+    TEST_ASSERT_TRUE(buf->refs > 0U);
+    buf->refs--;
+}
+static const canard_rx_buffer_vtable_t mock_buffer_vtable = { .retain  = mock_buffer_retain,
+                                                              .release = mock_buffer_release };
+
+static canard_rx_buffer_t make_buffer(mock_buffer_t* const buf)
+{
+    return canard_rx_buffer_t{ .vtable = &mock_buffer_vtable, .context = buf };
+}
+
+// Captures the chain without releasing it; the test does that after inspecting the buffer reference counters.
+struct chain_capture_t
+{
+    rx_capture_t           msg; // Single-frame transfers.
+    size_t                 count;
+    canard_us_t            timestamp;
+    uint_least8_t          source_node_id;
+    uint_least8_t          transfer_id;
+    canard_payload_chain_t payload;
+    size_t                 fragment_count;
+    uint_least8_t          payload_buf[256];
+};
+
+static void capture_on_message_chain(canard_subscription_t* const self,
+                                     const canard_us_t            timestamp,
+                                     const canard_prio_t,
+                                     const uint_least8_t source_node_id,
+                                     const uint_least8_t transfer_id,
+                                     // cppcheck-suppress passedByValueCallback
+                                     const canard_payload_chain_t payload)
+{
+    auto* const cap = static_cast<chain_capture_t*>(self->user_context);
+    cap->count++;
+    cap->timestamp      = timestamp;
+    cap->source_node_id = source_node_id;
+    cap->transfer_id    = transfer_id;
+    cap->payload        = payload;
+    cap->fragment_count = 0;
+    size_t offset       = 0;
+    for (const canard_bytes_chain_t* it = payload.head; it != nullptr; it = it->next) {
+        TEST_ASSERT_TRUE(it->bytes.size > 0U);
+        TEST_ASSERT_TRUE((offset + it->bytes.size) <= sizeof(cap->payload_buf));
+        std::memcpy(&cap->payload_buf[offset], it->bytes.data, it->bytes.size);
+        offset += it->bytes.size;
+        cap->fragment_count++;
+    }
+    TEST_ASSERT_EQUAL_size_t(payload.size, offset);
+}
+
+static void capture_on_message_single(canard_subscription_t* const self,
+                                      const canard_us_t            timestamp,
+                                      const canard_prio_t          priority,
+                                      const uint_least8_t          source_node_id,
+                                      const uint_least8_t          transfer_id,
+                                      // cppcheck-suppress passedByValueCallback
+                                      const canard_payload_t payload)
+{
+    auto* const           cap   = static_cast<chain_capture_t*>(self->user_context);
+    canard_subscription_t alias = *self;
+    alias.user_context          = &cap->msg;
+    capture_on_message(&alias, timestamp, priority, source_node_id, transfer_id, payload);
+}
+
+static const canard_subscription_vtable_t chain_sub_vtable = { .on_message       = capture_on_message_single,
+                                                               .on_message_chain = capture_on_message_chain };
+
+// Splits the payload followed by its CRC into v1 Classic CAN frames stored in the buffers; returns the frame count.
+static size_t make_v1_frames(const uint_least8_t* const payload,
+                             const size_t               size,
+                             const uint_least8_t        transfer_id,
+                             mock_buffer_t* const       bufs,
+                             size_t* const              sizes)
+{
+    uint_least8_t  raw[64] = {};
+    const uint16_t crc     = crc16_ccitt(payload, size);
+    std::memcpy(raw, payload, size);
+    raw[size]           = static_cast<uint_least8_t>(crc >> 8U);
+    raw[size + 1U]      = static_cast<uint_least8_t>(crc & 0xFFU);
+    const size_t total  = size + 2U;
+    size_t       offset = 0;
+    size_t       n      = 0;
+    bool         toggle = true;
+    while (offset < total) {
+        const size_t chunk = ((total - offset) < 7U) ? (total - offset) : 7U;
+        std::memcpy(bufs[n].data, &raw[offset], chunk);
+        offset += chunk;
+        bufs[n].data[chunk] = static_cast<uint_least8_t>(((n == 0U) ? 0x80U : 0U) | ((offset == total) ? 0x40U : 0U) |
+                                                         (toggle ? 0x20U : 0U) | (transfer_id & 0x1FU));
+        sizes[n]            = chunk + 1U;
+        toggle              = !toggle;
+        n++;
+    }
+    return n;
+}
+
+// The frames are retained rather than copied; the tail bytes and the CRC are excluded from the chain.
+static void test_ingest_chain_retained()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    chain_capture_t       cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1234U, 256U, 2000000, &chain_sub_vtable));
+    sub.user_context      = (&cap);
+    const uint32_t can_id = make_v1v1_msg_can_id(canard_prio_fast, 1234U, 10U);
+
+    // 16 bytes of payload and 2 bytes of CRC: 7+7+(2+2); the CRC is entirely in the last frame.
+    uint_least8_t payload[16] = {};
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = static_cast<uint_least8_t>(i * 3U);
+    }
+    mock_buffer_t bufs[4]  = {};
+    size_t        sizes[4] = {};
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 7U, bufs, sizes));
+    now_val = 1002;
+    for (size_t i = 0; i < 2U; i++) {
+        TEST_ASSERT_TRUE(canard_ingest_frame_retainable(
+          &self, static_cast<canard_us_t>(1000U + i), 0U, can_id, { sizes[i], bufs[i].data }, make_buffer(&bufs[i])));
+    }
+    TEST_ASSERT_EQUAL_size_t(0U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[0].refs);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[1].refs);
+    const canard_frame_t last = {
+        .timestamp       = 1002,
+        .iface_index     = 0U,
+        .extended_can_id = can_id,
+        .can_data        = { sizes[2], bufs[2].data },
+        .buffer          = make_buffer(&bufs[2]),
+    };
+    TEST_ASSERT_EQUAL_size_t(1U, canard_ingest_frames(&self, 1U, &last));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(0U, cap.msg.count);
+    TEST_ASSERT_EQUAL_INT64(1000, cap.timestamp);
+    TEST_ASSERT_EQUAL_UINT8(10U, cap.source_node_id);
+    TEST_ASSERT_EQUAL_UINT8(7U, cap.transfer_id);
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload), cap.payload.size);
+    TEST_ASSERT_EQUAL_size_t(3U, cap.fragment_count);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, sizeof(payload));
+    TEST_ASSERT_EQUAL_PTR(bufs[0].data, cap.payload.head->bytes.data); // Not copied.
+    for (size_t i = 0; i < 3U; i++) {
+        TEST_ASSERT_EQUAL_size_t(1U, bufs[i].refs);
+    }
+    canard_payload_chain_free(&self, cap.payload);
+    for (size_t i = 0; i < 3U; i++) {
+        TEST_ASSERT_EQUAL_size_t(0U, bufs[i].refs);
+    }
+
+    // 13 bytes of payload: 7+(6+1)+(1); the CRC is split, so the last frame is released before the delivery.
+    cap = {};
+    std::memset(bufs, 0, sizeof(bufs));
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, 13U, 8U, bufs, sizes));
+    const canard_frame_t frames[] = {
+        { .timestamp       = 2000,
+          .iface_index     = 0U,
+          .extended_can_id = can_id,
+          .can_data        = { sizes[0], bufs[0].data },
+          .buffer          = make_buffer(&bufs[0]) },
+        { .timestamp       = 2001,
+          .iface_index     = 0U,
+          .extended_can_id = can_id,
+          .can_data        = { sizes[1], bufs[1].data },
+          .buffer          = make_buffer(&bufs[1]) },
+        { .timestamp       = 2002,
+          .iface_index     = 0U,
+          .extended_can_id = can_id,
+          .can_data        = { sizes[2], bufs[2].data },
+          .buffer          = make_buffer(&bufs[2]) },
+    };
+    now_val = 2002;
+    TEST_ASSERT_EQUAL_size_t(3U, canard_ingest_frames(&self, 3U, frames));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(13U, cap.payload.size);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.fragment_count);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, 13U);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[0].refs);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[1].refs);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[2].refs);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[2].retained);
+    canard_payload_chain_free(&self, cap.payload);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[0].refs);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[1].refs);
+
+    // Single-frame transfers are still delivered via on_message and are never retained.
+    const uint_least8_t single[] = { 0xEEU, make_v1_single_tail(9U) };
+    now_val                      = 3000;
+    TEST_ASSERT_TRUE(
+      canard_ingest_frame_retainable(&self, 3000, 0U, can_id, { sizeof(single), single }, make_buffer(&bufs[3])));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.msg.count);
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, cap.msg.payload_buf[0]);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[3].retained);
+
+    canard_payload_chain_free(&self, canard_payload_chain_t{ 0, nullptr }); // No effect.
+    canard_payload_chain_free(nullptr, cap.payload);                        // Ditto.
+    canard_unsubscribe(&self, &sub);
+    canard_destroy(&self);
+}
+
+// Frames past the extent are not retained; frames without a retainable buffer are copied; bad transfers are released.
+static void test_ingest_chain_truncation_copy_and_errors()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    chain_capture_t       cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1234U, 5U, 2000000, &chain_sub_vtable));
+    sub.user_context      = (&cap);
+    const uint32_t can_id = make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 11U);
+
+    uint_least8_t payload[16] = {};
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = static_cast<uint_least8_t>(0xA0U + i);
+    }
+    mock_buffer_t bufs[3]  = {};
+    size_t        sizes[3] = {};
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 1U, bufs, sizes));
+    now_val = 12;
+    for (size_t i = 0; i < 3U; i++) {
+        TEST_ASSERT_TRUE(canard_ingest_frame_retainable(
+          &self, static_cast<canard_us_t>(10U + i), 0U, can_id, { sizes[i], bufs[i].data }, make_buffer(&bufs[i])));
+    }
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(5U, cap.payload.size);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.fragment_count);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, 5U);
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[0].refs);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[1].retained);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[2].retained);
+    canard_payload_chain_free(&self, cap.payload);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[0].refs);
+
+    // Without a retainable buffer the payload is copied, so the driver may reuse the frame memory immediately.
+    cap = {};
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 2U, bufs, sizes));
+    now_val = 22;
+    for (size_t i = 0; i < 3U; i++) {
+        TEST_ASSERT_TRUE(
+          canard_ingest_frame(&self, static_cast<canard_us_t>(20U + i), 0U, can_id, { sizes[i], bufs[i].data }));
+        std::memset(bufs[i].data, 0, sizeof(bufs[i].data));
+    }
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(5U, cap.payload.size);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, 5U);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload.head->bytes.data, 5U);
+    canard_payload_chain_free(&self, cap.payload);
+
+    // A transfer with a bad CRC is dropped and its frames are released.
+    cap = {};
+    std::memset(bufs, 0, sizeof(bufs));
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 3U, bufs, sizes));
+    bufs[1].data[0] ^= 0x01U;
+    now_val = 32;
+    for (size_t i = 0; i < 3U; i++) {
+        TEST_ASSERT_TRUE(canard_ingest_frame_retainable(
+          &self, static_cast<canard_us_t>(30U + i), 0U, can_id, { sizes[i], bufs[i].data }, make_buffer(&bufs[i])));
+    }
+    TEST_ASSERT_EQUAL_size_t(0U, cap.count);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.rx_transfer);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[0].refs);
+
+    // An incomplete transfer holds its frames until the subscription is removed.
+    std::memset(bufs, 0, sizeof(bufs));
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 4U, bufs, sizes));
+    now_val = 40;
+    TEST_ASSERT_TRUE(
+      canard_ingest_frame_retainable(&self, 40, 0U, can_id, { sizes[0], bufs[0].data }, make_buffer(&bufs[0])));
+    TEST_ASSERT_EQUAL_size_t(1U, bufs[0].refs);
+    canard_unsubscribe(&self, &sub);
+    TEST_ASSERT_EQUAL_size_t(0U, bufs[0].refs);
+
+    // A buffer with an incomplete vtable is rejected.
+    const canard_rx_buffer_vtable_t bad_vtable = { .retain = mock_buffer_retain, .release = nullptr };
+    const canard_rx_buffer_t        bad        = { .vtable = &bad_vtable, .context = &bufs[0] };
+    TEST_ASSERT_FALSE(canard_ingest_frame_retainable(&self, 50, 0U, can_id, { sizes[0], bufs[0].data }, bad));
+    TEST_ASSERT_FALSE(canard_ingest_frame_retainable(nullptr, 50, 0U, can_id, { sizes[0], bufs[0].data }, {}));
+    canard_destroy(&self);
+}
+
+// v0 places the CRC at the beginning of the first frame; it is kept out of the chain.
+static void test_ingest_chain_v0()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    chain_capture_t       cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_v0_subscribe(&self, &sub, 500U, 0x1234U, 64U, 2000000, &chain_sub_vtable));
+    sub.user_context      = (&cap);
+    const uint32_t can_id = make_v0_msg_can_id(canard_prio_nominal, 500U, 10U);
+
+    const uint_least8_t payload[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    const uint16_t      crc         = crc16_ccitt_add(0x1234U, payload, sizeof(payload));
+    const auto          crc_lo      = static_cast<uint_least8_t>(crc & 0xFFU);
+    const auto          crc_hi      = static_cast<uint_least8_t>(crc >> 8U);
+    mock_buffer_t       b0          = { 0, 0, { crc_lo, crc_hi, 1, 2, 3, 4, 5, 0x80U | 6U } };
+    mock_buffer_t       b1          = { 0, 0, { 6, 7, 8, 9, 10, 0x60U | 6U } };
+    now_val                         = 101;
+    TEST_ASSERT_TRUE(canard_ingest_frame_retainable(&self, 100, 0U, can_id, { 8U, b0.data }, make_buffer(&b0)));
+    TEST_ASSERT_TRUE(canard_ingest_frame_retainable(&self, 101, 0U, can_id, { 6U, b1.data }, make_buffer(&b1)));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload), cap.payload.size);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.fragment_count);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, sizeof(payload));
+    TEST_ASSERT_EQUAL_PTR(&b0.data[2], cap.payload.head->bytes.data);
+    TEST_ASSERT_EQUAL_size_t(1U, b0.refs);
+    TEST_ASSERT_EQUAL_size_t(1U, b1.refs);
+    canard_payload_chain_free(&self, cap.payload);
+    TEST_ASSERT_EQUAL_size_t(0U, b0.refs);
+    TEST_ASSERT_EQUAL_size_t(0U, b1.refs);
+
+    canard_unsubscribe(&self, &sub);
+    canard_destroy(&self);
+}
+
+// -------------------------------------------  Reserved Capacity  -------------------------------------------------
+
+static canard_mem_set_t make_instrumented_rx_memory(instrumented_allocator_t* const ses_alloc,
+                                                    instrumented_allocator_t* const pay_alloc)
+{
+    instrumented_allocator_new(ses_alloc);
+    instrumented_allocator_new(pay_alloc);
+    const canard_mem_t std_r = { .vtable = &std_mem_vtable, .context = nullptr };
+    return canard_mem_set_t{ .tx_transfer = std_r,
+                             .tx_frame    = std_r,
+                             .rx_session  = instrumented_allocator_make_resource(ses_alloc),
+                             .rx_payload  = instrumented_allocator_make_resource(pay_alloc),
+                             .rx_filters  = std_r };
+}
+
+// Once reserved, the reception does not touch the memory resources; the reserve is released on unsubscribe.
+static void test_subscription_reserve()
+{
+    instrumented_allocator_t ses_alloc;
+    instrumented_allocator_t pay_alloc;
+    const canard_mem_set_t   mem     = make_instrumented_rx_memory(&ses_alloc, &pay_alloc);
+    canard_t                 self    = {};
+    canard_us_t              now_val = 0;
+    TEST_ASSERT_TRUE(canard_new(&self, &test_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 1234U, 0U));
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 42U));
+    self.user_context = &now_val;
+
+    rx_capture_t          cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1234U, 16U, 2000000, &capture_sub_vtable));
+    sub.user_context = (&cap);
+    TEST_ASSERT_FALSE(canard_subscription_reserve(nullptr, &sub, 1U, 1U));
+    TEST_ASSERT_FALSE(canard_subscription_reserve(&self, nullptr, 1U, 1U));
+    TEST_ASSERT_FALSE(canard_subscription_reserve(&self, &sub, CANARD_NODE_ID_CAPACITY + 1U, 1U));
+    const size_t pay_fragments = pay_alloc.allocated_fragments; // The subscription table nodes, if enabled.
+    TEST_ASSERT_TRUE(canard_subscription_reserve(&self, &sub, 2U, 1U));
+    TEST_ASSERT_TRUE(canard_subscription_reserve(&self, &sub, 2U, 2U)); // Grow.
+    TEST_ASSERT_EQUAL_size_t(2U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(pay_fragments + 3U, pay_alloc.allocated_fragments); // Two slots and the session array.
+    const uint64_t ses_allocs = ses_alloc.count_alloc;
+    const uint64_t pay_allocs = pay_alloc.count_alloc;
+
+    // Interleaved transfers from two remotes; the payload is longer than the extent to check the truncation.
+    uint_least8_t payload[16] = {};
+    for (size_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = static_cast<uint_least8_t>(0x10U + i);
+    }
+    mock_buffer_t bufs[3]  = {};
+    size_t        sizes[3] = {};
+    for (uint_least8_t tid = 0; tid < 3U; tid++) {
+        TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), tid, bufs, sizes));
+        now_val += 1000;
+        for (size_t i = 0; i < 3U; i++) {
+            for (uint_least8_t src = 10U; src < 12U; src++) {
+                const uint32_t can_id = make_v1v1_msg_can_id(canard_prio_nominal, 1234U, src);
+                TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, can_id, { sizes[i], bufs[i].data }));
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_size_t(6U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(16U, cap.payload_size);
+    TEST_ASSERT_EQUAL_MEMORY(payload, cap.payload_buf, 16U);
+    TEST_ASSERT_EQUAL_UINT64(ses_allocs, ses_alloc.count_alloc);
+    TEST_ASSERT_EQUAL_UINT64(pay_allocs, pay_alloc.count_alloc);
+
+    // The reserve is exhausted by a third remote; its frames are dropped as on OOM.
+    const uint64_t oom = self.err.oom;
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 12U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_EQUAL_UINT64(oom + 1U, self.err.oom);
+    TEST_ASSERT_EQUAL_size_t(6U, cap.count);
+    TEST_ASSERT_EQUAL_UINT64(ses_allocs, ses_alloc.count_alloc);
+
+    // Two slots in progress at different priorities exhaust the slot reserve.
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val + 1, 0U, make_v1v1_msg_can_id(canard_prio_fast, 1234U, 10U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val + 1, 0U, make_v1v1_msg_can_id(canard_prio_slow, 1234U, 10U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val + 1, 0U, make_v1v1_msg_can_id(canard_prio_low, 1234U, 11U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_EQUAL_UINT64(oom + 2U, self.err.oom);
+    TEST_ASSERT_EQUAL_UINT64(pay_allocs, pay_alloc.count_alloc);
+
+    // The in-progress slots and the sessions go back to the memory resources.
+    canard_unsubscribe(&self, &sub);
+    TEST_ASSERT_EQUAL_size_t(0U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+    canard_destroy(&self);
+}
+
+// The sessions and slots allocated before the reservation go back to the memory resources, not into the reserve.
+// A reservation that fails midway leaves the reserve as it was.
+static void test_subscription_reserve_general_blocks()
+{
+    instrumented_allocator_t ses_alloc;
+    instrumented_allocator_t pay_alloc;
+    const canard_mem_set_t   mem     = make_instrumented_rx_memory(&ses_alloc, &pay_alloc);
+    canard_t                 self    = {};
+    canard_us_t              now_val = 1000;
+    TEST_ASSERT_TRUE(canard_new(&self, &test_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 1234U, 0U));
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 42U));
+    self.user_context = &now_val;
+
+    rx_capture_t          cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1234U, 16U, 2000000, &capture_sub_vtable));
+    sub.user_context = (&cap);
+
+    // A session with a slot in progress is allocated from the general resources before the reservation.
+    const uint_least8_t payload[16] = {};
+    mock_buffer_t       bufs[3]     = {};
+    size_t              sizes[3]    = {};
+    TEST_ASSERT_EQUAL_size_t(3U, make_v1_frames(payload, sizeof(payload), 0U, bufs, sizes));
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 10U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_EQUAL_size_t(1U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_TRUE(canard_subscription_reserve(&self, &sub, 1U, 1U));
+    TEST_ASSERT_EQUAL_size_t(2U, ses_alloc.allocated_fragments);
+    const size_t pay_reserved = pay_alloc.allocated_fragments; // Including the general slot and the session array.
+
+    // Once stale, the general session and its slot are freed, while the reserve is kept intact.
+    now_val += 60 * 1000000;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(1U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(pay_reserved - 1U, pay_alloc.allocated_fragments);
+
+    // The reserve holds one session only, so the second remote is dropped.
+    const uint64_t oom = self.err.oom;
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 11U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_TRUE(canard_ingest_frame(
+      &self, now_val, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 12U), { sizes[0], bufs[0].data }));
+    TEST_ASSERT_EQUAL_UINT64(oom + 1U, self.err.oom);
+    TEST_ASSERT_EQUAL_size_t(1U, ses_alloc.allocated_fragments);
+
+    // Growing the reserve fails on the second session and on the second slot; the first one is given back.
+    ses_alloc.limit_fragments = 2U;
+    TEST_ASSERT_FALSE(canard_subscription_reserve(&self, &sub, 3U, 1U));
+    TEST_ASSERT_EQUAL_size_t(1U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(1U, sub.reserved_sessions);
+    ses_alloc.limit_fragments = SIZE_MAX;
+    pay_alloc.limit_fragments = pay_alloc.allocated_fragments + 1U;
+    const size_t pay_before   = pay_alloc.allocated_fragments;
+    TEST_ASSERT_FALSE(canard_subscription_reserve(&self, &sub, 2U, 3U));
+    TEST_ASSERT_EQUAL_size_t(1U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(pay_before, pay_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(1U, sub.reserved_sessions);
+    TEST_ASSERT_EQUAL_size_t(1U, sub.reserved_slots);
+    pay_alloc.limit_fragments = SIZE_MAX;
+
+    canard_unsubscribe(&self, &sub);
+    TEST_ASSERT_EQUAL_size_t(0U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+    canard_destroy(&self);
+}
+
+static void unsubscribe_on_message_multiframe(canard_subscription_t* const self,
+                                              const canard_us_t,
+                                              const canard_prio_t,
+                                              const uint_least8_t,
+                                              const uint_least8_t,
+                                              // cppcheck-suppress passedByValueCallback
+                                              const canard_payload_t payload)
+{
+    auto* const cap = static_cast<rx_capture_t*>(self->user_context);
+    cap->count++;
+    cap->payload_size = payload.view.size;
+    TEST_ASSERT_NULL(payload.origin.data); // Lent from the reserve.
+    canard_unsubscribe(self->owner, self);
+}
+static const canard_subscription_vtable_t unsubscribe_multiframe_sub_vtable = {
+    .on_message       = unsubscribe_on_message_multiframe,
+    .on_message_chain = nullptr,
+};
+
+// The slot lent to the callback is released by canard_unsubscribe() when called from the callback.
+static void test_subscription_reserve_unsubscribe_within_callback()
+{
+    instrumented_allocator_t ses_alloc;
+    instrumented_allocator_t pay_alloc;
+    const canard_mem_set_t   mem     = make_instrumented_rx_memory(&ses_alloc, &pay_alloc);
+    canard_t                 self    = {};
+    canard_us_t              now_val = 0;
+    TEST_ASSERT_TRUE(canard_new(&self, &test_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 1234U, 0U));
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 42U));
+    self.user_context = &now_val;
+
+    rx_capture_t          cap = {};
+    canard_subscription_t sub = {};
+    TEST_ASSERT_EQUAL_PTR(&sub,
+                          canard_subscribe_16b(&self, &sub, 1234U, 64U, 2000000, &unsubscribe_multiframe_sub_vtable));
+    sub.user_context = (&cap);
+    TEST_ASSERT_TRUE(canard_subscription_reserve(&self, &sub, 1U, 1U));
+
+    const uint_least8_t payload[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    mock_buffer_t       bufs[2]     = {};
+    size_t              sizes[2]    = {};
+    TEST_ASSERT_EQUAL_size_t(2U, make_v1_frames(payload, sizeof(payload), 0U, bufs, sizes));
+    const uint32_t can_id = make_v1v1_msg_can_id(canard_prio_nominal, 1234U, 10U);
+    now_val               = 100;
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 100, 0U, can_id, { sizes[0], bufs[0].data }));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 100, 0U, can_id, { sizes[1], bufs[1].data }));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload), cap.payload_size);
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_16b, 1234U));
+    TEST_ASSERT_NULL(self.rx.lent_slot);
+    TEST_ASSERT_EQUAL_size_t(0U, ses_alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+    canard_destroy(&self);
+}
+
+// -------------------------------------------  Route Cache  ---------------------------------------------------------
+
+// The expected counters depend on whether the cache is enabled; without it, every lookup is a miss.
+static void check_route_cache(const canard_t* const self, const uint64_t hits, const uint64_t misses)
+{
+    const uint64_t expected_hits = (CANARD_RX_ROUTE_CACHE_SIZE > 0) ? hits : 0U;
+    TEST_ASSERT_EQUAL_UINT64(expected_hits, self->rx.route_cache_hits);
+    TEST_ASSERT_EQUAL_UINT64(hits + misses - expected_hits, self->rx.route_cache_misses);
+}
+
+static void test_route_cache()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+    check_route_cache(&self, 0, 0);
+
+    rx_capture_t          cap = {};
+    canard_subscription_t msg = {};
+    canard_subscription_t req = {};
+    TEST_ASSERT_EQUAL_PTR(&msg, canard_subscribe_16b(&self, &msg, 1234U, 64U, 2000000, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_PTR(&req, canard_subscribe_request(&self, &req, 100U, 64U, 2000000, &capture_sub_vtable));
+    msg.user_context = &cap;
+    req.user_context = &cap;
+
+    const uint_least8_t  frame[]  = { 0xAAU, make_v1_single_tail(0U) };
+    const uint_least8_t  frame1[] = { 0xBBU, make_v1_single_tail(1U) };
+    const canard_bytes_t can_data = { .size = sizeof(frame), .data = frame };
+    const canard_prio_t  nom      = canard_prio_nominal;
+
+    // The priority and the source node-ID do not affect the key.
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 10, 0U, make_v1v1_msg_can_id(nom, 1234U, 10U), can_data));
+    check_route_cache(&self, 0, 1);
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 20, 0U, make_v1v1_msg_can_id(canard_prio_high, 1234U, 11U), can_data));
+    check_route_cache(&self, 1, 1);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.count);
+    TEST_ASSERT_EQUAL_UINT8(11U, cap.source_node_id);
+
+    // Negative entries are cached as well.
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 30, 0U, make_v1v1_msg_can_id(nom, 999U, 10U), can_data));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 40, 0U, make_v1v1_msg_can_id(nom, 999U, 12U), can_data));
+    check_route_cache(&self, 2, 2);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.count);
+
+    // A new subscription invalidates the negative entry.
+    canard_subscription_t late = {};
+    TEST_ASSERT_EQUAL_PTR(&late, canard_subscribe_16b(&self, &late, 999U, 64U, 2000000, &capture_sub_vtable));
+    late.user_context = &cap;
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 50, 0U, make_v1v1_msg_can_id(nom, 999U, 13U), can_data));
+    check_route_cache(&self, 2, 3);
+    TEST_ASSERT_EQUAL_size_t(3U, cap.count);
+    TEST_ASSERT_EQUAL_UINT8(13U, cap.source_node_id);
+
+    // Unsubscription invalidates the positive entry.
+    canard_unsubscribe(&self, &late);
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 60, 0U, make_v1v1_msg_can_id(nom, 999U, 14U), can_data));
+    check_route_cache(&self, 2, 4);
+    TEST_ASSERT_EQUAL_size_t(3U, cap.count);
+
+    // The destination check is cached, so a node-ID change must invalidate the cache.
+    const uint32_t to_42 = make_v1_svc_can_id(nom, 100U, true, 42U, 10U);
+    const uint32_t to_43 = make_v1_svc_can_id(nom, 100U, true, 43U, 10U);
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 70, 0U, to_42, can_data));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 80, 0U, to_43, can_data));
+    check_route_cache(&self, 2, 6);
+    TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 43U));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 90, 0U, to_42, can_data));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, 100, 0U, to_43, { .size = sizeof(frame1), .data = frame1 }));
+    check_route_cache(&self, 2, 8);
+    TEST_ASSERT_EQUAL_size_t(5U, cap.count);
+
+    canard_unsubscribe(&self, &msg);
+    canard_unsubscribe(&self, &req);
+    canard_destroy(&self);
+}
+
+// -------------------------------------------  Subscription Registry  -----------------------------------------------
+
+// Covers the port-ID space edges; with CANARD_RX_SUBSCRIPTION_TABLE also the on-demand table memory management.
+static void test_subscription_registry()
+{
+    instrumented_allocator_t pay_alloc;
+    instrumented_allocator_new(&pay_alloc);
+    const canard_mem_t     std_r   = { .vtable = &std_mem_vtable, .context = nullptr };
+    const canard_mem_set_t mem     = { .tx_transfer = std_r,
+                                       .tx_frame    = std_r,
+                                       .rx_session  = std_r,
+                                       .rx_payload  = instrumented_allocator_make_resource(&pay_alloc),
+                                       .rx_filters  = std_r };
+    canard_t               self    = {};
+    canard_us_t            now_val = 0;
+    TEST_ASSERT_TRUE(canard_new(&self, &test_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 1234U, 0U));
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 42U));
+    self.user_context = &now_val;
+
+    static const uint16_t msg_ids[] = { 0U, 255U, 256U, 7509U, 65535U };
+    canard_subscription_t msg[sizeof(msg_ids) / sizeof(msg_ids[0])];
+    for (size_t i = 0; i < (sizeof(msg_ids) / sizeof(msg_ids[0])); i++) {
+        TEST_ASSERT_EQUAL_PTR(&msg[i], canard_subscribe_16b(&self, &msg[i], msg_ids[i], 8U, 0, &capture_sub_vtable));
+    }
+    canard_subscription_t msg_13b = {};
+    canard_subscription_t req     = {};
+    canard_subscription_t v0_res  = {};
+    TEST_ASSERT_EQUAL_PTR(&msg_13b, canard_subscribe_13b(&self, &msg_13b, 8191U, 8U, 0, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_PTR(&req, canard_subscribe_request(&self, &req, 511U, 8U, 0, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_PTR(&v0_res, canard_v0_subscribe_response(&self, &v0_res, 255U, 0U, 8U, &capture_sub_vtable));
+#if CANARD_RX_SUBSCRIPTION_TABLE
+    // One root per kind plus one leaf per 256-port-ID block: 1+4 for 16-bit, 1+1 for each of the other three.
+    TEST_ASSERT_EQUAL_size_t(11U, pay_alloc.allocated_fragments);
+#else
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+#endif
+
+    for (size_t i = 0; i < (sizeof(msg_ids) / sizeof(msg_ids[0])); i++) {
+        TEST_ASSERT_EQUAL_PTR(&msg[i], canard_find_subscription(&self, canard_kind_message_16b, msg_ids[i]));
+    }
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_16b, 1U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_16b, 65534U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_v0_message, 7509U));
+    TEST_ASSERT_EQUAL_PTR(&msg_13b, canard_find_subscription(&self, canard_kind_message_13b, 8191U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_13b, 8192U)); // beyond the ID space
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_13b, 65535U));
+    TEST_ASSERT_EQUAL_PTR(&req, canard_find_subscription(&self, canard_kind_request, 511U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_response, 511U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_request, 512U));
+    TEST_ASSERT_EQUAL_PTR(&v0_res, canard_find_subscription(&self, canard_kind_v0_response, 255U));
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_v0_response, 256U));
+
+    // Leaves and roots are released as they become empty.
+    canard_unsubscribe(&self, &msg[1]);
+    TEST_ASSERT_NULL(canard_find_subscription(&self, canard_kind_message_16b, 255U));
+    TEST_ASSERT_EQUAL_PTR(&msg[0], canard_find_subscription(&self, canard_kind_message_16b, 0U));
+#if CANARD_RX_SUBSCRIPTION_TABLE
+    TEST_ASSERT_EQUAL_size_t(11U, pay_alloc.allocated_fragments); // The leaf is still used by subject 0.
+    canard_unsubscribe(&self, &msg[0]);
+    TEST_ASSERT_EQUAL_size_t(10U, pay_alloc.allocated_fragments);
+#else
+    canard_unsubscribe(&self, &msg[0]);
+#endif
+    for (size_t i = 2; i < (sizeof(msg_ids) / sizeof(msg_ids[0])); i++) {
+        canard_unsubscribe(&self, &msg[i]);
+    }
+    canard_unsubscribe(&self, &msg_13b);
+    canard_unsubscribe(&self, &req);
+    canard_unsubscribe(&self, &v0_res);
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+
+    // Out of memory while allocating the table: nothing is subscribed and nothing is leaked.
+    pay_alloc.limit_fragments = 1U;
+    const bool table          = CANARD_RX_SUBSCRIPTION_TABLE;
+    TEST_ASSERT_EQUAL_PTR(table ? nullptr : &msg[0],
+                          canard_subscribe_16b(&self, &msg[0], 1000U, 8U, 0, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_UINT64(table ? 1U : 0U, self.err.oom);
+    TEST_ASSERT_EQUAL_PTR(table ? nullptr : &msg[0], canard_find_subscription(&self, canard_kind_message_16b, 1000U));
+    if (!table) {
+        canard_unsubscribe(&self, &msg[0]);
+    }
+    TEST_ASSERT_EQUAL_size_t(0U, pay_alloc.allocated_fragments);
+    canard_destroy(&self);
+}
+
 // -------------------------------------------  v0 Argument Validation  ------------------------------------------------
 
 static void test_v0_subscribe_null_args()
@@ -565,7 +1471,12 @@ static void test_v0_subscribe_null_args()
     TEST_ASSERT_NULL(canard_v0_subscribe(&self, nullptr, 100U, 0xBEEFU, 64U, 2000000, &capture_sub_vtable));
     TEST_ASSERT_NULL(canard_v0_subscribe(&self, &sub, 100U, 0xBEEFU, 64U, 2000000, nullptr));
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
     const canard_subscription_vtable_t bad_vtable = { .on_message = nullptr };
+
+#pragma GCC diagnostic pop
     TEST_ASSERT_NULL(canard_v0_subscribe(&self, &sub, 100U, 0xBEEFU, 64U, 2000000, &bad_vtable));
 }
 
@@ -831,6 +1742,27 @@ int main()
     RUN_TEST(test_unsubscribe_cleans_up_sessions);
     RUN_TEST(test_unsubscribe_within_callback);
 
+    // Batch ingestion.
+    RUN_TEST(test_ingest_frames_null_args);
+    RUN_TEST(test_ingest_frames_batch);
+    RUN_TEST(test_ingest_frames_unsubscribe_within_callback);
+
+    // Zero-copy reception.
+    RUN_TEST(test_ingest_chain_retained);
+    RUN_TEST(test_ingest_chain_truncation_copy_and_errors);
+    RUN_TEST(test_ingest_chain_v0);
+
+    // Reserved capacity.
+    RUN_TEST(test_subscription_reserve);
+    RUN_TEST(test_subscription_reserve_general_blocks);
+    RUN_TEST(test_subscription_reserve_unsubscribe_within_callback);
+
+    // Route cache.
+    RUN_TEST(test_route_cache);
+
+    // Subscription registry.
+    RUN_TEST(test_subscription_registry);
+
     // v0 argument validation.
     RUN_TEST(test_v0_subscribe_null_args);
     RUN_TEST(test_v0_subscribe_request_null_args);
@@ -78,7 +78,14 @@ static bool mock_tx(canard_t* const,
     return false;
 }
 
-static const canard_vtable_t     test_vtable    = { .now = mock_now, .tx = mock_tx, .filter = nullptr };
+static const canard_vtable_t test_vtable = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 static const canard_mem_vtable_t std_mem_vtable = { .free = std_free_mem, .alloc = std_alloc_mem };
 
 static canard_mem_set_t make_std_memory()
@@ -134,8 +141,13 @@ static void capture_on_message(canard_subscription_t* const self,
     }
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+
 static const canard_subscription_vtable_t capture_sub_vtable = { .on_message = capture_on_message };
 
+#pragma GCC diagnostic pop
+
 // -------------------------------------------  CAN Frame Construction Helpers  ----------------------------------------
 
 // v1 16-bit subject-ID message: priority[28:26] | subject_id[25:8] | bit7=1(v1.1) | src[6:0]
@@ -1093,11 +1105,9 @@ static void test_rx_stale_session_cleanup()
     TEST_ASSERT_EQUAL_size_t(1U, cap.count);
 
     // Advance time well past session timeout (30s).
-    // Call poll() enough times to trigger session cleanup.
     // RX_SESSION_TIMEOUT is 30 * MEGA = 30_000_000 us.
     // The session is destroyed when: last_admission_ts < (now - transfer_id_timeout)
-    // and there are no in-progress slots.
-    // We need to poll enough times because poll only cleans the oldest session per call.
+    // and there are no in-progress slots. A single poll reclaims all sessions that are due.
     now_val = 35000000; // 35 seconds.
     canard_poll(&self, 0U);
 
@@ -1112,6 +1122,55 @@ static void test_rx_stale_session_cleanup()
     canard_destroy(&self);
 }
 
+// -------------------------------------  Test: stale sessions with mixed timeouts  ------------------------------------
+
+static void test_rx_stale_session_mixed_timeouts()
+{
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    init_canard(&self, &now_val, 42U);
+
+    // An older session with a long transfer-ID timeout must not hold back the reclamation of a newer one.
+    rx_capture_t          cap      = {};
+    canard_subscription_t sub_long = {};
+    canard_subscription_t sub_fast = {};
+    TEST_ASSERT_EQUAL_PTR(&sub_long,
+                          canard_subscribe_16b(&self, &sub_long, 2500U, 256U, 20000000, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_PTR(&sub_fast, canard_subscribe_16b(&self, &sub_fast, 2501U, 256U, 1000000, &capture_sub_vtable));
+    sub_long.user_context = &cap;
+    sub_fast.user_context = &cap;
+
+    const uint_least8_t  frame[]  = { 0xDDU, make_v1_single_tail(5U) };
+    const canard_bytes_t can_data = { .size = sizeof(frame), .data = frame };
+    TEST_ASSERT_TRUE(
+      canard_ingest_frame(&self, 0, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 2500U, 10U), can_data));
+    for (uint_least8_t node_id = 11U; node_id <= 20U; node_id++) {
+        TEST_ASSERT_TRUE(
+          canard_ingest_frame(&self, 500000, 0U, make_v1v1_msg_can_id(canard_prio_nominal, 2501U, node_id), can_data));
+    }
+    TEST_ASSERT_EQUAL_size_t(11U, cap.count);
+    TEST_ASSERT_TRUE((sub_fast.session_bitmap[0] != 0U) && (sub_long.session_bitmap[0] != 0U));
+
+    // Not yet due.
+    now_val = 1500000;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_TRUE(sub_fast.session_bitmap[0] != 0U);
+
+    // All short-timeout sessions are reclaimed in a single poll; the long-timeout one stays.
+    now_val = 1500001;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_UINT64(0U, sub_fast.session_bitmap[0]);
+    TEST_ASSERT_TRUE(sub_long.session_bitmap[0] != 0U);
+
+    now_val = 20000001;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_UINT64(0U, sub_long.session_bitmap[0]);
+
+    canard_unsubscribe(&self, &sub_long);
+    canard_unsubscribe(&self, &sub_fast);
+    canard_destroy(&self);
+}
+
 // -------------------------------------------  Test: v0 multiframe roundtrip  -----------------------------------------
 
 static void test_rx_v0_multiframe_roundtrip()
@@ -1532,6 +1591,7 @@ int main()
 
     // Session lifecycle.
     RUN_TEST(test_rx_stale_session_cleanup);
+    RUN_TEST(test_rx_stale_session_mixed_timeouts);
 
     // Legacy v0.
     RUN_TEST(test_rx_v0_multiframe_roundtrip);
@@ -0,0 +1,287 @@
+// This software is distributed under the terms of the MIT License.
+// Copyright (c) OpenCyphal Development Team.
+
+#include "helpers.h"
+#include <unity.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// -------------------------------------------  Instance Setup  --------------------------------------------------------
+
+static void* std_alloc_mem(const canard_mem_t, const size_t size) { return std::malloc(size); }
+static void  std_free_mem(const canard_mem_t, const size_t, void* const pointer) { std::free(pointer); }
+
+static const canard_mem_vtable_t std_mem_vtable = { .free = std_free_mem, .alloc = std_alloc_mem };
+
+static canard_us_t mock_now(const canard_t* const self)
+{
+    return (self->user_context != nullptr) ? *static_cast<const canard_us_t*>(self->user_context) : 0;
+}
+static bool mock_tx(canard_t* const,
+                    void* const,
+                    const canard_us_t,
+                    const uint_least8_t,
+                    const bool,
+                    const uint32_t,
+                    const canard_bytes_t)
+{
+    return false;
+}
+
+static const canard_vtable_t test_vtable = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
+
+// The payloads are released back into the slab as the application would do.
+struct slab_capture_t
+{
+    canard_slab_t* slab;
+    size_t         count;
+    size_t         payload_size;
+    uint_least8_t  payload_buf[64];
+    bool           keep; // Do not release the payload; the test will do it later.
+    void*          kept; // The origin of the last kept payload.
+    size_t         kept_size;
+};
+
+static void capture_on_message(canard_subscription_t* const self,
+                               const canard_us_t,
+                               const canard_prio_t,
+                               const uint_least8_t,
+                               const uint_least8_t,
+                               // cppcheck-suppress passedByValueCallback
+                               const canard_payload_t payload)
+{
+    auto* const cap = static_cast<slab_capture_t*>(self->user_context);
+    cap->count++;
+    cap->payload_size = payload.view.size;
+    if (payload.view.size <= sizeof(cap->payload_buf)) {
+        std::memcpy(cap->payload_buf, payload.view.data, payload.view.size);
+    }
+    if (cap->keep) {
+        cap->kept      = payload.origin.data;
+        cap->kept_size = payload.origin.size;
+    } else if (payload.origin.data != nullptr) {
+        const canard_mem_t mem = canard_slab_mem(cap->slab);
+        mem.vtable->free(mem, payload.origin.size, payload.origin.data);
+    }
+}
+
+static const canard_subscription_vtable_t capture_sub_vtable = { .on_message       = capture_on_message,
+                                                                 .on_message_chain = nullptr };
+
+// CRC-16/CCITT-FALSE as used by multi-frame Cyphal/CAN transfers.
+static uint16_t crc16_ccitt(const uint_least8_t* const data, const size_t size)
+{
+    uint32_t crc = 0xFFFFU;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= static_cast<uint32_t>(data[i]) << 8U;
+        for (size_t k = 0; k < 8; k++) {
+            crc = (((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U)) & 0xFFFFU;
+        }
+    }
+    return static_cast<uint16_t>(crc);
+}
+
+// v1.1 message: priority[28:26] | subject_id[25:8] | bit7=1(v1.1) | src[6:0]
+static uint32_t make_v1v1_msg_can_id(const uint16_t subject_id, const uint_least8_t src)
+{
+    return (static_cast<uint32_t>(canard_prio_nominal) << 26U) | (static_cast<uint32_t>(subject_id) << 8U) |
+           (UINT32_C(1) << 7U) | (static_cast<uint32_t>(src) & 0x7FU);
+}
+
+// A two-frame transfer with 10 bytes of payload; the frames are stored in f0 and f1.
+static void make_transfer(const uint_least8_t tid, uint_least8_t (&f0)[8], uint_least8_t (&f1)[6])
+{
+    const uint_least8_t payload[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const uint16_t      crc         = crc16_ccitt(payload, sizeof(payload));
+    std::memcpy(f0, payload, 7U);
+    f0[7] = static_cast<uint_least8_t>(0xA0U | (tid & 0x1FU));
+    std::memcpy(f1, &payload[7], 3U);
+    f1[3] = static_cast<uint_least8_t>(crc >> 8U);
+    f1[4] = static_cast<uint_least8_t>(crc & 0xFFU);
+    f1[5] = static_cast<uint_least8_t>(0x40U | (tid & 0x1FU));
+}
+
+// -------------------------------------------  Tests  -----------------------------------------------------------------
+
+static void test_slab_basic()
+{
+    instrumented_allocator_t alloc;
+    instrumented_allocator_new(&alloc);
+    canard_slab_t slab;
+    TEST_ASSERT_FALSE(canard_slab_new(nullptr, instrumented_allocator_make_resource(&alloc), 0U));
+    TEST_ASSERT_FALSE(canard_slab_new(&slab, canard_mem_t{ .vtable = nullptr, .context = nullptr }, 0U));
+    TEST_ASSERT_TRUE(canard_slab_new(&slab, instrumented_allocator_make_resource(&alloc), 0U));
+    const canard_mem_t mem = canard_slab_mem(&slab);
+
+    // No class yet: the allocation is forwarded.
+    TEST_ASSERT_NULL(canard_slab_stats(&slab, 100U));
+    void* const a = mem.vtable->alloc(mem, 100U);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_EQUAL_UINT64(1U, slab.passthrough);
+    TEST_ASSERT_EQUAL_size_t(1U, alloc.allocated_fragments);
+
+    // Too small for a class.
+    TEST_ASSERT_FALSE(canard_slab_reserve(&slab, 1U, 1U));
+    TEST_ASSERT_FALSE(canard_slab_reserve(nullptr, 100U, 1U));
+
+    // Create the class and pre-allocate.
+    TEST_ASSERT_TRUE(canard_slab_reserve(&slab, 100U, 2U));
+    const canard_slab_stats_t* const st = canard_slab_stats(&slab, 100U);
+    TEST_ASSERT_NOT_NULL(st);
+    TEST_ASSERT_EQUAL_size_t(2U, st->cached);
+    TEST_ASSERT_EQUAL_size_t(3U, alloc.allocated_fragments);
+
+    // The block allocated before the class existed is adopted on free.
+    mem.vtable->free(mem, 100U, a);
+    TEST_ASSERT_EQUAL_size_t(3U, st->cached);
+    TEST_ASSERT_EQUAL_size_t(0U, st->in_use);
+    TEST_ASSERT_EQUAL_size_t(3U, alloc.allocated_fragments);
+
+    // Allocations are served from the free list, then from upstream.
+    void* blocks[4] = {};
+    for (auto& b : blocks) {
+        b = mem.vtable->alloc(mem, 100U);
+        TEST_ASSERT_NOT_NULL(b);
+    }
+    TEST_ASSERT_EQUAL_UINT64(3U, st->hits);
+    TEST_ASSERT_EQUAL_UINT64(1U, st->misses);
+    TEST_ASSERT_EQUAL_size_t(4U, st->in_use);
+    TEST_ASSERT_EQUAL_size_t(4U, st->in_use_max);
+    TEST_ASSERT_EQUAL_size_t(0U, st->cached);
+    for (auto* const b : blocks) {
+        mem.vtable->free(mem, 100U, b);
+    }
+    TEST_ASSERT_EQUAL_size_t(0U, st->in_use);
+    TEST_ASSERT_EQUAL_size_t(4U, st->in_use_max);
+    TEST_ASSERT_EQUAL_size_t(4U, st->cached);
+    TEST_ASSERT_EQUAL_size_t(4U, alloc.allocated_fragments); // Not returned upstream.
+
+    // Upstream OOM is reported by reserve and by alloc.
+    alloc.limit_fragments = alloc.allocated_fragments;
+    TEST_ASSERT_FALSE(canard_slab_reserve(&slab, 100U, 5U));
+    TEST_ASSERT_EQUAL_size_t(4U, st->cached);
+    TEST_ASSERT_NULL(mem.vtable->alloc(mem, 200U));
+    alloc.limit_fragments = SIZE_MAX;
+
+    // The class table is limited.
+    for (size_t i = 1; i < CANARD_SLAB_CLASS_COUNT; i++) {
+        TEST_ASSERT_TRUE(canard_slab_reserve(&slab, 100U + i, 0U));
+    }
+    TEST_ASSERT_FALSE(canard_slab_reserve(&slab, 1000U, 0U));
+    TEST_ASSERT_TRUE(canard_slab_reserve(&slab, 100U, 0U)); // Existing class.
+
+    canard_slab_destroy(&slab);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+    canard_slab_destroy(nullptr); // No effect.
+}
+
+// The slab used as the rx_payload resource gets a class per subscription extent, pre-warmed at subscribe time.
+static void test_slab_rx_payload()
+{
+    instrumented_allocator_t alloc;
+    instrumented_allocator_new(&alloc);
+    canard_slab_t slab;
+    TEST_ASSERT_TRUE(canard_slab_new(&slab, instrumented_allocator_make_resource(&alloc), 2U));
+
+    const canard_mem_t     r   = { .vtable = &std_mem_vtable, .context = nullptr };
+    const canard_mem_set_t mem = {
+        .tx_transfer = r, .tx_frame = r, .rx_session = r, .rx_payload = canard_slab_mem(&slab), .rx_filters = r
+    };
+    canard_t    self    = {};
+    canard_us_t now_val = 0;
+    TEST_ASSERT_TRUE(canard_new(&self, &test_vtable, mem, CANARD_IFACE_BITMAP_ALL, 16U, 1234U, 0U));
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 42U));
+    self.user_context = &now_val;
+
+    slab_capture_t        cap = {};
+    canard_subscription_t sub = {};
+    cap.slab                  = &slab;
+    TEST_ASSERT_EQUAL_PTR(&sub, canard_subscribe_16b(&self, &sub, 1000U, 32U, 2000000, &capture_sub_vtable));
+    sub.user_context = &cap;
+    TEST_ASSERT_EQUAL_size_t(1U, slab.class_count);
+    const canard_slab_stats_t* const st = &slab.classes[0].stats;
+    TEST_ASSERT_EQUAL_size_t(2U, st->cached);
+    TEST_ASSERT_TRUE(slab.classes[0].size > 32U);
+
+    // Sequential transfers reuse the same block.
+    uint_least8_t f0[8] = {};
+    uint_least8_t f1[6] = {};
+    for (uint_least8_t tid = 0; tid < 5U; tid++) {
+        make_transfer(tid, f0, f1);
+        now_val += 1000;
+        const uint32_t can_id = make_v1v1_msg_can_id(1000U, 10U);
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, can_id, { sizeof(f0), f0 }));
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, can_id, { sizeof(f1), f1 }));
+    }
+    TEST_ASSERT_EQUAL_size_t(5U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(10U, cap.payload_size);
+    TEST_ASSERT_EQUAL_UINT64(5U, st->hits);
+    TEST_ASSERT_EQUAL_UINT64(0U, st->misses);
+    TEST_ASSERT_EQUAL_size_t(1U, st->in_use_max);
+
+    // Interleaved transfers from three nodes need three blocks at once; the third one is a miss.
+    now_val += 1000;
+    for (uint_least8_t src = 20; src < 23U; src++) {
+        make_transfer(0U, f0, f1);
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, make_v1v1_msg_can_id(1000U, src), { 8U, f0 }));
+    }
+    TEST_ASSERT_EQUAL_size_t(3U, st->in_use);
+    for (uint_least8_t src = 20; src < 23U; src++) {
+        TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, make_v1v1_msg_can_id(1000U, src), { 6U, f1 }));
+    }
+    TEST_ASSERT_EQUAL_size_t(8U, cap.count);
+    TEST_ASSERT_EQUAL_UINT64(1U, st->misses);
+    TEST_ASSERT_EQUAL_size_t(3U, st->in_use_max);
+    TEST_ASSERT_EQUAL_size_t(0U, st->in_use);
+    TEST_ASSERT_EQUAL_size_t(3U, st->cached);
+
+    // A delivered payload can be kept by the application and freed later via the slab.
+    cap.keep = true;
+    make_transfer(1U, f0, f1);
+    now_val += 1000;
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, make_v1v1_msg_can_id(1000U, 20U), { 8U, f0 }));
+    TEST_ASSERT_TRUE(canard_ingest_frame(&self, now_val, 0U, make_v1v1_msg_can_id(1000U, 20U), { 6U, f1 }));
+    TEST_ASSERT_EQUAL_size_t(1U, st->in_use);
+    TEST_ASSERT_EQUAL_size_t(slab.classes[0].size, cap.kept_size);
+    const canard_mem_t payload_mem = canard_slab_mem(&slab);
+    payload_mem.vtable->free(payload_mem, cap.kept_size, cap.kept);
+    TEST_ASSERT_EQUAL_size_t(0U, st->in_use);
+
+    // Subscriptions with the same extent share the class.
+    canard_subscription_t sub2 = {};
+    TEST_ASSERT_EQUAL_PTR(&sub2, canard_subscribe_16b(&self, &sub2, 1001U, 32U, 2000000, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_size_t(1U, slab.class_count);
+    canard_subscription_t sub3 = {};
+    TEST_ASSERT_EQUAL_PTR(&sub3, canard_subscribe_16b(&self, &sub3, 1002U, 48U, 2000000, &capture_sub_vtable));
+    TEST_ASSERT_EQUAL_size_t(2U, slab.class_count);
+    TEST_ASSERT_EQUAL_size_t(2U, slab.classes[1].stats.cached);
+
+    canard_unsubscribe(&self, &sub);
+    canard_unsubscribe(&self, &sub2);
+    canard_unsubscribe(&self, &sub3);
+    canard_destroy(&self);
+    canard_slab_destroy(&slab);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+}
+
+// -------------------------------------------  Harness  ---------------------------------------------------------------
+
+extern "C" void setUp() {}
+extern "C" void tearDown() {}
+
+int main()
+{
+    seed_prng();
+    UNITY_BEGIN();
+    RUN_TEST(test_slab_basic);
+    RUN_TEST(test_slab_rx_payload);
+    return UNITY_END();
+}
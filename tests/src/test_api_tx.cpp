@@ -32,7 +32,14 @@ static bool        mock_tx(canard_t* const,
     return false;
 }
 // Shared vtable and memory resources used by canard_new() tests.
-static const canard_vtable_t test_vtable = { .now = mock_now, .tx = mock_tx, .filter = nullptr };
+static const canard_vtable_t test_vtable = {
+    .now       = mock_now,
+    .tx        = mock_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 static const canard_mem_vtable_t std_mem_vtable = { .free = std_free_mem, .alloc = std_alloc_mem };
 
@@ -85,7 +92,14 @@ static bool capture_tx(canard_t* const self,
     return cap->accept_tx;
 }
 
-static const canard_vtable_t capture_vtable = { .now = capture_now, .tx = capture_tx, .filter = nullptr };
+static const canard_vtable_t capture_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
 
 static canard_mem_set_t make_std_memory()
 {
@@ -5,10 +5,13 @@
 
 #include "helpers.h"
 #include <unity.h>
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <vector>
 
 // =====================================================================================================================
 // TX capture infrastructure: records outgoing frames for post-hoc verification.
@@ -26,12 +29,33 @@ struct tx_record_t
     uint_least8_t data[64]; // Enough for the largest CAN FD frame.
 };
 
+struct tx_done_t
+{
+    void*               user_context;
+    canard_tx_outcome_t outcome;
+    canard_us_t         enqueue_ts;
+    canard_us_t         first_frame_ts;
+    canard_us_t         last_frame_ts;
+    uint_least8_t       iface_bitmap;
+};
+
 struct tx_capture_t
 {
     canard_us_t                  now;
     bool                         accept_tx;
+    size_t                       quota; // Frames to accept; once exhausted, the TX callback rejects without recording.
+    size_t                       peak_queue_size;
+    size_t                       gathered;   // Frames submitted via tx_gather().
+    size_t                       batches;    // Calls to tx_batch().
+    size_t                       max_batch;  // The largest number of frames passed to tx_batch() at once.
+    size_t                       referenced; // Fragments passed to tx_gather() that point into app_buffer.
+    const void*                  app_buffer;
+    size_t                       app_buffer_size;
     size_t                       count;
     std::array<tx_record_t, 128> records;
+    size_t                       done_count; // Calls to tx_done().
+    std::array<tx_done_t, 16>    done;
+    std::vector<size_t>          released_at; // The done_count at each payload release, see record_release().
 };
 
 static tx_capture_t* capture_from(const canard_t* const self) { return static_cast<tx_capture_t*>(self->user_context); }
@@ -48,6 +72,11 @@ static bool capture_tx(canard_t* const self,
 {
     tx_capture_t* const cap = capture_from(self);
     TEST_ASSERT_NOT_NULL(cap);
+    if (cap->quota == 0U) {
+        return false;
+    }
+    cap->quota--;
+    cap->peak_queue_size = std::max(cap->peak_queue_size, self->tx.queue_size);
     if (cap->count < cap->records.size()) {
         tx_record_t& rec = cap->records[cap->count];
         rec.deadline     = deadline;
@@ -66,7 +95,123 @@ static bool capture_tx(canard_t* const self,
     return cap->accept_tx;
 }
 
-static const canard_vtable_t capture_vtable = { .now = capture_now, .tx = capture_tx, .filter = nullptr };
+static const canard_vtable_t capture_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
+
+// Flattens the fragments and records the frame like capture_tx() does.
+static bool capture_tx_gather(canard_t* const            self,
+                              void* const                user_context,
+                              const canard_us_t          deadline,
+                              const uint_least8_t        iface_index,
+                              const bool                 fd,
+                              const uint32_t             extended_can_id,
+                              const canard_bytes_chain_t can_data)
+{
+    tx_capture_t* const           cap = capture_from(self);
+    std::array<uint_least8_t, 64> flat{};
+    size_t                        size = 0;
+    for (const canard_bytes_chain_t* it = &can_data; it != nullptr; it = it->next) {
+        TEST_ASSERT_TRUE((size + it->bytes.size) <= flat.size());
+        if (it->bytes.size > 0U) {
+            std::memcpy(&flat.at(size), it->bytes.data, it->bytes.size);
+        }
+        size += it->bytes.size;
+        const auto* const begin = static_cast<const uint_least8_t*>(cap->app_buffer);
+        const auto* const ptr   = static_cast<const uint_least8_t*>(it->bytes.data);
+        if ((cap->quota > 0U) && std::less_equal<>()(begin, ptr) && std::less<>()(ptr, begin + cap->app_buffer_size)) {
+            cap->referenced++;
+        }
+    }
+    if (cap->quota > 0U) {
+        cap->gathered++;
+    }
+    const canard_bytes_t frame = { .size = size, .data = flat.data() };
+    return capture_tx(self, user_context, deadline, iface_index, fd, extended_can_id, frame);
+}
+
+static const canard_vtable_t capture_gather_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = capture_tx_gather,
+    .tx_batch  = nullptr,
+    .tx_done   = nullptr,
+};
+
+// Records the frames one by one like capture_tx() does until one is rejected.
+static size_t capture_tx_batch(canard_t* const                self,
+                               const uint_least8_t            iface_index,
+                               const canard_tx_frame_t* const frames,
+                               const size_t                   count)
+{
+    tx_capture_t* const cap = capture_from(self);
+    TEST_ASSERT_TRUE((count > 0U) && (count <= CANARD_TX_BATCH_SIZE));
+    cap->batches++;
+    cap->max_batch  = std::max(cap->max_batch, count);
+    size_t accepted = 0;
+    while ((accepted < count) && capture_tx(self,
+                                            frames[accepted].user_context,
+                                            frames[accepted].deadline,
+                                            iface_index,
+                                            frames[accepted].fd,
+                                            frames[accepted].extended_can_id,
+                                            frames[accepted].can_data)) {
+        accepted++;
+    }
+    return accepted;
+}
+
+static const canard_vtable_t capture_batch_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = capture_tx_batch,
+    .tx_done   = nullptr,
+};
+static const canard_vtable_t capture_batch_gather_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = capture_tx_gather,
+    .tx_batch  = capture_tx_batch,
+    .tx_done   = nullptr,
+};
+
+static void capture_tx_done(canard_t* const           self,
+                            void* const               user_context,
+                            const canard_tx_outcome_t outcome,
+                            const canard_us_t         enqueue_ts,
+                            const canard_us_t         first_frame_ts,
+                            const canard_us_t         last_frame_ts,
+                            const uint_least8_t       iface_bitmap)
+{
+    tx_capture_t* const cap = capture_from(self);
+    TEST_ASSERT_TRUE(cap->done_count < cap->done.size());
+    cap->done.at(cap->done_count++) = tx_done_t{
+        .user_context   = user_context,
+        .outcome        = outcome,
+        .enqueue_ts     = enqueue_ts,
+        .first_frame_ts = first_frame_ts,
+        .last_frame_ts  = last_frame_ts,
+        .iface_bitmap   = iface_bitmap,
+    };
+}
+
+static const canard_vtable_t capture_done_vtable = {
+    .now       = capture_now,
+    .tx        = capture_tx,
+    .filter    = nullptr,
+    .tx_gather = nullptr,
+    .tx_batch  = nullptr,
+    .tx_done   = capture_tx_done,
+};
 
 // =====================================================================================================================
 // Instrumented-allocator-backed memory set for leak/OOM tracking.
@@ -124,6 +269,7 @@ static void init_node(canard_t* const     self,
     *cap           = tx_capture_t{};
     cap->now       = 0;
     cap->accept_tx = true;
+    cap->quota     = SIZE_MAX;
     cap->count     = 0;
     mem_pool_new(pool);
     TEST_ASSERT_TRUE(
@@ -192,6 +338,232 @@ static void test_tx_queue_sacrifice_oldest()
     mem_pool_verify_no_leaks(&pool);
 }
 
+// Publishes a single-frame transfer on iface 0 with the transfer-ID used as a tag.
+static bool publish_tagged(canard_t* const     self,
+                           const canard_us_t   deadline,
+                           const canard_prio_t prio,
+                           const uint16_t      subject_id,
+                           const uint_least8_t tag)
+{
+    return canard_publish_16b(self, deadline, 1U, prio, subject_id, tag, make_empty_payload(), nullptr);
+}
+
+// Ejects everything from iface 0 and returns the tags in the ejection order.
+static std::vector<uint_least8_t> drain_tags(canard_t* const self, tx_capture_t* const cap)
+{
+    cap->count = 0;
+    canard_poll(self, 1U);
+    std::vector<uint_least8_t> out;
+    for (size_t i = 0; i < cap->count; i++) {
+        out.push_back(tid_from_tail(cap->records[i].tail));
+    }
+    return out;
+}
+
+// =====================================================================================================================
+// Test 1a: test_tx_queue_sacrifice_lowest_priority
+//   The transfer that would be transmitted last is sacrificed; a new transfer that would be transmitted last itself
+//   is rejected instead, leaving the queue intact.
+// =====================================================================================================================
+static void test_tx_queue_sacrifice_lowest_priority()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 3U, 42U);
+    self.tx.sacrifice_policy = canard_tx_sacrifice_lowest_priority;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_exceptional, 1U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_optional, 10U, 1U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_optional, 5U, 2U));
+    // The oldest (exceptional) one survives; the optional one with the greater subject-ID goes.
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 3U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_optional]);
+    // A new optional transfer that loses the arbitration against the queued optional one is rejected.
+    TEST_ASSERT_FALSE(publish_tagged(&self, 10000, canard_prio_optional, 20U, 4U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+    // One that wins it replaces the queued one.
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_optional, 4U, 5U));
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice_by_prio[canard_prio_optional]);
+
+    const std::vector<uint_least8_t> expected = { 0U, 3U, 5U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 1b: test_tx_queue_sacrifice_oldest_lowest_priority
+//   The oldest transfer at the lowest priority level is sacrificed, but never one of a higher priority than the new.
+// =====================================================================================================================
+static void test_tx_queue_sacrifice_oldest_lowest_priority()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 3U, 42U);
+    self.tx.sacrifice_policy = canard_tx_sacrifice_oldest_lowest_priority;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 10U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 5U, 1U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_exceptional, 1U, 2U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 20U, 3U)); // Same level: the oldest goes.
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_high, 20U, 4U));
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+    TEST_ASSERT_FALSE(publish_tagged(&self, 10000, canard_prio_optional, 1U, 5U)); // Nothing as low as this.
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+
+    const std::vector<uint_least8_t> expected = { 2U, 4U, 3U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 1c: test_tx_queue_sacrifice_latest_deadline
+//   The transfer with the latest deadline is sacrificed; the new transfer is rejected if its own deadline is latest.
+// =====================================================================================================================
+static void test_tx_queue_sacrifice_latest_deadline()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 3U, 42U);
+    self.tx.sacrifice_policy = canard_tx_sacrifice_latest_deadline;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 5000, canard_prio_nominal, 100U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 90000, canard_prio_nominal, 100U, 1U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 7000, canard_prio_nominal, 100U, 2U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 8000, canard_prio_nominal, 100U, 3U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_nominal]);
+    TEST_ASSERT_FALSE(publish_tagged(&self, 8000, canard_prio_nominal, 100U, 4U)); // Ties are resolved by age.
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+
+    const std::vector<uint_least8_t> expected = { 0U, 2U, 3U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 1d: test_tx_queue_priority_reserve
+//   Space reserved for a priority level cannot be taken by the other levels; transfers at the reserved level fit
+//   without sacrificing anything while their reservation lasts.
+// =====================================================================================================================
+static void test_tx_queue_priority_reserve()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 4U, 42U);
+    self.tx.queue_reserve[canard_prio_high] = 2U;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 1U));
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_sacrifice);
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 2U)); // The reserve is off-limits.
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+    TEST_ASSERT_EQUAL_size_t(2U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(2U, self.tx.queue_size_by_prio[canard_prio_slow]);
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_high, 100U, 3U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_high, 100U, 4U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+    TEST_ASSERT_EQUAL_size_t(2U, self.tx.queue_size_by_prio[canard_prio_high]);
+    // Beyond the reservation, the high-priority transfers compete for the shared space as usual.
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_high, 100U, 5U));
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 6U));
+    TEST_ASSERT_EQUAL_UINT64(3U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+    // The high-priority transfers above the reservation may be sacrificed for the other levels...
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 7U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_high]);
+    // ...but those within it are not, even though they are older.
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 8U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_high]);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_nominal]);
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_capacity);
+
+    const std::vector<uint_least8_t> expected = { 4U, 5U, 7U, 8U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    for (size_t i = 0; i < CANARD_PRIO_COUNT; i++) {
+        TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size_by_prio[i]);
+    }
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 1e: test_tx_queue_priority_reserve_latest_deadline
+//   The latest-deadline policy skips the transfers protected by their reservation.
+// =====================================================================================================================
+static void test_tx_queue_priority_reserve_latest_deadline()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 3U, 42U);
+    self.tx.sacrifice_policy                = canard_tx_sacrifice_latest_deadline;
+    self.tx.queue_reserve[canard_prio_high] = 1U;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 90000, canard_prio_high, 100U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 5000, canard_prio_nominal, 100U, 1U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 7000, canard_prio_nominal, 100U, 2U));
+    TEST_ASSERT_FALSE(publish_tagged(&self, 8000, canard_prio_nominal, 100U, 3U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+    TEST_ASSERT_TRUE(publish_tagged(&self, 6000, canard_prio_nominal, 100U, 4U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_nominal]);
+
+    const std::vector<uint_least8_t> expected = { 0U, 1U, 4U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 1f: test_tx_queue_priority_limit
+//   A priority level cannot take more than its limit; its own transfers are sacrificed to stay within it.
+// =====================================================================================================================
+static void test_tx_queue_priority_limit()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 4U, 42U);
+    TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_limit[canard_prio_slow]); // No quotas by default.
+    self.tx.queue_limit[canard_prio_slow]     = 2U;
+    self.tx.queue_limit[canard_prio_optional] = 0U;
+
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 0U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 1U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 2U));
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 100U, 3U)); // The oldest slow one goes.
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+    TEST_ASSERT_EQUAL_size_t(3U, self.tx.queue_size);
+    TEST_ASSERT_FALSE(publish_tagged(&self, 10000, canard_prio_optional, 100U, 4U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+    TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 5U));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+
+    const std::vector<uint_least8_t> expected = { 0U, 5U, 2U, 3U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
 // =====================================================================================================================
 // Test 2: test_tx_queue_sacrifice_multiframe_reclaims_all
 //   queue_capacity=4. Publish one 3-frame multiframe (Classic CAN, ~20 bytes payload) and one single-frame.
@@ -264,6 +636,107 @@ static void test_tx_queue_sacrifice_multiple_rounds()
     mem_pool_verify_no_leaks(&pool);
 }
 
+// =====================================================================================================================
+// Test 3a: test_tx_queue_sacrifice_multiframe_intact
+//   A multi-frame transfer that needs several victims is rejected without sacrificing anything if the policy would
+//   choose the new transfer itself before enough room is made; otherwise, all victims are sacrificed at once.
+//   The default policy is not affected: it evicts the oldest transfers until there is room or nothing is left.
+// =====================================================================================================================
+static void test_tx_queue_sacrifice_multiframe_intact()
+{
+    const uint_least8_t        multi_data[13] = {};
+    const canard_bytes_chain_t multi_payload  = make_payload(multi_data, sizeof(multi_data)); // 3 Classic CAN frames.
+    {
+        canard_t     self = {};
+        tx_capture_t cap  = {};
+        mem_pool_t   pool = {};
+        init_node(&self, &cap, &pool, 4U, 42U);
+        self.tx.fd               = false;
+        self.tx.sacrifice_policy = canard_tx_sacrifice_lowest_priority;
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 10U, 0U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 1U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 2U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_slow, 20U, 3U));
+        // The slow ones make room for two frames only, then the new transfer would be transmitted last.
+        TEST_ASSERT_FALSE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 200U, 4U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+        TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_sacrifice);
+        TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+        // One that wins the arbitration against the queued nominal ones replaces both slow ones and one nominal.
+        TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 50U, 5U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(3U, self.err.tx_sacrifice);
+        TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice_by_prio[canard_prio_slow]);
+        TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice_by_prio[canard_prio_nominal]);
+        TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+        const std::vector<uint_least8_t> expected = { 5U, 5U, 5U, 1U };
+        TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+        canard_destroy(&self);
+        mem_pool_verify_no_leaks(&pool);
+    }
+    {
+        canard_t     self = {};
+        tx_capture_t cap  = {};
+        mem_pool_t   pool = {};
+        init_node(&self, &cap, &pool, 4U, 42U);
+        self.tx.fd               = false;
+        self.tx.sacrifice_policy = canard_tx_sacrifice_latest_deadline;
+        TEST_ASSERT_TRUE(publish_tagged(&self, 90000, canard_prio_nominal, 100U, 0U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 80000, canard_prio_nominal, 100U, 1U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 5000, canard_prio_nominal, 100U, 2U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 6000, canard_prio_nominal, 100U, 3U));
+        // Only two transfers have a later deadline than the new one.
+        TEST_ASSERT_FALSE(canard_publish_16b(&self, 50000, 1U, canard_prio_nominal, 100U, 4U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+        TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_sacrifice);
+        TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+        TEST_ASSERT_TRUE(canard_publish_16b(&self, 5500, 1U, canard_prio_nominal, 100U, 5U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(3U, self.err.tx_sacrifice);
+        const std::vector<uint_least8_t> expected = { 2U, 5U, 5U, 5U };
+        TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+        canard_destroy(&self);
+        mem_pool_verify_no_leaks(&pool);
+    }
+    {
+        // A victim that has made progress on one interface frees the frames still referenced by the other one.
+        canard_t     self = {};
+        tx_capture_t cap  = {};
+        mem_pool_t   pool = {};
+        init_node(&self, &cap, &pool, 4U, 42U);
+        self.tx.fd = false;
+        TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 3U, canard_prio_nominal, 100U, 0U, multi_payload, nullptr));
+        cap.quota = 1U;
+        canard_poll(&self, 1U);
+        TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+        TEST_ASSERT_EQUAL_size_t(3U, self.tx.queue_size);
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 1U));
+        cap.quota = SIZE_MAX;
+        TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 100U, 2U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+        TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+        const std::vector<uint_least8_t> expected = { 1U, 2U, 2U, 2U };
+        TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+        canard_destroy(&self);
+        mem_pool_verify_no_leaks(&pool);
+    }
+    {
+        // The default policy keeps evicting the oldest transfers even if they cannot make enough room in the end.
+        canard_t     self = {};
+        tx_capture_t cap  = {};
+        mem_pool_t   pool = {};
+        init_node(&self, &cap, &pool, 4U, 42U);
+        self.tx.fd                              = false;
+        self.tx.queue_reserve[canard_prio_fast] = 2U;
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 0U));
+        TEST_ASSERT_TRUE(publish_tagged(&self, 10000, canard_prio_nominal, 100U, 1U));
+        TEST_ASSERT_FALSE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 100U, 2U, multi_payload, nullptr));
+        TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+        TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_sacrifice);
+        TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+        canard_destroy(&self);
+        mem_pool_verify_no_leaks(&pool);
+    }
+}
+
 // =====================================================================================================================
 // Test 4: test_tx_queue_capacity_exceeded
 //   queue_capacity=2. Publish multiframe needing 4 frames.
@@ -409,6 +882,58 @@ static void test_tx_queue_ordering_fifo_same_priority()
     mem_pool_verify_no_leaks(&pool);
 }
 
+// =====================================================================================================================
+// Test 8a: test_tx_queue_arbitration_order
+//   Publish a mix of priorities and subject IDs out of order on both interfaces. Each interface ejects in the CAN
+//   arbitration order: smaller CAN ID first; identical CAN IDs in the publication order.
+// =====================================================================================================================
+static void test_tx_queue_arbitration_order()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 32U, 42U);
+
+    struct item_t
+    {
+        canard_prio_t prio;
+        uint16_t      subject_id;
+    };
+    static const std::array<item_t, 8> items   = { {
+        { canard_prio_nominal, 900U },
+        { canard_prio_fast, 50U },
+        { canard_prio_nominal, 100U },
+        { canard_prio_low, 10U },
+        { canard_prio_nominal, 900U },
+        { canard_prio_fast, 50U },
+        { canard_prio_nominal, 500U },
+        { canard_prio_exceptional, 7000U },
+    } };
+    const canard_bytes_chain_t         payload = make_empty_payload();
+    for (size_t i = 0; i < items.size(); i++) {
+        TEST_ASSERT_TRUE(canard_publish_16b(
+          &self, 10000, 3U, items[i].prio, items[i].subject_id, static_cast<uint_least8_t>(i), payload, nullptr));
+    }
+    TEST_ASSERT_EQUAL_UINT8(3U, canard_pending_ifaces(&self));
+
+    // Transfer-IDs in the expected ejection order.
+    static const std::array<uint_least8_t, 8> expected = { 7U, 1U, 5U, 2U, 6U, 0U, 4U, 3U };
+    for (uint_least8_t iface = 0; iface < 2U; iface++) {
+        cap.count = 0;
+        canard_poll(&self, static_cast<uint_least8_t>(1U << iface));
+        TEST_ASSERT_EQUAL_size_t(expected.size(), cap.count);
+        for (size_t i = 0; i < expected.size(); i++) {
+            TEST_ASSERT_EQUAL_UINT8(iface, cap.records[i].iface_index);
+            TEST_ASSERT_EQUAL_UINT8(expected[i], cap.records[i].tail & 31U);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(0U, canard_pending_ifaces(&self));
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
 // =====================================================================================================================
 // Test 9: test_tx_iface_bitmap_single
 //   Publish with iface_bitmap=1 (iface 0 only). pending_ifaces()=1. Poll(1) ejects. Poll(2) ejects nothing.
@@ -569,7 +1094,9 @@ static void test_tx_oom_frame_allocation()
     // Constrain the tx_frame allocator to 0 so frame allocation fails.
     pool.tx_frame.limit_fragments = 0U;
 
-    const canard_bytes_chain_t payload = make_empty_payload();
+    // Too large for the inline frame storage of the transfer, if enabled.
+    static const std::array<uint_least8_t, CANARD_TX_INLINE_FRAME_SIZE> data{};
+    const canard_bytes_chain_t payload = make_payload(data.data(), data.size());
     // The transfer object is allocated (from tx_transfer), but frame allocation fails inside tx_spool.
     TEST_ASSERT_FALSE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 1300U, 0U, payload, nullptr));
     TEST_ASSERT_TRUE(self.err.oom > 0U);
@@ -662,6 +1189,1123 @@ static void test_tx_backpressure_resumes()
     mem_pool_verify_no_leaks(&pool);
 }
 
+// =====================================================================================================================
+// Test 17: test_tx_latest_value_wins
+//   A latest-value-wins publication replaces the newest enqueued transfer of the same CAN ID, reusing its object.
+//   Other subjects and other priority levels are unaffected.
+// =====================================================================================================================
+static void test_tx_latest_value_wins()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+
+    const canard_bytes_chain_t payload = make_empty_payload();
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 100U, 0U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 200U, 1U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 100U, 2U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 20000, 1U, canard_prio_nominal, 100U, 3U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(2U, self.tx.coalesced);
+    TEST_ASSERT_EQUAL_size_t(2U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_UINT64(2U, pool.tx_transfer.count_alloc);
+    // Another priority level means another CAN ID.
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_fast, 100U, 4U, payload, nullptr));
+    // A regular publication is appended, but it may be replaced by a latest-value-wins one.
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 100U, 5U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 100U, 6U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(3U, self.tx.coalesced);
+    TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_UINT64(4U, pool.tx_transfer.count_alloc);
+    // The 13-bit format is coalesced the same way.
+    TEST_ASSERT_TRUE(canard_publish_13b_latest(&self, 10000, 1U, canard_prio_low, 100U, 7U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_13b_latest(&self, 10000, 1U, canard_prio_low, 100U, 8U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(4U, self.tx.coalesced);
+
+    const std::vector<uint_least8_t> expected = { 4U, 3U, 6U, 1U, 8U };
+    TEST_ASSERT_TRUE(drain_tags(&self, &cap) == expected);
+    TEST_ASSERT_EQUAL_INT64(20000, cap.records[1].deadline); // The deadline of the replacement.
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_sacrifice);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 18: test_tx_latest_value_wins_skips_started
+//   A transfer that has started transmission on any interface, or that targets other interfaces, is not replaced.
+// =====================================================================================================================
+static void test_tx_latest_value_wins_skips_started()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 32U, 42U);
+    self.tx.fd = false;
+
+    static const std::array<uint_least8_t, 20> data{};
+    const canard_bytes_chain_t                 payload = make_payload(data.data(), data.size()); // 4 frames
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 3U, canard_prio_nominal, 100U, 0U, payload, nullptr));
+    canard_poll(&self, 1U); // Sent via iface 0 only.
+    TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 3U, canard_prio_nominal, 100U, 1U, payload, nullptr));
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 100U, 2U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(0U, self.tx.coalesced);
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 100U, 3U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.tx.coalesced);
+
+    cap.count = 0;
+    canard_poll(&self, 3U);
+    std::array<std::vector<uint_least8_t>, 2> tids;
+    for (size_t i = 0; i < cap.count; i++) {
+        tids.at(cap.records[i].iface_index).push_back(tid_from_tail(cap.records[i].tail));
+    }
+    const std::vector<uint_least8_t> expected0 = { 1U, 1U, 1U, 1U, 3U, 3U, 3U, 3U };
+    const std::vector<uint_least8_t> expected1 = { 0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U };
+    TEST_ASSERT_TRUE(tids[0] == expected0);
+    TEST_ASSERT_TRUE(tids[1] == expected1);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+static void count_release(canard_t* const self, void* const user_context)
+{
+    TEST_ASSERT_NOT_NULL(self);
+    (*static_cast<size_t*>(user_context))++;
+}
+
+static std::vector<tx_record_t> records_of_iface(const tx_capture_t& cap, const uint_least8_t iface_index)
+{
+    std::vector<tx_record_t> out;
+    for (size_t i = 0; i < cap.count; i++) {
+        if (cap.records.at(i).iface_index == iface_index) {
+            out.push_back(cap.records.at(i));
+        }
+    }
+    return out;
+}
+
+// =====================================================================================================================
+// Test 19: test_tx_lazy_matches_eager
+//   A lazy transfer emits the same frames as an eager one on every interface, while only a few frames exist at a time
+//   if the interfaces progress at a similar pace. The payload is released once, after the last frame is generated.
+// =====================================================================================================================
+static void test_tx_lazy_matches_eager()
+{
+    static const std::array<uint_least8_t, 300> data = [] {
+        std::array<uint_least8_t, 300> out{};
+        for (size_t i = 0; i < out.size(); i++) {
+            out.at(i) = static_cast<uint_least8_t>(i * 13U);
+        }
+        return out;
+    }();
+    // Fragmented to exercise the reader across the chain boundaries.
+    const canard_bytes_chain_t tail = { .bytes = { .size = 200U, .data = &data[100] }, .next = nullptr };
+    const canard_bytes_chain_t body = { .bytes = { .size = 99U, .data = &data[1] }, .next = &tail };
+    const canard_bytes_chain_t head = { .bytes = { .size = 1U, .data = &data[0] }, .next = &body };
+    for (const bool fd : { false, true }) {
+        canard_t     ref      = {};
+        canard_t     dut      = {};
+        tx_capture_t ref_cap  = {};
+        tx_capture_t dut_cap  = {};
+        mem_pool_t   ref_pool = {};
+        mem_pool_t   dut_pool = {};
+        init_node(&ref, &ref_cap, &ref_pool, 64U, 42U);
+        init_node(&dut, &dut_cap, &dut_pool, 64U, 42U);
+        ref.tx.fd = fd;
+        dut.tx.fd = fd;
+
+        size_t released = 0;
+        TEST_ASSERT_TRUE(canard_publish_16b(&ref, 10000, 3U, canard_prio_high, 1234U, 17U, head, nullptr));
+        TEST_ASSERT_TRUE(
+          canard_publish_16b_lazy(&dut, 10000, 3U, canard_prio_high, 1234U, 17U, head, count_release, &released));
+        const size_t n_frames = fd ? 5U : 44U;
+        TEST_ASSERT_EQUAL_size_t(n_frames, ref.tx.queue_size);
+        TEST_ASSERT_EQUAL_size_t(2U, dut.tx.queue_size); // The first frame and the slot reserved for the next one.
+        TEST_ASSERT_EQUAL_size_t(2U, dut_pool.tx_frame.allocated_fragments); // The first frame and the lazy state.
+        TEST_ASSERT_EQUAL_size_t(0U, released);
+
+        canard_poll(&ref, 3U);
+        while (canard_pending_ifaces(&dut) != 0U) {
+            dut_cap.quota = 1U;
+            canard_poll(&dut, 1U);
+            dut_cap.quota = 1U;
+            canard_poll(&dut, 2U);
+        }
+        TEST_ASSERT_EQUAL_size_t(1U, released);
+        TEST_ASSERT_EQUAL_size_t(n_frames * 2U, dut_cap.count);
+        TEST_ASSERT_EQUAL_size_t(n_frames, ref_cap.peak_queue_size);
+        TEST_ASSERT_TRUE(dut_cap.peak_queue_size <= 3U); // Transmitted, next, and reserved.
+        for (const uint_least8_t iface_index : { uint_least8_t{ 0U }, uint_least8_t{ 1U } }) {
+            const std::vector<tx_record_t> a = records_of_iface(ref_cap, iface_index);
+            const std::vector<tx_record_t> b = records_of_iface(dut_cap, iface_index);
+            TEST_ASSERT_EQUAL_size_t(n_frames, a.size());
+            TEST_ASSERT_EQUAL_size_t(n_frames, b.size());
+            for (size_t i = 0; i < n_frames; i++) {
+                TEST_ASSERT_EQUAL_UINT32(a.at(i).can_id, b.at(i).can_id);
+                TEST_ASSERT_EQUAL(a.at(i).fd, b.at(i).fd);
+                TEST_ASSERT_EQUAL_size_t(a.at(i).data_size, b.at(i).data_size);
+                TEST_ASSERT_EQUAL_MEMORY(a.at(i).data, b.at(i).data, a.at(i).data_size);
+            }
+        }
+        TEST_ASSERT_EQUAL_size_t(0U, dut.tx.queue_size);
+        TEST_ASSERT_EQUAL_UINT64(0U, dut.err.oom);
+
+        canard_destroy(&ref);
+        canard_destroy(&dut);
+        mem_pool_verify_no_leaks(&ref_pool);
+        mem_pool_verify_no_leaks(&dut_pool);
+    }
+}
+
+// =====================================================================================================================
+// Test 20: test_tx_lazy_release_and_stall
+//   The payload is released immediately if it fits into one frame, never if the publication fails, and upon retirement
+//   if the transfer is removed before the last frame is generated. OOM while generating a frame stalls the interface.
+// =====================================================================================================================
+static void test_tx_lazy_release_and_stall()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+    self.tx.fd = false;
+
+    static const std::array<uint_least8_t, 100> data{};
+    const canard_bytes_chain_t                  small    = make_payload(data.data(), 5U);
+    const canard_bytes_chain_t                  payload  = make_payload(data.data(), data.size()); // 15 frames.
+    size_t                                      released = 0;
+
+    // A single-frame payload is copied and released right away.
+    TEST_ASSERT_TRUE(
+      canard_publish_13b_lazy(&self, 10000, 1U, canard_prio_nominal, 100U, 0U, small, count_release, &released));
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    TEST_ASSERT_EQUAL_size_t(1U, self.tx.queue_size);
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+
+    // A failed publication does not release the payload.
+    pool.tx_transfer.limit_fragments = 0U;
+    TEST_ASSERT_FALSE(
+      canard_publish_16b_lazy(&self, 10000, 1U, canard_prio_nominal, 100U, 1U, payload, count_release, &released));
+    pool.tx_transfer.limit_fragments = SIZE_MAX;
+    TEST_ASSERT_FALSE(
+      canard_publish_16b_lazy(&self, 10000, 4U, canard_prio_nominal, 100U, 1U, payload, count_release, &released));
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_frame.allocated_fragments);
+
+    // Expiration before the last frame is generated releases the payload.
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_lazy(&self, 10000, 1U, canard_prio_nominal, 100U, 2U, payload, count_release, &released));
+    cap.quota = 3U;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    cap.now = 10001;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(2U, released);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_expiration);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_frame.allocated_fragments);
+
+    // OOM while generating the next frame stalls the interface until memory is available.
+    cap.quota = SIZE_MAX;
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_lazy(&self, 20000, 1U, canard_prio_nominal, 100U, 3U, payload, count_release, &released));
+    pool.tx_frame.limit_fragments = pool.tx_frame.allocated_fragments;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.oom); // Including the failed publication above.
+    TEST_ASSERT_EQUAL_UINT8(1U, canard_pending_ifaces(&self));
+    pool.tx_frame.limit_fragments = SIZE_MAX;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(4U + 15U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(3U, released);
+    TEST_ASSERT_EQUAL_UINT8(0xA3U, cap.records.at(4).tail);  // SOT, toggle, transfer-ID 3.
+    TEST_ASSERT_EQUAL_UINT8(0x63U, cap.records.at(18).tail); // EOT, toggle, transfer-ID 3.
+    TEST_ASSERT_EQUAL_UINT8(0U, canard_pending_ifaces(&self));
+
+    // Destruction releases a pending lazy transfer as well.
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_lazy(&self, 30000, 1U, canard_prio_nominal, 100U, 4U, payload, count_release, &released));
+    canard_destroy(&self);
+    TEST_ASSERT_EQUAL_size_t(4U, released);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 21: test_tx_zero_copy_matches_eager
+//   Zero-copy frames submitted via tx_gather() match the eager ones and reference the application buffer unless it is
+//   too fragmented. The payload is released only after every interface has ejected the last frame.
+// =====================================================================================================================
+static void test_tx_zero_copy_matches_eager()
+{
+    static const std::array<uint_least8_t, 300> data = [] {
+        std::array<uint_least8_t, 300> out{};
+        for (size_t i = 0; i < out.size(); i++) {
+            out.at(i) = static_cast<uint_least8_t>((i * 29U) + 3U);
+        }
+        return out;
+    }();
+    const canard_bytes_chain_t tail = { .bytes = { .size = 200U, .data = &data[100] }, .next = nullptr };
+    const canard_bytes_chain_t body = { .bytes = { .size = 99U, .data = &data[1] }, .next = &tail };
+    const canard_bytes_chain_t head = { .bytes = { .size = 1U, .data = &data[0] }, .next = &body };
+    // The same data in single-byte fragments, which is too fragmented to be referenced.
+    std::array<canard_bytes_chain_t, 300> shredded{};
+    for (size_t i = 0; i < shredded.size(); i++) {
+        shredded.at(i).bytes = { .size = 1U, .data = &data.at(i) };
+        shredded.at(i).next  = ((i + 1U) < shredded.size()) ? &shredded.at(i + 1U) : nullptr;
+    }
+    const std::array<const canard_bytes_chain_t*, 2> payloads = { &head, &shredded.front() };
+    for (const bool fd : { false, true }) {
+        for (const canard_bytes_chain_t* const payload : payloads) {
+            canard_t     ref      = {};
+            canard_t     dut      = {};
+            tx_capture_t ref_cap  = {};
+            tx_capture_t dut_cap  = {};
+            mem_pool_t   ref_pool = {};
+            mem_pool_t   dut_pool = {};
+            init_node(&ref, &ref_cap, &ref_pool, 64U, 42U);
+            init_node(&dut, &dut_cap, &dut_pool, 64U, 42U);
+            ref.tx.fd               = fd;
+            dut.tx.fd               = fd;
+            dut.vtable              = &capture_gather_vtable;
+            dut_cap.app_buffer      = data.data();
+            dut_cap.app_buffer_size = data.size();
+
+            size_t released = 0;
+            TEST_ASSERT_TRUE(canard_publish_13b(&ref, 10000, 3U, canard_prio_fast, 321U, 9U, *payload, nullptr));
+            TEST_ASSERT_TRUE(canard_publish_13b_zero_copy(
+              &dut, 10000, 3U, canard_prio_fast, 321U, 9U, *payload, count_release, &released));
+            const size_t n_frames = fd ? 5U : 44U;
+            TEST_ASSERT_EQUAL_size_t(2U, dut.tx.queue_size);
+            TEST_ASSERT_TRUE(dut_pool.tx_frame.allocated_bytes < ref_pool.tx_frame.allocated_bytes);
+
+            canard_poll(&ref, 3U);
+            canard_poll(&dut, 1U);
+            TEST_ASSERT_EQUAL_size_t(n_frames, dut_cap.count);
+            TEST_ASSERT_EQUAL_size_t(0U, released); // Still referenced by the frames pending on the other interface.
+            canard_poll(&dut, 2U);
+            TEST_ASSERT_EQUAL_size_t(1U, released);
+            TEST_ASSERT_EQUAL_size_t(n_frames * 2U, dut_cap.count);
+            TEST_ASSERT_EQUAL_size_t(n_frames * 2U, dut_cap.gathered);
+            if (payload == &head) {
+                TEST_ASSERT_TRUE(dut_cap.referenced >= (n_frames * 2U));
+            } else {
+                TEST_ASSERT_EQUAL_size_t(0U, dut_cap.referenced);
+            }
+            for (const uint_least8_t iface_index : { uint_least8_t{ 0U }, uint_least8_t{ 1U } }) {
+                const std::vector<tx_record_t> a = records_of_iface(ref_cap, iface_index);
+                const std::vector<tx_record_t> b = records_of_iface(dut_cap, iface_index);
+                TEST_ASSERT_EQUAL_size_t(n_frames, a.size());
+                TEST_ASSERT_EQUAL_size_t(n_frames, b.size());
+                for (size_t i = 0; i < n_frames; i++) {
+                    TEST_ASSERT_EQUAL_UINT32(a.at(i).can_id, b.at(i).can_id);
+                    TEST_ASSERT_EQUAL_size_t(a.at(i).data_size, b.at(i).data_size);
+                    TEST_ASSERT_EQUAL_MEMORY(a.at(i).data, b.at(i).data, a.at(i).data_size);
+                }
+            }
+
+            canard_destroy(&ref);
+            canard_destroy(&dut);
+            mem_pool_verify_no_leaks(&ref_pool);
+            mem_pool_verify_no_leaks(&dut_pool);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Test 22: test_tx_zero_copy_release
+//   Without tx_gather(), zero-copy frames are copied, but the payload is still held until the transfer is retired.
+//   Expiration releases the payload as well.
+// =====================================================================================================================
+static void test_tx_zero_copy_release()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+    self.tx.fd = false;
+
+    static const std::array<uint_least8_t, 100> data{};
+    const canard_bytes_chain_t                  payload  = make_payload(data.data(), data.size()); // 15 frames.
+    size_t                                      released = 0;
+
+    // The last frame is generated before the penultimate one is ejected, yet the payload is held until the end.
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_zero_copy(&self, 10000, 1U, canard_prio_slow, 7U, 0U, payload, count_release, &released));
+    cap.quota = 14U;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(14U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(0U, released);
+    cap.quota = SIZE_MAX;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(15U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    TEST_ASSERT_EQUAL_UINT8(0x40U, cap.records.at(14).tail & 0xC0U);
+
+    // Expiration of a partially transmitted gather transfer.
+    self.vtable = &capture_gather_vtable;
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_zero_copy(&self, 10000, 1U, canard_prio_slow, 7U, 1U, payload, count_release, &released));
+    cap.quota = 2U;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(17U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.gathered);
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    cap.now = 10001;
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_size_t(2U, released);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// CRC-16/CCITT-FALSE as used by multi-frame Cyphal/CAN transfers.
+static uint16_t crc16_ccitt_add(const uint16_t seed, const uint_least8_t* const data, const size_t size)
+{
+    uint32_t crc = seed;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= static_cast<uint32_t>(data[i]) << 8U;
+        for (size_t k = 0; k < 8; k++) {
+            crc = (((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U)) & 0xFFFFU;
+        }
+    }
+    return static_cast<uint16_t>(crc);
+}
+
+static uint_least8_t stream_byte(const size_t offset)
+{
+    return static_cast<uint_least8_t>((offset * 7U) ^ (offset >> 8U));
+}
+
+// A synthetic payload source that is never materialized in memory.
+struct stream_source_t
+{
+    size_t   pulls;
+    size_t   pulled; // The offset of the next byte; the ranges are expected to be requested in order.
+    size_t   starve; // The number of requests to decline before supplying data again.
+    size_t   released;
+    uint16_t crc;
+};
+
+static bool stream_produce(canard_t* const self,
+                           void* const     user_context,
+                           const size_t    offset,
+                           const size_t    size,
+                           void* const     destination)
+{
+    TEST_ASSERT_NOT_NULL(self);
+    auto* const src = static_cast<stream_source_t*>(user_context);
+    TEST_ASSERT_TRUE((size > 0U) && (size <= 63U));
+    TEST_ASSERT_EQUAL_size_t(src->pulled, offset);
+    if (src->starve > 0U) {
+        src->starve--;
+        return false;
+    }
+    auto* const out = static_cast<uint_least8_t*>(destination);
+    for (size_t i = 0; i < size; i++) {
+        out[i] = stream_byte(offset + i);
+    }
+    src->crc = crc16_ccitt_add(src->crc, out, size);
+    src->pulls++;
+    src->pulled += size;
+    return true;
+}
+
+static void stream_release(canard_t* const self, void* const user_context)
+{
+    TEST_ASSERT_NOT_NULL(self);
+    static_cast<stream_source_t*>(user_context)->released++;
+}
+
+// =====================================================================================================================
+// Test 23: test_tx_stream_matches_eager
+//   A streamed transfer emits the same frames as an eager one on every interface. The payload is pulled one frame at
+//   a time as the frames are ejected; the producer is released once the last frame is generated.
+// =====================================================================================================================
+static void test_tx_stream_matches_eager()
+{
+    std::array<uint_least8_t, 300> data{};
+    for (size_t i = 0; i < data.size(); i++) {
+        data.at(i) = stream_byte(i);
+    }
+    const canard_bytes_chain_t payload = make_payload(data.data(), data.size());
+    for (const bool fd : { false, true }) {
+        canard_t     ref      = {};
+        canard_t     dut      = {};
+        tx_capture_t ref_cap  = {};
+        tx_capture_t dut_cap  = {};
+        mem_pool_t   ref_pool = {};
+        mem_pool_t   dut_pool = {};
+        init_node(&ref, &ref_cap, &ref_pool, 64U, 42U);
+        init_node(&dut, &dut_cap, &dut_pool, 64U, 42U);
+        ref.tx.fd = fd;
+        dut.tx.fd = fd;
+
+        stream_source_t src = { .pulls = 0U, .pulled = 0U, .starve = 0U, .released = 0U, .crc = 0xFFFFU };
+        TEST_ASSERT_TRUE(canard_publish_16b(&ref, 10000, 3U, canard_prio_low, 4321U, 5U, payload, nullptr));
+        TEST_ASSERT_TRUE(canard_publish_16b_stream(
+          &dut, 10000, 3U, canard_prio_low, 4321U, 5U, data.size(), stream_produce, stream_release, &src));
+        const size_t n_frames = fd ? 5U : 44U;
+        TEST_ASSERT_EQUAL_size_t(2U, dut.tx.queue_size);
+        TEST_ASSERT_EQUAL_size_t(1U, src.pulls); // Only the first frame so far.
+        TEST_ASSERT_EQUAL_size_t(2U, dut_pool.tx_frame.allocated_fragments);
+
+        canard_poll(&ref, 3U);
+        while (canard_pending_ifaces(&dut) != 0U) {
+            dut_cap.quota = 1U;
+            canard_poll(&dut, 1U);
+            dut_cap.quota = 1U;
+            canard_poll(&dut, 2U);
+        }
+        TEST_ASSERT_EQUAL_size_t(1U, src.released);
+        TEST_ASSERT_EQUAL_size_t(data.size(), src.pulled);
+        TEST_ASSERT_TRUE(src.pulls <= n_frames); // The last frame may contain only the CRC.
+        TEST_ASSERT_TRUE(dut_cap.peak_queue_size <= 3U);
+        for (const uint_least8_t iface_index : { uint_least8_t{ 0U }, uint_least8_t{ 1U } }) {
+            const std::vector<tx_record_t> a = records_of_iface(ref_cap, iface_index);
+            const std::vector<tx_record_t> b = records_of_iface(dut_cap, iface_index);
+            TEST_ASSERT_EQUAL_size_t(n_frames, a.size());
+            TEST_ASSERT_EQUAL_size_t(n_frames, b.size());
+            for (size_t i = 0; i < n_frames; i++) {
+                TEST_ASSERT_EQUAL_UINT32(a.at(i).can_id, b.at(i).can_id);
+                TEST_ASSERT_EQUAL_size_t(a.at(i).data_size, b.at(i).data_size);
+                TEST_ASSERT_EQUAL_MEMORY(a.at(i).data, b.at(i).data, a.at(i).data_size);
+            }
+        }
+        TEST_ASSERT_EQUAL_UINT64(0U, dut.err.oom);
+
+        canard_destroy(&ref);
+        canard_destroy(&dut);
+        mem_pool_verify_no_leaks(&ref_pool);
+        mem_pool_verify_no_leaks(&dut_pool);
+    }
+}
+
+// =====================================================================================================================
+// Test 24: test_tx_stream_large_and_starved
+//   A multi-MiB transfer is streamed in constant memory. A producer that has no data yet stalls the interface without
+//   counting an error; if it cannot supply the first frame, the publication fails. Small payloads are pulled at once.
+// =====================================================================================================================
+static void test_tx_stream_large_and_starved()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+    self.tx.fd = false;
+
+    // A single-frame payload is pulled and released right away.
+    stream_source_t small = { .pulls = 0U, .pulled = 0U, .starve = 0U, .released = 0U, .crc = 0xFFFFU };
+    TEST_ASSERT_TRUE(canard_publish_13b_stream(
+      &self, 10000, 1U, canard_prio_nominal, 100U, 0U, 5U, stream_produce, stream_release, &small));
+    TEST_ASSERT_EQUAL_size_t(1U, small.pulls);
+    TEST_ASSERT_EQUAL_size_t(1U, small.released);
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    const std::array<uint_least8_t, 5> small_data = { 0, 7, 14, 21, 28 };
+    TEST_ASSERT_EQUAL_MEMORY(small_data.data(), cap.records.at(0).data, small_data.size());
+
+    // A producer that cannot supply the first frame fails the publication without releasing or leaking anything.
+    const size_t    size = 1024U * 1024U;
+    stream_source_t src  = { .pulls = 0U, .pulled = 0U, .starve = 1U, .released = 0U, .crc = 0xFFFFU };
+    TEST_ASSERT_FALSE(canard_publish_16b_stream(
+      &self, 1000000000, 1U, canard_prio_optional, 200U, 1U, size, stream_produce, stream_release, &src));
+    TEST_ASSERT_EQUAL_size_t(0U, src.released);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_frame.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_transfer.allocated_fragments);
+    TEST_ASSERT_FALSE(canard_publish_16b_stream(
+      &self, 1000000000, 1U, canard_prio_optional, 200U, 1U, size, nullptr, stream_release, &src));
+
+    // A 1 MiB transfer; the producer stalls the interface midway.
+    const size_t n_frames = ((size + 2U) + 6U) / 7U;
+    cap.count             = 0U;
+    TEST_ASSERT_TRUE(canard_publish_16b_stream(
+      &self, 1000000000, 1U, canard_prio_optional, 200U, 1U, size, stream_produce, stream_release, &src));
+    cap.quota = 10U;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(10U, cap.count);
+    src.starve = 1U;
+    cap.quota  = SIZE_MAX;
+    canard_poll(&self, 1U); // The frame generated before the quota ran out is ejected, then the producer stalls.
+    TEST_ASSERT_EQUAL_size_t(11U, cap.count);
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.oom);
+    TEST_ASSERT_EQUAL_UINT8(1U, canard_pending_ifaces(&self));
+    TEST_ASSERT_EQUAL_size_t(0U, src.starve);
+    cap.quota = n_frames - 12U; // All but the last frame to capture the latter at the front.
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(n_frames - 1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, src.released); // The last frame is already generated.
+    TEST_ASSERT_EQUAL_size_t(size, src.pulled);
+    TEST_ASSERT_TRUE(cap.peak_queue_size <= 2U);
+    TEST_ASSERT_TRUE(pool.tx_frame.allocated_fragments <= 3U);
+    cap.count = 0U;
+    cap.quota = SIZE_MAX;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, src.released);
+    // The last frame carries 4 payload bytes, the CRC, and the tail byte with EOT set.
+    const tx_record_t& last = cap.records.at(0);
+    TEST_ASSERT_EQUAL_size_t(7U, last.data_size);
+    TEST_ASSERT_EQUAL_UINT8(stream_byte(size - 1U), last.data[3]);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint_least8_t>(src.crc >> 8U), last.data[4]);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint_least8_t>(src.crc & 0xFFU), last.data[5]);
+    TEST_ASSERT_EQUAL_UINT8(0x40U, last.tail & 0xC0U);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+
+    // Destruction releases a pending stream.
+    src = { .pulls = 0U, .pulled = 0U, .starve = 0U, .released = 0U, .crc = 0xFFFFU };
+    TEST_ASSERT_TRUE(canard_publish_16b_stream(
+      &self, 1000000000, 1U, canard_prio_optional, 200U, 2U, size, stream_produce, stream_release, &src));
+    canard_destroy(&self);
+    TEST_ASSERT_EQUAL_size_t(1U, src.released);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// Writes the payload into the spans of the reservation; returns the number of spans.
+static size_t reservation_fill(canard_tx_reservation_t* const res, const uint_least8_t* const data)
+{
+    size_t spans = 0;
+    do {
+        TEST_ASSERT_TRUE((res->offset + res->span.size) <= res->size);
+        if (res->span.size > 0U) {
+            std::memcpy(res->span.data, &data[res->offset], res->span.size);
+            spans++;
+        }
+    } while (canard_reservation_next(res));
+    TEST_ASSERT_EQUAL_size_t(res->size, res->offset);
+    return spans;
+}
+
+// =====================================================================================================================
+// Test 25: test_tx_reservation_matches_eager
+//   A payload serialized in place yields the same frames as a regular publication, including the padding and the CRC
+//   that straddles the frame boundary. There is one span per frame that carries payload.
+// =====================================================================================================================
+static void test_tx_reservation_matches_eager()
+{
+    std::array<uint_least8_t, 300> data{};
+    for (size_t i = 0; i < data.size(); i++) {
+        data.at(i) = static_cast<uint_least8_t>((i * 11U) + 1U);
+    }
+    for (const bool fd : { false, true }) {
+        // Empty, single-frame, CRC split between the last two frames, padded last frame.
+        for (const size_t size : { size_t{ 0U }, size_t{ 5U }, fd ? size_t{ 125U } : size_t{ 13U }, size_t{ 300U } }) {
+            canard_t     ref      = {};
+            canard_t     dut      = {};
+            tx_capture_t ref_cap  = {};
+            tx_capture_t dut_cap  = {};
+            mem_pool_t   ref_pool = {};
+            mem_pool_t   dut_pool = {};
+            init_node(&ref, &ref_cap, &ref_pool, 64U, 42U);
+            init_node(&dut, &dut_cap, &dut_pool, 64U, 42U);
+            ref.tx.fd = fd;
+            dut.tx.fd = fd;
+
+            const canard_bytes_chain_t payload = make_payload(data.data(), size);
+            TEST_ASSERT_TRUE(canard_publish_13b(&ref, 10000, 3U, canard_prio_high, 77U, 3U, payload, nullptr));
+            canard_tx_reservation_t res{};
+            TEST_ASSERT_TRUE(canard_reserve_13b(&dut, &res, 10000, 3U, canard_prio_high, 77U, 3U, size, nullptr));
+            TEST_ASSERT_EQUAL_size_t(ref.tx.queue_size, dut.tx.queue_size);
+            TEST_ASSERT_EQUAL_size_t(ref_pool.tx_frame.allocated_bytes, dut_pool.tx_frame.allocated_bytes);
+            canard_poll(&dut, 3U);
+            TEST_ASSERT_EQUAL_size_t(0U, dut_cap.count); // Not enqueued until committed.
+            const size_t spans = reservation_fill(&res, data.data());
+            canard_reservation_commit(&dut, &res);
+            TEST_ASSERT_NULL(res.transfer);
+
+            canard_poll(&ref, 3U);
+            canard_poll(&dut, 3U);
+            TEST_ASSERT_EQUAL_size_t(ref_cap.count, dut_cap.count);
+            const size_t n_frames = ref_cap.count / 2U;
+            TEST_ASSERT_TRUE((spans == n_frames) || ((spans + 1U) == n_frames) || ((size == 0U) && (spans == 0U)));
+            for (size_t i = 0; i < ref_cap.count; i++) {
+                const tx_record_t& a = ref_cap.records.at(i);
+                const tx_record_t& b = dut_cap.records.at(i);
+                TEST_ASSERT_EQUAL_UINT8(a.iface_index, b.iface_index);
+                TEST_ASSERT_EQUAL_UINT32(a.can_id, b.can_id);
+                TEST_ASSERT_EQUAL_size_t(a.data_size, b.data_size);
+                TEST_ASSERT_EQUAL_MEMORY(a.data, b.data, a.data_size);
+            }
+
+            canard_destroy(&ref);
+            canard_destroy(&dut);
+            mem_pool_verify_no_leaks(&ref_pool);
+            mem_pool_verify_no_leaks(&dut_pool);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Test 26: test_tx_reservation_lifecycle
+//   A pending reservation takes queue space but cannot be expired or sacrificed; it is ordered by the commit time.
+//   Cancellation and failed reservations hold nothing.
+// =====================================================================================================================
+static void test_tx_reservation_lifecycle()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 4U, 42U);
+    self.tx.fd = false;
+
+    static const std::array<uint_least8_t, 15> data{};
+    const canard_bytes_chain_t                 payload = make_payload(data.data(), data.size()); // 3 frames.
+
+    // Cancellation.
+    canard_tx_reservation_t res{};
+    TEST_ASSERT_TRUE(canard_reserve_16b(&self, &res, 1000, 1U, canard_prio_nominal, 10U, 0U, data.size(), nullptr));
+    TEST_ASSERT_EQUAL_size_t(3U, self.tx.queue_size);
+    canard_reservation_cancel(&self, &res);
+    TEST_ASSERT_NULL(res.transfer);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_frame.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_transfer.allocated_fragments);
+    canard_reservation_cancel(&self, &res); // No-op.
+    canard_reservation_commit(&self, &res); // No-op.
+    TEST_ASSERT_FALSE(canard_reservation_next(&res));
+
+    // Failures hold nothing.
+    pool.tx_frame.limit_fragments = 0U;
+    TEST_ASSERT_FALSE(canard_reserve_16b(&self, &res, 1000, 1U, canard_prio_nominal, 10U, 0U, data.size(), nullptr));
+    pool.tx_frame.limit_fragments = SIZE_MAX;
+    TEST_ASSERT_FALSE(canard_reserve_16b(&self, &res, 1000, 1U, canard_prio_nominal, 10U, 0U, 100U, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_capacity);
+    TEST_ASSERT_FALSE(canard_reserve_16b(&self, nullptr, 1000, 1U, canard_prio_nominal, 10U, 0U, 1U, nullptr));
+    TEST_ASSERT_FALSE(canard_reserve_13b(&self, &res, 1000, 1U, canard_prio_nominal, 8192U, 0U, 1U, nullptr));
+    TEST_ASSERT_NULL(res.transfer);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_frame.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0U, pool.tx_transfer.allocated_fragments);
+
+    // A pending reservation is neither expired nor sacrificed; the newcomer is rejected instead.
+    TEST_ASSERT_TRUE(canard_reserve_16b(&self, &res, 1000, 1U, canard_prio_nominal, 10U, 1U, data.size(), nullptr));
+    cap.now = 2000;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_expiration);
+    TEST_ASSERT_FALSE(canard_publish_16b(&self, 1000000, 1U, canard_prio_nominal, 10U, 0U, payload, nullptr));
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_capacity);
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.tx_sacrifice);
+    (void)reservation_fill(&res, data.data());
+    canard_reservation_commit(&self, &res);
+    canard_poll(&self, 0U);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_expiration); // Once committed, it is subject to expiration.
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, cap.count);
+
+    // A single-frame transfer of the same CAN ID published in the meantime goes first.
+    TEST_ASSERT_TRUE(canard_reserve_16b(&self, &res, 1000000, 1U, canard_prio_nominal, 10U, 2U, 1U, nullptr));
+    TEST_ASSERT_TRUE(
+      canard_publish_16b(&self, 1000000, 1U, canard_prio_nominal, 10U, 3U, make_payload(data.data(), 1U), nullptr));
+    TEST_ASSERT_EQUAL_size_t(1U, reservation_fill(&res, data.data()));
+    canard_reservation_commit(&self, &res);
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.count);
+    TEST_ASSERT_EQUAL_UINT8(0xE3U, cap.records.at(0).tail); // SOT, EOT, toggle, transfer-ID 3.
+    TEST_ASSERT_EQUAL_UINT8(0xE2U, cap.records.at(1).tail);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 27: test_tx_batch_matches_single
+//   Frames submitted via tx_batch() span several transfers in the transmission order and match those submitted one by
+//   one via tx(), also if the driver accepts only a part of each batch. Lazy transfers are generated ahead to fill the
+//   batch; zero-copy frames are submitted via tx_gather() if available, interleaved in the same order.
+// =====================================================================================================================
+static void test_tx_batch_matches_single()
+{
+    static const std::array<uint_least8_t, 60> data = [] {
+        std::array<uint_least8_t, 60> out{};
+        for (size_t i = 0; i < out.size(); i++) {
+            out.at(i) = static_cast<uint_least8_t>((i * 5U) + 2U);
+        }
+        return out;
+    }();
+    const canard_bytes_chain_t payload = make_payload(data.data(), data.size());
+    for (const canard_vtable_t* const vtable : { &capture_batch_vtable, &capture_batch_gather_vtable }) {
+        for (const size_t quota : { SIZE_MAX, size_t{ 5U } }) {
+            canard_t     ref      = {};
+            canard_t     dut      = {};
+            tx_capture_t ref_cap  = {};
+            tx_capture_t dut_cap  = {};
+            mem_pool_t   ref_pool = {};
+            mem_pool_t   dut_pool = {};
+            init_node(&ref, &ref_cap, &ref_pool, 64U, 42U);
+            init_node(&dut, &dut_cap, &dut_pool, 64U, 42U);
+            ref.tx.fd               = false;
+            dut.tx.fd               = false;
+            dut.vtable              = vtable;
+            dut_cap.app_buffer      = data.data();
+            dut_cap.app_buffer_size = data.size();
+            size_t released         = 0;
+            for (canard_t* const self : { &ref, &dut }) {
+                const canard_bytes_chain_t small  = make_payload(data.data(), 5U);
+                const canard_bytes_chain_t medium = make_payload(data.data(), 20U);
+                const canard_bytes_chain_t large  = make_payload(data.data(), 50U);
+                const canard_bytes_chain_t zc     = make_payload(&data[10], 30U);
+                TEST_ASSERT_TRUE(canard_publish_16b(self, 10000, 3U, canard_prio_slow, 2U, 0U, small, nullptr));
+                TEST_ASSERT_TRUE(canard_publish_16b(self, 10000, 3U, canard_prio_fast, 1U, 1U, payload, nullptr));
+                TEST_ASSERT_TRUE(canard_publish_16b(self, 10000, 3U, canard_prio_fast, 0U, 2U, medium, nullptr));
+                TEST_ASSERT_TRUE(
+                  canard_publish_16b_lazy(self, 10000, 3U, canard_prio_fast, 1U, 3U, large, count_release, &released));
+                TEST_ASSERT_TRUE(canard_publish_16b_zero_copy(
+                  self, 10000, 3U, canard_prio_nominal, 3U, 4U, zc, count_release, &released));
+            }
+            canard_poll(&ref, 3U);
+            while (canard_pending_ifaces(&dut) != 0U) {
+                dut_cap.quota = quota;
+                canard_poll(&dut, 1U);
+                dut_cap.quota = quota;
+                canard_poll(&dut, 2U);
+            }
+            TEST_ASSERT_EQUAL_size_t(4U, released);
+            TEST_ASSERT_EQUAL_size_t(ref_cap.count, dut_cap.count);
+            TEST_ASSERT_EQUAL_size_t(CANARD_TX_BATCH_SIZE, dut_cap.max_batch);
+            TEST_ASSERT_TRUE((CANARD_TX_BATCH_SIZE == 1U) || (dut_cap.batches < dut_cap.count));
+            TEST_ASSERT_EQUAL_size_t((vtable == &capture_batch_gather_vtable) ? 10U : 0U, dut_cap.gathered);
+            for (const uint_least8_t iface_index : { uint_least8_t{ 0U }, uint_least8_t{ 1U } }) {
+                const std::vector<tx_record_t> a = records_of_iface(ref_cap, iface_index);
+                const std::vector<tx_record_t> b = records_of_iface(dut_cap, iface_index);
+                TEST_ASSERT_EQUAL_size_t(27U, a.size());
+                TEST_ASSERT_EQUAL_size_t(a.size(), b.size());
+                for (size_t i = 0; i < a.size(); i++) {
+                    TEST_ASSERT_EQUAL_UINT32(a.at(i).can_id, b.at(i).can_id);
+                    TEST_ASSERT_EQUAL_INT64(a.at(i).deadline, b.at(i).deadline);
+                    TEST_ASSERT_EQUAL_size_t(a.at(i).data_size, b.at(i).data_size);
+                    TEST_ASSERT_EQUAL_MEMORY(a.at(i).data, b.at(i).data, a.at(i).data_size);
+                }
+            }
+
+            canard_destroy(&ref);
+            canard_destroy(&dut);
+            mem_pool_verify_no_leaks(&ref_pool);
+            mem_pool_verify_no_leaks(&dut_pool);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Test 28: test_tx_batch_backpressure
+//   Nothing advances if the driver accepts no frames. A lazy transfer fills the batch only as far as the queue space
+//   permits, and the batch is cut short where the next frame cannot be generated.
+// =====================================================================================================================
+static void test_tx_batch_backpressure()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 4U, 42U);
+    self.tx.fd      = false;
+    self.vtable     = &capture_batch_vtable;
+    size_t released = 0;
+
+    static const std::array<uint_least8_t, 100> data{};
+    const canard_bytes_chain_t                  payload = make_payload(data.data(), data.size()); // 15 frames.
+    TEST_ASSERT_TRUE(
+      canard_publish_16b_lazy(&self, 10000, 1U, canard_prio_nominal, 5U, 7U, payload, count_release, &released));
+    cap.quota = 0U;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.batches);
+    TEST_ASSERT_EQUAL_size_t(0U, cap.count);
+    TEST_ASSERT_EQUAL_UINT8(1U, canard_pending_ifaces(&self));
+    // The frames generated ahead are retained: one past the batch, which is limited by the queue capacity.
+    const size_t max_batch = std::min<size_t>(CANARD_TX_BATCH_SIZE, 3U);
+    TEST_ASSERT_EQUAL_size_t(max_batch + 1U, self.tx.queue_size);
+
+    cap.quota = SIZE_MAX;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(15U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(max_batch, cap.max_batch);
+    TEST_ASSERT_TRUE(cap.peak_queue_size <= 4U);
+    TEST_ASSERT_EQUAL_size_t(1U, released);
+    TEST_ASSERT_EQUAL_UINT8(0xA7U, cap.records.at(0).tail);  // SOT, toggle, transfer-ID 7.
+    TEST_ASSERT_EQUAL_UINT8(0x67U, cap.records.at(14).tail); // EOT, toggle, transfer-ID 7.
+    for (size_t i = 1; i < 15U; i++) {
+        TEST_ASSERT_EQUAL_UINT8((i % 2U) == 0U ? 0x20U : 0x00U, cap.records.at(i).tail & 0x20U);
+    }
+    TEST_ASSERT_EQUAL_UINT64(0U, self.err.oom);
+
+    canard_destroy(&self);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// Checks one tx_done() notification; the timestamps are expected only if they are recorded.
+static void check_done(const tx_done_t&          rec,
+                       void* const               user_context,
+                       const canard_tx_outcome_t outcome,
+                       const uint_least8_t       iface_bitmap,
+                       const canard_us_t         enqueue_ts,
+                       const canard_us_t         first_frame_ts,
+                       const canard_us_t         last_frame_ts)
+{
+    TEST_ASSERT_EQUAL_PTR(user_context, rec.user_context);
+    TEST_ASSERT_EQUAL_INT(outcome, rec.outcome);
+    TEST_ASSERT_EQUAL_UINT8(iface_bitmap, rec.iface_bitmap);
+    TEST_ASSERT_EQUAL_INT64(CANARD_TX_TIMESTAMPS ? enqueue_ts : -1, (rec.enqueue_ts < 0) ? -1 : rec.enqueue_ts);
+    TEST_ASSERT_EQUAL_INT64(CANARD_TX_TIMESTAMPS ? first_frame_ts : -1,
+                            (rec.first_frame_ts < 0) ? -1 : rec.first_frame_ts);
+    TEST_ASSERT_EQUAL_INT64(CANARD_TX_TIMESTAMPS ? last_frame_ts : -1,
+                            (rec.last_frame_ts < 0) ? -1 : rec.last_frame_ts);
+}
+
+// =====================================================================================================================
+// Test 29: test_tx_done_completed
+//   A transfer is reported once when the last of its interfaces completes the transmission, with the times of the
+//   enqueueing, of the first frame, and of the last frame, whether the frames are submitted one by one or in batches.
+// =====================================================================================================================
+static void test_tx_done_completed()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+    self.tx.fd  = false;
+    self.vtable = &capture_done_vtable;
+    int tag_a   = 0;
+    int tag_b   = 0;
+
+    static const std::array<uint_least8_t, 20> data{};
+    const canard_bytes_chain_t                 payload = make_payload(data.data(), data.size()); // 4 frames.
+    cap.now                                            = 1000;
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 3U, canard_prio_nominal, 5U, 0U, payload, &tag_a));
+    cap.now   = 2000;
+    cap.quota = 1U;
+    canard_poll(&self, 3U);
+    cap.now   = 3000;
+    cap.quota = SIZE_MAX;
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(0U, cap.done_count); // Still pending on the second interface.
+    cap.now = 4000;
+    canard_poll(&self, 2U);
+    TEST_ASSERT_EQUAL_size_t(8U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(1U, cap.done_count);
+    check_done(cap.done.at(0), &tag_a, canard_tx_outcome_completed, 3U, 1000, 2000, 4000);
+
+    // The same via tx_batch(), on one interface only.
+    static const canard_vtable_t batch_vtable = {
+        .now       = capture_now,
+        .tx        = capture_tx,
+        .filter    = nullptr,
+        .tx_gather = nullptr,
+        .tx_batch  = capture_tx_batch,
+        .tx_done   = capture_tx_done,
+    };
+    self.vtable = &batch_vtable;
+    cap.now     = 5000;
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 2U, canard_prio_nominal, 5U, 1U, payload, &tag_b));
+    cap.now = 6000;
+    canard_poll(&self, 3U);
+    TEST_ASSERT_EQUAL_size_t(12U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.done_count);
+    check_done(cap.done.at(1), &tag_b, canard_tx_outcome_completed, 2U, 5000, 6000, 6000);
+
+    canard_destroy(&self);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.done_count);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 30: test_tx_done_dropped
+//   Transfers that leave the queue without completing are reported with the reason and the interfaces that have
+//   completed the transmission, if any: expired, superseded by a newer value, sacrificed, canceled on destruction.
+//   Transfers that could not be enqueued are not reported.
+// =====================================================================================================================
+static void test_tx_done_dropped()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 8U, 42U);
+    self.tx.fd  = false;
+    self.vtable = &capture_done_vtable;
+    std::array<int, 8> tags{};
+
+    static const std::array<uint_least8_t, 40> data{};
+    const canard_bytes_chain_t                 multi  = make_payload(data.data(), 20U); // 4 frames.
+    const canard_bytes_chain_t                 large  = make_payload(data.data(), 40U); // 6 frames.
+    const canard_bytes_chain_t                 single = make_empty_payload();
+
+    // Expired before transmission.
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 500, 1U, canard_prio_nominal, 1U, 0U, single, &tags[0]));
+    cap.now = 1000;
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 2U, 0U, single, &tags[1]));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.done_count);
+    check_done(cap.done.at(0), &tags[0], canard_tx_outcome_expired, 0U, 0, -1, -1);
+    canard_poll(&self, 1U);
+    TEST_ASSERT_EQUAL_size_t(2U, cap.done_count);
+    check_done(cap.done.at(1), &tags[1], canard_tx_outcome_completed, 1U, 1000, 1000, 1000);
+
+    // Expired after completing the transmission on one of the interfaces.
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 2000, 3U, canard_prio_nominal, 3U, 0U, multi, &tags[2]));
+    cap.now = 1500;
+    canard_poll(&self, 1U);
+    cap.now = 3000;
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 4U, 0U, single, &tags[3]));
+    TEST_ASSERT_EQUAL_size_t(3U, cap.done_count);
+    check_done(cap.done.at(2), &tags[2], canard_tx_outcome_expired, 1U, 1000, 1500, 1500);
+
+    // Superseded by a newer value; the replacement takes over the transfer object.
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 5U, 0U, single, &tags[4]));
+    TEST_ASSERT_TRUE(canard_publish_16b_latest(&self, 10000, 1U, canard_prio_nominal, 5U, 1U, single, &tags[5]));
+    TEST_ASSERT_EQUAL_size_t(4U, cap.done_count);
+    check_done(cap.done.at(3), &tags[4], canard_tx_outcome_superseded, 0U, 3000, -1, -1);
+
+    // Sacrificed to make room; the oldest one goes first. A transfer that cannot be enqueued is not reported.
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 6U, 0U, large, &tags[6]));
+    TEST_ASSERT_EQUAL_size_t(8U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(4U, cap.done_count);
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 7U, 0U, single, &tags[7]));
+    TEST_ASSERT_EQUAL_size_t(5U, cap.done_count);
+    check_done(cap.done.at(4), &tags[3], canard_tx_outcome_sacrificed, 0U, 3000, -1, -1);
+    const canard_bytes_chain_t oversized = make_payload(data.data(), 60U); // 9 frames, more than the capacity.
+    TEST_ASSERT_FALSE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 8U, 0U, oversized, nullptr));
+    TEST_ASSERT_EQUAL_size_t(5U, cap.done_count);
+    TEST_ASSERT_EQUAL_UINT64(2U, self.err.tx_expiration);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.err.tx_sacrifice);
+    TEST_ASSERT_EQUAL_UINT64(1U, self.tx.coalesced);
+
+    // The rest are canceled on destruction in the order of enqueueing.
+    canard_destroy(&self);
+    TEST_ASSERT_EQUAL_size_t(8U, cap.done_count);
+    check_done(cap.done.at(5), &tags[5], canard_tx_outcome_canceled, 0U, 3000, -1, -1);
+    check_done(cap.done.at(6), &tags[6], canard_tx_outcome_canceled, 0U, 3000, -1, -1);
+    check_done(cap.done.at(7), &tags[7], canard_tx_outcome_canceled, 0U, 3000, -1, -1);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+// =====================================================================================================================
+// Test 31: test_tx_done_node_id_change
+//   Changing the node-ID cancels the started multi-frame transfers, which are reported as such; the others are kept
+//   and reported when they complete.
+// =====================================================================================================================
+static void test_tx_done_node_id_change()
+{
+    canard_t     self = {};
+    tx_capture_t cap  = {};
+    mem_pool_t   pool = {};
+    init_node(&self, &cap, &pool, 16U, 42U);
+    self.tx.fd  = false;
+    self.vtable = &capture_done_vtable;
+    std::array<int, 3> tags{};
+
+    static const std::array<uint_least8_t, 20> data{};
+    const canard_bytes_chain_t                 multi  = make_payload(data.data(), data.size()); // 4 frames.
+    const canard_bytes_chain_t                 single = make_empty_payload();
+    cap.now                                           = 1000;
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 3U, canard_prio_high, 1U, 0U, multi, &tags[0]));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 2U, 0U, multi, &tags[1]));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 10000, 1U, canard_prio_nominal, 3U, 0U, single, &tags[2]));
+    cap.now   = 2000;
+    cap.quota = 1U;
+    canard_poll(&self, 3U); // The first frame of the first transfer departs via the first interface.
+    TEST_ASSERT_EQUAL_size_t(1U, cap.count);
+
+    cap.now = 3000;
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 43U));
+    TEST_ASSERT_EQUAL_size_t(1U, cap.done_count);
+    check_done(cap.done.at(0), &tags[0], canard_tx_outcome_canceled, 0U, 1000, 2000, -1);
+    TEST_ASSERT_EQUAL_size_t(5U, self.tx.queue_size);
+    TEST_ASSERT_TRUE(canard_set_node_id(&self, 43U)); // Nothing is started, nothing is canceled.
+    TEST_ASSERT_EQUAL_size_t(1U, cap.done_count);
+
+    cap.quota = SIZE_MAX;
+    canard_poll(&self, 3U);
+    TEST_ASSERT_EQUAL_size_t(6U, cap.count);
+    TEST_ASSERT_EQUAL_size_t(3U, cap.done_count);
+    check_done(cap.done.at(1), &tags[1], canard_tx_outcome_completed, 1U, 1000, 3000, 3000);
+    check_done(cap.done.at(2), &tags[2], canard_tx_outcome_completed, 1U, 1000, 3000, 3000);
+
+    canard_destroy(&self);
+    TEST_ASSERT_EQUAL_size_t(3U, cap.done_count);
+    mem_pool_verify_no_leaks(&pool);
+}
+
+static void record_release(canard_t* const self, void* const)
+{
+    tx_capture_t* const cap = capture_from(self);
+    cap->released_at.push_back(cap->done_count);
+}
+
+// =====================================================================================================================
+// Test 32: test_tx_done_release_order
+//   The payload of a lazy, zero-copy, or streamed transfer is released before the transfer is reported, whether it
+//   completes, is canceled on node-ID change, or is canceled on destruction.
+// =====================================================================================================================
+static void test_tx_done_release_order()
+{
+    static const std::array<uint_least8_t, 20> data{};
+    const canard_bytes_chain_t                 payload = make_payload(data.data(), data.size()); // 4 frames.
+    for (size_t variant = 0; variant < 3U; variant++) {
+        canard_t     self = {};
+        tx_capture_t cap  = {};
+        mem_pool_t   pool = {};
+        init_node(&self, &cap, &pool, 16U, 42U);
+        self.tx.fd  = false;
+        self.vtable = &capture_done_vtable;
+        std::array<stream_source_t, 3> src{};
+
+        const auto publish = [&](const uint_least8_t transfer_id) {
+            void* const user_context = &src.at(transfer_id);
+            switch (variant) {
+                case 0:
+                    return canard_publish_16b_lazy(
+                      &self, 10000, 1U, canard_prio_nominal, 7U, transfer_id, payload, record_release, user_context);
+                case 1:
+                    return canard_publish_16b_zero_copy(
+                      &self, 10000, 1U, canard_prio_nominal, 7U, transfer_id, payload, record_release, user_context);
+                default:
+                    return canard_publish_16b_stream(&self,
+                                                     10000,
+                                                     1U,
+                                                     canard_prio_nominal,
+                                                     7U,
+                                                     transfer_id,
+                                                     data.size(),
+                                                     stream_produce,
+                                                     record_release,
+                                                     user_context);
+            }
+        };
+
+        // Completed.
+        TEST_ASSERT_TRUE(publish(0U));
+        canard_poll(&self, 1U);
+        TEST_ASSERT_EQUAL_size_t(4U, cap.count);
+        TEST_ASSERT_EQUAL_size_t(1U, cap.done_count);
+        TEST_ASSERT_EQUAL_INT(canard_tx_outcome_completed, cap.done.at(0).outcome);
+        TEST_ASSERT_TRUE(cap.released_at == std::vector<size_t>({ 0U }));
+
+        // Canceled on node-ID change after the first frame.
+        TEST_ASSERT_TRUE(publish(1U));
+        cap.quota = 1U;
+        canard_poll(&self, 1U);
+        TEST_ASSERT_EQUAL_size_t(5U, cap.count);
+        TEST_ASSERT_EQUAL_size_t(1U, cap.released_at.size());
+        TEST_ASSERT_TRUE(canard_set_node_id(&self, 43U));
+        TEST_ASSERT_EQUAL_size_t(2U, cap.done_count);
+        check_done(cap.done.at(1), &src.at(1), canard_tx_outcome_canceled, 0U, 0, 0, -1);
+        TEST_ASSERT_TRUE(cap.released_at == std::vector<size_t>({ 0U, 1U }));
+
+        // Canceled on destruction before the first frame.
+        cap.quota = SIZE_MAX;
+        TEST_ASSERT_TRUE(publish(2U));
+        canard_destroy(&self);
+        TEST_ASSERT_EQUAL_size_t(3U, cap.done_count);
+        check_done(cap.done.at(2), &src.at(2), canard_tx_outcome_canceled, 0U, 0, -1, -1);
+        TEST_ASSERT_TRUE(cap.released_at == std::vector<size_t>({ 0U, 1U, 2U }));
+        mem_pool_verify_no_leaks(&pool);
+    }
+}
+
 // =====================================================================================================================
 // Test runner
 // =====================================================================================================================
@@ -675,13 +2319,21 @@ int main()
     UNITY_BEGIN();
 
     RUN_TEST(test_tx_queue_sacrifice_oldest);
+    RUN_TEST(test_tx_queue_sacrifice_lowest_priority);
+    RUN_TEST(test_tx_queue_sacrifice_oldest_lowest_priority);
+    RUN_TEST(test_tx_queue_sacrifice_latest_deadline);
+    RUN_TEST(test_tx_queue_priority_reserve);
+    RUN_TEST(test_tx_queue_priority_reserve_latest_deadline);
+    RUN_TEST(test_tx_queue_priority_limit);
     RUN_TEST(test_tx_queue_sacrifice_multiframe_reclaims_all);
     RUN_TEST(test_tx_queue_sacrifice_multiple_rounds);
+    RUN_TEST(test_tx_queue_sacrifice_multiframe_intact);
     RUN_TEST(test_tx_queue_capacity_exceeded);
     RUN_TEST(test_tx_queue_capacity_boundary);
     RUN_TEST(test_tx_queue_deadline_expiration);
     RUN_TEST(test_tx_queue_ordering_priority);
     RUN_TEST(test_tx_queue_ordering_fifo_same_priority);
+    RUN_TEST(test_tx_queue_arbitration_order);
     RUN_TEST(test_tx_iface_bitmap_single);
     RUN_TEST(test_tx_iface_bitmap_both);
     RUN_TEST(test_tx_refcount_lifecycle);
@@ -690,6 +2342,22 @@ int main()
     RUN_TEST(test_tx_oom_transfer_allocation);
     RUN_TEST(test_tx_v0_always_classic_can);
     RUN_TEST(test_tx_backpressure_resumes);
+    RUN_TEST(test_tx_latest_value_wins);
+    RUN_TEST(test_tx_latest_value_wins_skips_started);
+    RUN_TEST(test_tx_lazy_matches_eager);
+    RUN_TEST(test_tx_lazy_release_and_stall);
+    RUN_TEST(test_tx_zero_copy_matches_eager);
+    RUN_TEST(test_tx_zero_copy_release);
+    RUN_TEST(test_tx_stream_matches_eager);
+    RUN_TEST(test_tx_stream_large_and_starved);
+    RUN_TEST(test_tx_reservation_matches_eager);
+    RUN_TEST(test_tx_reservation_lifecycle);
+    RUN_TEST(test_tx_batch_matches_single);
+    RUN_TEST(test_tx_batch_backpressure);
+    RUN_TEST(test_tx_done_completed);
+    RUN_TEST(test_tx_done_dropped);
+    RUN_TEST(test_tx_done_node_id_change);
+    RUN_TEST(test_tx_done_release_order);
 
     return UNITY_END();
 }
@@ -128,6 +128,9 @@ static void init_tx_canard(canard_t*                 self,
     self->mem.tx_frame      = instrumented_allocator_make_resource(alloc_frame);
     self->prng_state        = prng_seed;
     self->node_id           = node_id;
+    FOREACH_PRIO (i) {
+        self->tx.queue_limit[i] = self->tx.queue_capacity;
+    }
     node_id_occupancy_reset(self);
 }
 
@@ -155,7 +158,7 @@ static void free_all_transfers(canard_t* const self)
     tx_transfer_t* tr = LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
     while (tr != NULL) {
         tx_transfer_t* const next = LIST_NEXT(tr, tx_transfer_t, list_agewise);
-        tx_retire(self, tr);
+        tx_retire(self, tr, canard_tx_outcome_canceled);
         tr = next;
     }
 }
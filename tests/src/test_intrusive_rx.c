@@ -8,6 +8,17 @@
 void setUp(void) {}
 void tearDown(void) {}
 
+// Parses the frame without the route cache, like the library does on a cache miss.
+static byte_t rx_parse(const uint32_t       can_id,
+                       const canard_bytes_t payload_raw,
+                       frame_t* const       out_v0,
+                       frame_t* const       out_v1)
+{
+    canard_rx_route_t route;
+    rx_parse_can_id(can_id, &route);
+    return rx_parse_frame(can_id, payload_raw, &route, CANARD_PROTOCOL_ALL, out_v0, out_v1);
+}
+
 // All CAN IDs and expected values in this file are computed by hand from the protocol bit-field specifications.
 // The test never reuses expressions from the implementation (like PRIO_SHIFT, CANARD_SERVICE_ID_MAX as masks)
 // to derive expected results; everything is a hardcoded literal.
@@ -1032,6 +1043,32 @@ static void test_rx_parse_v0_anon_multiframe_reject(void)
     }
 }
 
+// =====================================================================================================================
+// Test 33: Protocol mask — the disabled version is not parsed even if the frame is ambiguous.
+static void test_rx_parse_protocol_mask(void)
+{
+    frame_t v0;
+    frame_t v1;
+    // Same ambiguous non-first frame as in test 16: v1.1 message / v0 service request.
+    const byte_t         d[] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x05 };
+    const canard_bytes_t pl  = { sizeof(d), d };
+    canard_rx_route_t    route;
+    rx_parse_can_id(0x0C04D2AAUL, &route);
+    TEST_ASSERT_EQUAL_UINT8(2, rx_parse_frame(0x0C04D2AAUL, pl, &route, CANARD_PROTOCOL_V1, &v0, &v1));
+    TEST_ASSERT_EQUAL_INT(canard_kind_message_16b, v1.kind);
+    TEST_ASSERT_EQUAL_UINT32(1234, v1.port_id);
+    TEST_ASSERT_EQUAL_size_t(0, v0.payload.size); // Zeroed, not parsed.
+    TEST_ASSERT_EQUAL_UINT8(1, rx_parse_frame(0x0C04D2AAUL, pl, &route, CANARD_PROTOCOL_V0, &v0, &v1));
+    TEST_ASSERT_EQUAL_INT(canard_kind_v0_request, v0.kind);
+    TEST_ASSERT_EQUAL_UINT32(4, v0.port_id);
+    TEST_ASSERT_EQUAL_size_t(0, v1.payload.size);
+    // A v0 start frame is not mistaken for v1 when v0 is disabled.
+    const byte_t         s[]  = { 0x11, 0xC5 }; // SOT=1 EOT=1 toggle=0
+    const canard_bytes_t pl_s = { sizeof(s), s };
+    TEST_ASSERT_EQUAL_UINT8(1, rx_parse_frame(0x0C04D2AAUL, pl_s, &route, 3U, &v0, &v1));
+    TEST_ASSERT_EQUAL_UINT8(0, rx_parse_frame(0x0C04D2AAUL, pl_s, &route, CANARD_PROTOCOL_V1, &v0, &v1));
+}
+
 // =====================================================================================================================
 
 int main(void)
@@ -1070,5 +1107,6 @@ int main(void)
     RUN_TEST(test_rx_parse_v1_0_anon_multiframe_reject);
     RUN_TEST(test_rx_parse_v0_svc_node_id_reject_dual);
     RUN_TEST(test_rx_parse_v0_anon_multiframe_reject);
+    RUN_TEST(test_rx_parse_protocol_mask);
     return UNITY_END();
 }
@@ -32,6 +32,9 @@ typedef struct
     instrumented_allocator_t alloc;
 } fixture_t;
 
+// The callbacks are never invoked because the tests do not complete transfers.
+static const canard_subscription_vtable_t fixture_vtable = { .on_message = NULL, .on_message_chain = NULL };
+
 static void fixture_init(fixture_t* const f, const canard_us_t tid_timeout)
 {
     memset(f, 0, sizeof(*f));
@@ -42,6 +45,7 @@ static void fixture_init(fixture_t* const f, const canard_us_t tid_timeout)
     f->sub.extent              = 64;
     f->sub.kind                = canard_kind_message_16b;
     f->sub.crc_seed            = CRC_INITIAL;
+    f->sub.vtable              = &fixture_vtable;
     f->ses.owner               = &f->sub;
     f->ses.last_admission_ts   = BIG_BANG;
     // All slots are NULL from memset; last_admitted_transfer_id=0, last_admitted_priority=0, iface_index=0.
@@ -108,7 +108,7 @@ static void fixture_init_v1(session_fixture_t* const fx,
 static bool feed(session_fixture_t* const fx, const canard_us_t ts, const frame_t* const fr, const byte_t iface_index)
 {
     const uint64_t c_oom = fx->canard.err.oom;
-    rx_session_update(&fx->sub, ts, fr, iface_index);
+    rx_session_update(&fx->sub, ts, fr, iface_index, NULL);
     return fx->canard.err.oom == c_oom; // OOM is the only expected error mode.
 }
 
@@ -189,12 +189,11 @@ static frame_t make_cont_frame(const canard_prio_t priority,
     return fr;
 }
 
-/// Destroy all sessions in the subscription tree. Must be called before checking alloc balance.
+/// Destroy all sessions in the subscription. Must be called before checking alloc balance.
 static void fixture_destroy_all_sessions(session_fixture_t* const fx)
 {
     while (fx->sub.sessions != NULL) {
-        rx_session_t* ses = CAVL2_TO_OWNER(fx->sub.sessions, rx_session_t, index);
-        rx_session_destroy(ses);
+        rx_session_destroy((rx_session_t*)fx->sub.sessions[0]);
     }
 }
 
@@ -263,18 +262,44 @@ static void test_slot_advance_and_truncation(void)
 
     const byte_t data0[7] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
     const byte_t data1[7] = { 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E };
-    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data0 });
+    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data0 }, 0);
     TEST_ASSERT_EQUAL_UINT32(7, slot->total_size);
     // Toggle flipped: 1 -> 0.
     TEST_ASSERT_EQUAL_UINT8(0, slot->expected_toggle);
 
-    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data1 });
+    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data1 }, 0);
     TEST_ASSERT_EQUAL_UINT32(14, slot->total_size);    // Total tracks original size.
     TEST_ASSERT_EQUAL_UINT8(1, slot->expected_toggle); // Toggle flipped: 0 -> 1.
 
     // Verify stored payload: first 7 bytes, then only 3 more (extent=10).
     const byte_t expected[10] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A };
     TEST_ASSERT_EQUAL_INT(0, memcmp(slot->payload, expected, 10));
+    // The CRC covers the truncated tail as well.
+    const byte_t all[14] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E };
+    TEST_ASSERT_EQUAL_HEX16(crc_add(CRC_INITIAL, sizeof(all), all), slot->crc);
+
+    rx_slot_destroy(&fx.sub, slot);
+    fixture_check_alloc_balance(&fx);
+}
+
+/// v0 first frame: the leading transfer CRC is stored but excluded from the CRC computation.
+static void test_slot_advance_crc_skip(void)
+{
+    session_fixture_t fx;
+    fixture_init(&fx, canard_kind_v0_message, 1001, 4, 2 * MEGA, 0x1234U);
+    rx_slot_t* const slot = rx_slot_new(&fx.sub, 1 * MEGA, 0, 0);
+    TEST_ASSERT_NOT_NULL(slot);
+    TEST_ASSERT_EQUAL_size_t(4 + CRC_BYTES, slot->extent);
+
+    const byte_t data0[7] = { 0xAA, 0xBB, 0x01, 0x02, 0x03, 0x04, 0x05 };
+    const byte_t data1[3] = { 0x06, 0x07, 0x08 };
+    rx_slot_advance(slot, (canard_bytes_t){ .size = sizeof(data0), .data = data0 }, CRC_BYTES);
+    rx_slot_advance(slot, (canard_bytes_t){ .size = sizeof(data1), .data = data1 }, 0);
+    TEST_ASSERT_EQUAL_UINT32(10, slot->total_size);
+    const byte_t expected[6] = { 0xAA, 0xBB, 0x01, 0x02, 0x03, 0x04 };
+    TEST_ASSERT_EQUAL_INT(0, memcmp(slot->payload, expected, sizeof(expected)));
+    const byte_t crc_input[8] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    TEST_ASSERT_EQUAL_HEX16(crc_add(0x1234U, sizeof(crc_input), crc_input), slot->crc);
 
     rx_slot_destroy(&fx.sub, slot);
     fixture_check_alloc_balance(&fx);
@@ -291,9 +316,9 @@ static void test_slot_advance_zero_extent(void)
     TEST_ASSERT_NOT_NULL(slot);
 
     const byte_t data[7] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
-    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data });
+    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data }, 0);
     TEST_ASSERT_EQUAL_UINT32(7, slot->total_size);
-    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data });
+    rx_slot_advance(slot, (canard_bytes_t){ .size = 7, .data = data }, 0);
     TEST_ASSERT_EQUAL_UINT32(14, slot->total_size);
 
     rx_slot_destroy(&fx.sub, slot);
@@ -1090,8 +1115,8 @@ static void test_session_creation_on_start(void)
     // The session alloc should have 1 fragment outstanding.
     TEST_ASSERT_EQUAL_size_t(1, fx.alloc_session.allocated_fragments);
 
-    // No payload allocations for single-frame transfers.
-    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_payload.allocated_fragments);
+    // No payload allocations for single-frame transfers; only the session index array of the subscription.
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1421,8 +1446,8 @@ static void test_preemption_same_priority_replaces(void)
     frame_t fr1 = make_start_frame(
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts + 1, &fr1, 0));
-    // Only 1 payload allocation should be outstanding (old was destroyed, new created).
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    // Only 1 slot should be outstanding (old was destroyed, new created), plus the session index array.
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     // Complete the new transfer.
     const uint16_t crc = crc_add(CRC_INITIAL, 7, data);
@@ -1463,8 +1488,8 @@ static void test_all_8_priorities(void)
         TEST_ASSERT_TRUE(feed(&fx, ts, &fr, 0));
         ts += 1;
     }
-    // Should have 8 payload allocations (one slot per priority).
-    TEST_ASSERT_EQUAL_size_t(8, fx.alloc_payload.allocated_fragments);
+    // Should have 8 slots (one per priority) plus the session index array.
+    TEST_ASSERT_EQUAL_size_t(9, fx.alloc_payload.allocated_fragments);
 
     // Complete all transfers.
     for (byte_t prio = 0; prio < CANARD_PRIO_COUNT; prio++) {
@@ -1554,15 +1579,15 @@ static void test_bad_crc_frees_slot(void)
     frame_t fr0 = make_start_frame(
       canard_prio_slow, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 55, 0, f0, sizeof(f0));
     TEST_ASSERT_TRUE(feed(&fx, ts, &fr0, 0));
-    // One payload allocation for the slot.
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    // One payload allocation for the slot plus the session index array.
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     frame_t fr1 = make_cont_frame(
       canard_prio_slow, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 55, 0, true, false, f1, sizeof(f1));
     TEST_ASSERT_TRUE(feed(&fx, ts, &fr1, 0));
 
-    // Slot freed after bad CRC.
-    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_payload.allocated_fragments);
+    // Slot freed after bad CRC; the session index array remains.
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
     TEST_ASSERT_EQUAL_size_t(0, fx.capture.call_count);
     TEST_ASSERT_EQUAL_UINT64(1, fx.canard.err.rx_transfer);
 
@@ -1581,8 +1606,8 @@ static void test_single_frame_no_payload_alloc(void)
       canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 42, 0, payload, sizeof(payload));
     TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr, 0));
     TEST_ASSERT_EQUAL_size_t(1, fx.capture.call_count);
-    // No payload allocation.
-    TEST_ASSERT_EQUAL_UINT64(0, fx.alloc_payload.count_alloc);
+    // No payload allocation; the only allocation is the session index array.
+    TEST_ASSERT_EQUAL_UINT64(1, fx.alloc_payload.count_alloc);
     TEST_ASSERT_NULL(fx.capture.payload.origin.data);
 
     fixture_destroy_all_sessions(&fx);
@@ -1599,7 +1624,7 @@ static void test_multi_frame_allocate_then_free(void)
     frame_t      fr0    = make_start_frame(
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 0, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr0, 0));
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     // Complete the transfer.
     const uint16_t crc = crc_add(CRC_INITIAL, 7, data);
@@ -1618,8 +1643,8 @@ static void test_multi_frame_allocate_then_free(void)
                                   sizeof(f_end));
     TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr1, 0));
     TEST_ASSERT_EQUAL_size_t(1, fx.capture.call_count);
-    // Slot freed in on_message_capture.
-    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_payload.allocated_fragments);
+    // Slot freed in on_message_capture; the session index array remains.
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1641,7 +1666,7 @@ static void test_cleanup_destroys_stale(void)
     frame_t fr0 = make_start_frame(
       canard_prio_slow, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 0, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts0, &fr0, 0));
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     // Jump forward past RX_SESSION_TIMEOUT + transfer_id_timeout and start a new transfer at a different priority.
     // rx_session_cleanup uses: deadline = now - max(RX_SESSION_TIMEOUT, tid_timeout).
@@ -1652,7 +1677,7 @@ static void test_cleanup_destroys_stale(void)
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts1, &fr1, 0));
     // The old stale slot should have been cleaned up, and a new one allocated.
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1671,7 +1696,7 @@ static void test_cleanup_preserves_fresh(void)
     frame_t fr0 = make_start_frame(
       canard_prio_slow, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 0, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts0, &fr0, 0));
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     // Start another transfer at a different priority, but still within session timeout.
     // Use ts only slightly after ts0: the old slot should NOT be cleaned up.
@@ -1680,7 +1705,7 @@ static void test_cleanup_preserves_fresh(void)
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts1, &fr1, 0));
     // Both slots should exist now.
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1699,7 +1724,7 @@ static void test_cleanup_uses_max_timeout(void)
     frame_t fr0 = make_start_frame(
       canard_prio_slow, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 0, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts0, &fr0, 0));
-    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
 
     // At ts0 + 31s: within max(30s, 60s) = 60s, so slot should survive.
     // deadline = (ts0+31s) - 60s = 1s+31s-60s = -28s. slot->start_ts=1s > -28s → not stale.
@@ -1707,7 +1732,7 @@ static void test_cleanup_uses_max_timeout(void)
     frame_t           fr1 = make_start_frame(
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts1, &fr1, 0));
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments); // Both survive.
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments); // Both survive.
 
     // At ts0 + 61s+1: deadline = (1s+61s+1us) - 60s = 2s+1us. slot start_ts=1s < 2s+1us → stale.
     const canard_us_t ts2 = ts0 + (61 * MEGA) + 1;
@@ -1717,8 +1742,8 @@ static void test_cleanup_uses_max_timeout(void)
     // The old stale slow-prio slot should be cleaned up. Nominal may or may not be stale depending on its start_ts.
     // fr1 started at ts1=32*MEGA. deadline= (62*MEGA+1) - 60*MEGA = 2*MEGA+1.
     // slot at nominal: start_ts=32*MEGA > 2*MEGA+1 → not stale. Survives.
-    // So we expect: nominal slot + new high slot = 2. Old slow slot destroyed.
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
+    // So we expect: nominal slot + new high slot = 2, plus the session index array. Old slow slot destroyed.
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1741,7 +1766,7 @@ static void test_cleanup_triggered_by_start(void)
     frame_t fr1 = make_start_frame(
       canard_prio_nominal, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, data, sizeof(data));
     TEST_ASSERT_TRUE(feed(&fx, ts0 + 1, &fr1, 0));
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments);
 
     // Send a continuation for the nominal transfer well past the cleanup deadline.
     // Continuation does NOT trigger cleanup.
@@ -1759,7 +1784,7 @@ static void test_cleanup_triggered_by_start(void)
                                    sizeof(cont));
     TEST_ASSERT_TRUE(feed(&fx, ts_late, &fr_c, 0));
     // Both slots still exist because continuation does not trigger cleanup.
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -1895,13 +1920,19 @@ static void test_multiple_sources(void)
     // 3 sessions allocated.
     TEST_ASSERT_EQUAL_size_t(3, fx.alloc_session.allocated_fragments);
 
-    // Clean up all sessions via the tree.
+    // Clean up all sessions via the index.
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
 }
 
-/// Session animation ordering: newly active sessions are moved to the tail of the animation list.
-static void test_session_animation_ordering(void)
+/// Returns the timer wheel bucket the session is expected in given its expiry, assuming no clamping.
+static size_t wheel_bucket_of(const canard_us_t expiry)
+{
+    return (size_t)((expiry / CANARD_RX_WHEEL_TICK_us) % CANARD_RX_WHEEL_SIZE);
+}
+
+/// Sessions are filed in the timer wheel under the tick of their expiry; a new transfer reschedules the session.
+static void test_session_wheel_scheduling(void)
 {
     session_fixture_t fx;
     fixture_init_v1(&fx, canard_kind_message_16b, 100, 64);
@@ -1920,20 +1951,28 @@ static void test_session_animation_ordering(void)
                                        sizeof(payload));
         TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr, 0));
     }
-    // Now the animation list should be: head=10, ..., tail=30.
-    rx_session_t* head = LIST_HEAD(fx.canard.rx.list_session_by_animation, rx_session_t, list_animation);
+    // All expire at the same time: admission + transfer-ID timeout, so they share a bucket in the order of creation.
+    const size_t  bucket_a = wheel_bucket_of((3 * MEGA) + 1);
+    rx_session_t* head     = LIST_HEAD(fx.canard.rx.wheel[bucket_a], rx_session_t, list_wheel);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_UINT8(10, head->node_id);
+    TEST_ASSERT_EQUAL_INT64((3 * MEGA) + 1, head->expiry);
+    TEST_ASSERT_EQUAL_size_t(bucket_a, head->wheel_bucket);
 
-    // Send a new transfer from src=10 to move it to the tail.
+    // Send a new transfer from src=10 to move it to a later bucket.
     frame_t fr10 = make_single_frame(
       canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 10, 1, payload, sizeof(payload));
     TEST_ASSERT_TRUE(feed(&fx, 2 * MEGA, &fr10, 0));
-
-    // Now head should be src=20 (the next oldest).
-    head = LIST_HEAD(fx.canard.rx.list_session_by_animation, rx_session_t, list_animation);
+    // The buckets may coincide if the wheel is small.
+    const size_t bucket_b = wheel_bucket_of((4 * MEGA) + 1);
+    head                  = LIST_HEAD(fx.canard.rx.wheel[bucket_a], rx_session_t, list_wheel);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_UINT8(20, head->node_id);
+    rx_session_t* const tail = LIST_TAIL(fx.canard.rx.wheel[bucket_b], rx_session_t, list_wheel);
+    TEST_ASSERT_NOT_NULL(tail);
+    TEST_ASSERT_EQUAL_UINT8(10, tail->node_id);
+    TEST_ASSERT_EQUAL_INT64((4 * MEGA) + 1, tail->expiry);
+    TEST_ASSERT_EQUAL_size_t(bucket_b, tail->wheel_bucket);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -2084,8 +2123,8 @@ static void test_preemption_during_multiframe(void)
     frame_t      fr_hi     = make_start_frame(
       canard_prio_high, canard_kind_message_13b, 2222, CANARD_NODE_ID_ANONYMOUS, 42, 1, hi_data, sizeof(hi_data));
     TEST_ASSERT_TRUE(feed(&fx, ts0 + 1, &fr_hi, 0));
-    // Two slots allocated (nominal and high).
-    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_payload.allocated_fragments);
+    // Two slots allocated (nominal and high) plus the session index array.
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_payload.allocated_fragments);
 
     // Complete the high-priority transfer.
     const uint16_t crc_hi = crc_add(CRC_INITIAL, 7, hi_data);
@@ -2228,53 +2267,58 @@ static void test_oom_slot_allocation_session_survives(void)
     fixture_check_alloc_balance(&fx);
 }
 
-/// Session animation: create 3 sessions, feed to the middle one, verify it moves to tail.
-static void test_session_animation_ordering_move_to_tail(void)
+/// Timer wheel advancement reclaims exactly the sessions and slots that are due, regardless of the creation order.
+static void test_session_wheel_advance(void)
 {
     session_fixture_t fx;
     fixture_init_v1(&fx, canard_kind_message_16b, 100, 64);
 
-    const byte_t payload[] = { 0xAA };
+    const byte_t payload[] = { 0, 1, 2, 3, 4, 5, 6 };
 
-    // Create sessions for src=10, src=20, src=30.
-    for (byte_t src = 10; src <= 30; src = (byte_t)(src + 10)) {
-        frame_t fr = make_single_frame(canard_prio_nominal,
-                                       canard_kind_message_16b,
-                                       100,
-                                       CANARD_NODE_ID_ANONYMOUS,
-                                       src,
-                                       0,
-                                       payload,
-                                       sizeof(payload));
-        TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr, 0));
-    }
-    TEST_ASSERT_EQUAL_size_t(3, fx.capture.call_count);
+    // src=20 starts a multi-frame transfer first; the slot keeps it alive for the session timeout.
+    frame_t fr20 = make_start_frame(
+      canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 20, 0, payload, sizeof(payload));
+    TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr20, 0));
+    frame_t fr10 =
+      make_single_frame(canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 10, 0, payload, 1);
+    TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr10, 0));
+    frame_t fr30 =
+      make_single_frame(canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 30, 0, payload, 1);
+    TEST_ASSERT_TRUE(feed(&fx, 2 * MEGA, &fr30, 0));
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_session.allocated_fragments);
+    const size_t slot_fragments = fx.alloc_payload.allocated_fragments;
+    TEST_ASSERT_TRUE(slot_fragments > 0);
+    TEST_ASSERT_EQUAL_INT64((1 * MEGA) + RX_SESSION_TIMEOUT + 1, rx_session_find(&fx.sub, 20)->expiry);
 
-    // Animation list: head=10, 20, 30=tail.
-    rx_session_t* head = LIST_HEAD(fx.canard.rx.list_session_by_animation, rx_session_t, list_animation);
-    TEST_ASSERT_NOT_NULL(head);
-    TEST_ASSERT_EQUAL_UINT8(10, head->node_id);
+    // Nothing is due yet.
+    rx_wheel_advance(&fx.canard, 3 * MEGA);
+    TEST_ASSERT_EQUAL_size_t(3, fx.alloc_session.allocated_fragments);
 
-    // Feed a frame to session 20 → it should move to the tail.
-    frame_t fr20 = make_single_frame(
-      canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 20, 1, payload, sizeof(payload));
-    TEST_ASSERT_TRUE(feed(&fx, 2 * MEGA, &fr20, 0));
-    TEST_ASSERT_EQUAL_size_t(4, fx.capture.call_count);
+    // src=10 is due even though src=20 is older.
+    rx_wheel_advance(&fx.canard, (3 * MEGA) + 1);
+    TEST_ASSERT_EQUAL_size_t(2, fx.alloc_session.allocated_fragments);
+    TEST_ASSERT_NULL(rx_session_find(&fx.sub, 10));
 
-    // Now head should be src=10 (unchanged because 30 was in second position, now 10 stays).
-    head = LIST_HEAD(fx.canard.rx.list_session_by_animation, rx_session_t, list_animation);
-    TEST_ASSERT_NOT_NULL(head);
-    TEST_ASSERT_EQUAL_UINT8(10, head->node_id);
+    rx_wheel_advance(&fx.canard, (4 * MEGA) + 1);
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_session.allocated_fragments);
+    TEST_ASSERT_NULL(rx_session_find(&fx.sub, 30));
+    TEST_ASSERT_NOT_NULL(rx_session_find(&fx.sub, 20));
 
-    // Feed a frame to session 10 → it should move to the tail.
-    frame_t fr10 = make_single_frame(
-      canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 10, 1, payload, sizeof(payload));
-    TEST_ASSERT_TRUE(feed(&fx, 3 * MEGA, &fr10, 0));
+    // A jump over more than a full rotation of the wheel visits every bucket once.
+    // The stale slot is purged and then the session is destroyed in the same visit.
+    rx_wheel_advance(&fx.canard, RX_SESSION_TIMEOUT);
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_session.allocated_fragments);
+    rx_wheel_advance(&fx.canard, (1 * MEGA) + RX_SESSION_TIMEOUT + 1);
+    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_session.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_payload.allocated_fragments);
+    for (size_t i = 0; i < CANARD_RX_WHEEL_SIZE; i++) {
+        TEST_ASSERT_NULL(fx.canard.rx.wheel[i].head);
+    }
 
-    // Now head should be src=30 (the oldest untouched session).
-    head = LIST_HEAD(fx.canard.rx.list_session_by_animation, rx_session_t, list_animation);
-    TEST_ASSERT_NOT_NULL(head);
-    TEST_ASSERT_EQUAL_UINT8(30, head->node_id);
+    // Time going backward does not revisit the processed ticks.
+    const int64_t tick = fx.canard.rx.wheel_tick;
+    rx_wheel_advance(&fx.canard, 0);
+    TEST_ASSERT_EQUAL_INT64(tick, fx.canard.rx.wheel_tick);
 
     fixture_destroy_all_sessions(&fx);
     fixture_check_alloc_balance(&fx);
@@ -2584,6 +2628,152 @@ static void test_v0_extent_zero_multiframe(void)
     fixture_check_alloc_balance(&fx);
 }
 
+// =====================================================================================================================
+// Group 12: Session Index
+
+/// Checks that the session index is consistent: the bitmap matches the sessions and the array is ordered by node-ID.
+static void check_session_index(const session_fixture_t* const fx, const size_t expected_count)
+{
+    TEST_ASSERT_EQUAL_size_t(expected_count, rx_session_count(&fx->sub));
+    TEST_ASSERT_EQUAL_size_t(expected_count, fx->alloc_session.allocated_fragments);
+    TEST_ASSERT_TRUE(fx->sub.session_capacity >= expected_count);
+    TEST_ASSERT_TRUE(fx->sub.session_capacity <= CANARD_NODE_ID_CAPACITY);
+    TEST_ASSERT_EQUAL(expected_count == 0, fx->sub.sessions == NULL);
+    size_t rank = 0;
+    for (byte_t nid = 0; nid <= CANARD_NODE_ID_MAX; nid++) {
+        const rx_session_t* const ses = rx_session_find(&fx->sub, nid);
+        if (ses != NULL) {
+            TEST_ASSERT_EQUAL_PTR(fx->sub.sessions[rank], ses);
+            TEST_ASSERT_EQUAL_UINT8(nid, ses->node_id);
+            rank++;
+        }
+    }
+    TEST_ASSERT_EQUAL_size_t(expected_count, rank);
+}
+
+/// Sessions for all possible remotes are created in random order and then destroyed in random order.
+/// The array grows and shrinks geometrically while the lookup remains consistent throughout.
+static void test_session_index_random_order(void)
+{
+    session_fixture_t fx;
+    fixture_init_v1(&fx, canard_kind_message_16b, 100, 64);
+
+    byte_t order[CANARD_NODE_ID_CAPACITY];
+    for (size_t i = 0; i < CANARD_NODE_ID_CAPACITY; i++) {
+        order[i] = (byte_t)i;
+    }
+    for (size_t i = CANARD_NODE_ID_CAPACITY - 1U; i > 0; i--) { // Fisher-Yates shuffle.
+        const size_t j = (size_t)rand() % (i + 1U);
+        const byte_t t = order[i];
+        order[i]       = order[j];
+        order[j]       = t;
+    }
+    for (size_t i = 0; i < CANARD_NODE_ID_CAPACITY; i++) {
+        rx_session_t* const ses = rx_session_new(&fx.sub, 0, order[i]);
+        TEST_ASSERT_NOT_NULL(ses);
+        TEST_ASSERT_EQUAL_PTR(ses, rx_session_find(&fx.sub, order[i]));
+        check_session_index(&fx, i + 1U);
+    }
+    TEST_ASSERT_EQUAL_UINT8(CANARD_NODE_ID_CAPACITY, fx.sub.session_capacity);
+    TEST_ASSERT_EQUAL_size_t(1, fx.alloc_payload.allocated_fragments); // The array is the only payload allocation.
+
+    for (size_t i = CANARD_NODE_ID_CAPACITY - 1U; i > 0; i--) { // Reshuffle for the removal order.
+        const size_t j = (size_t)rand() % (i + 1U);
+        const byte_t t = order[i];
+        order[i]       = order[j];
+        order[j]       = t;
+    }
+    for (size_t i = 0; i < CANARD_NODE_ID_CAPACITY; i++) {
+        rx_session_destroy(rx_session_find(&fx.sub, order[i]));
+        TEST_ASSERT_NULL(rx_session_find(&fx.sub, order[i]));
+        check_session_index(&fx, CANARD_NODE_ID_CAPACITY - 1U - i);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, fx.sub.session_capacity);
+    fixture_check_alloc_balance(&fx);
+}
+
+/// The array does not reallocate when the session count oscillates around a power of two.
+static void test_session_index_hysteresis(void)
+{
+    session_fixture_t fx;
+    fixture_init_v1(&fx, canard_kind_message_16b, 100, 64);
+
+    for (byte_t nid = 0; nid < 9; nid++) {
+        TEST_ASSERT_NOT_NULL(rx_session_new(&fx.sub, 0, nid));
+    }
+    TEST_ASSERT_EQUAL_UINT8(16, fx.sub.session_capacity);
+    const uint64_t allocs = fx.alloc_payload.count_alloc;
+    for (size_t i = 0; i < 10; i++) {
+        rx_session_destroy(rx_session_find(&fx.sub, 8));
+        TEST_ASSERT_NOT_NULL(rx_session_new(&fx.sub, 0, 8));
+    }
+    TEST_ASSERT_EQUAL_UINT64(allocs, fx.alloc_payload.count_alloc);
+    TEST_ASSERT_EQUAL_UINT8(16, fx.sub.session_capacity);
+
+    // Shrinking only happens once the array is at most a quarter full.
+    for (byte_t nid = 8; nid >= 5; nid--) {
+        rx_session_destroy(rx_session_find(&fx.sub, nid));
+    }
+    TEST_ASSERT_EQUAL_UINT8(16, fx.sub.session_capacity);
+    rx_session_destroy(rx_session_find(&fx.sub, 4)); // 4 left.
+    TEST_ASSERT_EQUAL_UINT8(8, fx.sub.session_capacity);
+    check_session_index(&fx, 4);
+    rx_session_destroy(rx_session_find(&fx.sub, 3)); // 3 left, the minimum capacity is not reached yet.
+    TEST_ASSERT_EQUAL_UINT8(8, fx.sub.session_capacity);
+    rx_session_destroy(rx_session_find(&fx.sub, 2)); // 2 left.
+    TEST_ASSERT_EQUAL_UINT8(4, fx.sub.session_capacity);
+    check_session_index(&fx, 2);
+
+    fixture_destroy_all_sessions(&fx);
+    fixture_check_alloc_balance(&fx);
+}
+
+/// OOM while growing the array rejects the new session but leaves the existing ones intact.
+static void test_session_index_oom(void)
+{
+    session_fixture_t fx;
+    fixture_init_v1(&fx, canard_kind_message_16b, 100, 64);
+
+    // The first session cannot be created if the array cannot be allocated, and nothing is leaked.
+    fx.alloc_payload.limit_fragments = 0;
+    TEST_ASSERT_NULL(rx_session_new(&fx.sub, 0, 10));
+    check_session_index(&fx, 0);
+    // Conversely, if the session cannot be allocated, the new array is released.
+    fx.alloc_payload.limit_fragments = SIZE_MAX;
+    fx.alloc_session.limit_fragments = 0;
+    TEST_ASSERT_NULL(rx_session_new(&fx.sub, 0, 10));
+    check_session_index(&fx, 0);
+    TEST_ASSERT_EQUAL_size_t(0, fx.alloc_payload.allocated_fragments);
+    fx.alloc_session.limit_fragments = SIZE_MAX;
+
+    for (byte_t nid = 0; nid < 4; nid++) {
+        TEST_ASSERT_NOT_NULL(rx_session_new(&fx.sub, 0, (byte_t)(nid * 10U)));
+    }
+    TEST_ASSERT_EQUAL_UINT8(4, fx.sub.session_capacity);
+    fx.alloc_payload.limit_fragments = 1; // The array cannot grow.
+    TEST_ASSERT_NULL(rx_session_new(&fx.sub, 0, 5));
+    check_session_index(&fx, 4);
+
+    // The same via the RX pipeline: the OOM is reported and the existing sessions keep working.
+    const byte_t payload[] = { 0xAA };
+    frame_t      fr        = make_single_frame(
+      canard_prio_nominal, canard_kind_message_16b, 100, CANARD_NODE_ID_ANONYMOUS, 5, 0, payload, sizeof(payload));
+    TEST_ASSERT_FALSE(feed(&fx, 1 * MEGA, &fr, 0));
+    TEST_ASSERT_EQUAL_size_t(0, fx.capture.call_count);
+    fr.src = 20;
+    TEST_ASSERT_TRUE(feed(&fx, 1 * MEGA, &fr, 0));
+    TEST_ASSERT_EQUAL_size_t(1, fx.capture.call_count);
+    TEST_ASSERT_EQUAL_UINT8(20, fx.capture.source_node_id);
+
+    fx.alloc_payload.limit_fragments = SIZE_MAX;
+    TEST_ASSERT_NOT_NULL(rx_session_new(&fx.sub, 0, 5));
+    TEST_ASSERT_EQUAL_UINT8(8, fx.sub.session_capacity);
+    check_session_index(&fx, 5);
+
+    fixture_destroy_all_sessions(&fx);
+    fixture_check_alloc_balance(&fx);
+}
+
 // =====================================================================================================================
 
 int main(void)
@@ -2596,6 +2786,7 @@ int main(void)
     RUN_TEST(test_slot_new_v0);
     RUN_TEST(test_slot_new_oom);
     RUN_TEST(test_slot_advance_and_truncation);
+    RUN_TEST(test_slot_advance_crc_skip);
     RUN_TEST(test_slot_advance_zero_extent);
 
     // Group 2: v1 Golden Single-Frame
@@ -2654,7 +2845,7 @@ int main(void)
     RUN_TEST(test_extent_exact);
     RUN_TEST(test_tid_rollover);
     RUN_TEST(test_multiple_sources);
-    RUN_TEST(test_session_animation_ordering);
+    RUN_TEST(test_session_wheel_scheduling);
     RUN_TEST(test_all_7_kinds);
 
     // Group 10: New adversarial tests
@@ -2663,7 +2854,7 @@ int main(void)
     RUN_TEST(test_transfer_id_rollover_31_to_0);
     RUN_TEST(test_session_timeout_exact_boundary);
     RUN_TEST(test_oom_slot_allocation_session_survives);
-    RUN_TEST(test_session_animation_ordering_move_to_tail);
+    RUN_TEST(test_session_wheel_advance);
     RUN_TEST(test_v0_multiframe_crc_validation);
     RUN_TEST(test_v0_single_frame_no_crc);
 
@@ -2676,5 +2867,10 @@ int main(void)
     RUN_TEST(test_v0_extent_change_during_multiframe);
     RUN_TEST(test_v0_extent_zero_multiframe);
 
+    // Group 12: Session Index
+    RUN_TEST(test_session_index_random_order);
+    RUN_TEST(test_session_index_hysteresis);
+    RUN_TEST(test_session_index_oom);
+
     return UNITY_END();
 }
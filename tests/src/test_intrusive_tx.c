@@ -64,6 +64,9 @@ static void init_canard(canard_t* const                 self,
     self->tx.queue_capacity = queue_capacity;
     self->mem.tx_transfer   = instrumented_allocator_make_resource(alloc);
     self->mem.tx_frame      = instrumented_allocator_make_resource(alloc);
+    FOREACH_PRIO (i) {
+        self->tx.queue_limit[i] = self->tx.queue_capacity;
+    }
 }
 
 // Release all queued transfers.
@@ -72,7 +75,7 @@ static void free_all_transfers(canard_t* const self)
     tx_transfer_t* tr = LIST_HEAD(self->tx.agewise, tx_transfer_t, list_agewise);
     while (tr != NULL) {
         tx_transfer_t* const next = LIST_NEXT(tr, tx_transfer_t, list_agewise);
-        tx_retire(self, tr);
+        tx_retire(self, tr, canard_tx_outcome_canceled);
         tr = next;
     }
 }
@@ -140,7 +143,8 @@ static void test_tx_spool_single_frame(void)
     const byte_t               data[]  = { 1U, 2U, 3U, 4U };
     const canard_bytes_chain_t payload = { .bytes = { .size = sizeof(data), .data = data }, .next = NULL };
 
-    tx_frame_t* const head = tx_spool(&self, CRC_INITIAL, CANARD_MTU_CAN_CLASSIC, 7U, sizeof(data), payload);
+    tx_frame_t* const head =
+      tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, CANARD_MTU_CAN_CLASSIC, 7U, sizeof(data), &payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
     TEST_ASSERT_EQUAL_size_t(5U, canard_dlc_to_len[head->dlc]);
@@ -164,7 +168,8 @@ static void test_tx_spool_multi_frame(void)
     }
     const canard_bytes_chain_t payload = { .bytes = { .size = sizeof(data), .data = data }, .next = NULL };
 
-    tx_frame_t* const head = tx_spool(&self, CRC_INITIAL, CANARD_MTU_CAN_CLASSIC, 3U, sizeof(data), payload);
+    tx_frame_t* const head =
+      tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, CANARD_MTU_CAN_CLASSIC, 3U, sizeof(data), &payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(2U, count_frames(head));
     TEST_ASSERT_EQUAL_HEX8(0xA3, head->data[7]);
@@ -190,7 +195,7 @@ static void test_tx_push_basic(void)
     TEST_ASSERT_TRUE(tx_push(&self, tr, false, 1U, 5U, payload, CRC_INITIAL));
     TEST_ASSERT_EQUAL_size_t(1U, self.tx.queue_size);
     TEST_ASSERT_NOT_NULL(LIST_HEAD(self.tx.agewise, tx_transfer_t, list_agewise));
-    TEST_ASSERT_TRUE(cavl2_is_inserted(self.tx.pending[0], &tr->index_pending[0]));
+    TEST_ASSERT_TRUE(is_listed(&self.tx.pending[0][canard_prio_nominal], &tr->list_pending[0]));
 
     free_all_transfers(&self);
     TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
@@ -223,7 +228,8 @@ static void test_tx_push_oom(void)
     // One fragment for transfer object only; frame allocation will fail.
     alloc.limit_fragments = 1U;
 
-    const byte_t               data[]  = { 1U, 2U, 3U, 4U };
+    // Multi-frame if the inline frame storage of the transfer is enabled, which a single-frame transfer would use.
+    const byte_t               data[(CANARD_TX_INLINE_FRAME_SIZE > 0) ? 8U : 4U] = { 1U, 2U, 3U, 4U };
     const canard_bytes_chain_t payload = { .bytes = { .size = sizeof(data), .data = data }, .next = NULL };
     tx_transfer_t* const tr = tx_transfer_new(&self, 1000, ((uint32_t)canard_prio_nominal) << PRIO_SHIFT, false, NULL);
     TEST_ASSERT_NOT_NULL(tr);
@@ -232,6 +238,49 @@ static void test_tx_push_oom(void)
     TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
 }
 
+// A single-frame transfer uses the frame storage inside the transfer object if CANARD_TX_INLINE_FRAME_SIZE permits.
+// A retained frame keeps the retired transfer object alive until released.
+static void test_tx_push_inline_frame(void)
+{
+    canard_t                 self;
+    test_context_t           ctx;
+    instrumented_allocator_t alloc;
+    init_canard(&self, &ctx, &alloc, 8U);
+
+    const bool                 inlined = CANARD_TX_INLINE_FRAME_SIZE >= 4U;
+    const byte_t               data[]  = { 1U, 2U, 3U };
+    const canard_bytes_chain_t payload = { .bytes = { .size = sizeof(data), .data = data }, .next = NULL };
+    tx_transfer_t* const tr = tx_transfer_new(&self, 1000, ((uint32_t)canard_prio_nominal) << PRIO_SHIFT, false, NULL);
+    TEST_ASSERT_NOT_NULL(tr);
+    TEST_ASSERT_TRUE(tx_push(&self, tr, false, 3U, 3U, payload, CRC_INITIAL));
+    TEST_ASSERT_EQUAL_size_t(inlined ? 1U : 2U, alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_size_t(1U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_PTR(tr->cursor[0], tr->cursor[1]);
+    TEST_ASSERT_EQUAL_size_t(2U, tr->cursor[0]->refcount);
+    TEST_ASSERT_EQUAL_UINT8(inlined ? 1U : 0U, tr->cursor[0]->inlined);
+    const canard_bytes_t view = tx_frame_view(tr->cursor[0]);
+    TEST_ASSERT_EQUAL_size_t(4U, view.size);
+    TEST_ASSERT_EQUAL_MEMORY(data, view.data, sizeof(data));
+
+    // Retain the frame as a driver would and retire the transfer; the memory is held until the frame is released.
+    canard_refcount_inc(view);
+    tx_retire(&self, tr, canard_tx_outcome_canceled);
+    TEST_ASSERT_EQUAL_size_t(1U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(1U, alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_UINT8(0xE3U, ((const byte_t*)view.data)[3]); // Tail byte still intact.
+    canard_refcount_dec(&self, view);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+
+    // Retire without retention.
+    tx_transfer_t* const tr2 = tx_transfer_new(&self, 1000, ((uint32_t)canard_prio_nominal) << PRIO_SHIFT, false, NULL);
+    TEST_ASSERT_NOT_NULL(tr2);
+    TEST_ASSERT_TRUE(tx_push(&self, tr2, false, 1U, 4U, payload, CRC_INITIAL));
+    tx_retire(&self, tr2, canard_tx_outcome_canceled);
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+}
+
 // first_frame_departed flips only after a successful first-frame ejection.
 static void test_tx_first_frame_departure_flag(void)
 {
@@ -331,7 +380,7 @@ static void test_tx_purge_continuations_keeps_started_single_frame(void)
     ctx.tx_budget[0] = 1U;
     tx_eject_pending(&self, 0U);
     TEST_ASSERT_EQUAL_UINT8(1U, (uint8_t)tr->first_frame_departed);
-    TEST_ASSERT_TRUE(cavl2_is_inserted(self.tx.pending[1], &tr->index_pending[1]));
+    TEST_ASSERT_TRUE(is_listed(&self.tx.pending[1][canard_prio_nominal], &tr->list_pending[1]));
 
     tx_purge_continuations(&self);
     TEST_ASSERT_EQUAL_size_t(1U, count_enqueued_transfers(&self));
@@ -1010,7 +1059,7 @@ static void test_tx_spool_boundary_single_multi_classic(void)
         init_canard(&self, &ctx, &alloc, 16U);
         const byte_t               data[7] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U };
         const canard_bytes_chain_t payload = { .bytes = { .size = 7U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 8U, 0U, 7U, payload);
+        tx_frame_t* const          head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 0U, 7U, &payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
         // frame_size = tx_ceil(7+1) = 8. Tail byte at data[7].
@@ -1029,7 +1078,7 @@ static void test_tx_spool_boundary_single_multi_classic(void)
             data[i] = (byte_t)(0x10U + i);
         }
         const canard_bytes_chain_t payload = { .bytes = { .size = 8U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 8U, 0U, 8U, payload);
+        tx_frame_t* const          head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 0U, 8U, &payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_TRUE(count_frames(head) >= 2U);
         // First frame: SOT set, EOT not set, toggle=1 (Cyphal v1).
@@ -1064,7 +1113,7 @@ static void test_tx_spool_boundary_single_multi_fd(void)
             data[i] = (byte_t)i;
         }
         const canard_bytes_chain_t payload = { .bytes = { .size = 63U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 64U, 5U, 63U, payload);
+        tx_frame_t* const head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 64U, 5U, 63U, &payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
         // frame_size = tx_ceil(63+1)=64. Tail at data[63].
@@ -1083,7 +1132,7 @@ static void test_tx_spool_boundary_single_multi_fd(void)
             data[i] = (byte_t)(0x80U + (i & 0x7FU));
         }
         const canard_bytes_chain_t payload = { .bytes = { .size = 64U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 64U, 5U, 64U, payload);
+        tx_frame_t* const head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 64U, 5U, 64U, &payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_TRUE(count_frames(head) >= 2U);
         // First frame: SOT set, EOT not set.
@@ -1113,7 +1162,7 @@ static void test_tx_spool_crc_split_across_frames(void)
         data[i] = (byte_t)(0xA0U + i);
     }
     const canard_bytes_chain_t payload = { .bytes = { .size = 13U, .data = data }, .next = NULL };
-    tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 8U, 2U, 13U, payload);
+    tx_frame_t* const          head    = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 2U, 13U, &payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(3U, count_frames(head));
 
@@ -1158,7 +1207,7 @@ static void test_tx_spool_empty_payload(void)
     init_canard(&self, &ctx, &alloc, 16U);
 
     const canard_bytes_chain_t payload = { .bytes = { .size = 0U, .data = NULL }, .next = NULL };
-    tx_frame_t* const          head    = tx_spool(&self, CRC_INITIAL, 8U, 9U, 0U, payload);
+    tx_frame_t* const          head    = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 9U, 0U, &payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
     // frame_size = tx_ceil(0+1) = 1. The entire frame is just the tail byte.
@@ -1191,7 +1240,7 @@ static void test_tx_spool_scattered_many_fragments(void)
 
     // Spool scattered payload.
     init_canard(&self, &ctx, &alloc, 16U);
-    tx_frame_t* const scattered = tx_spool(&self, CRC_INITIAL, 8U, 3U, 10U, chain0);
+    tx_frame_t* const scattered = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 3U, 10U, &chain0);
     TEST_ASSERT_NOT_NULL(scattered);
 
     // Spool contiguous equivalent.
@@ -1201,7 +1250,7 @@ static void test_tx_spool_scattered_many_fragments(void)
     test_context_t             ctx2;
     instrumented_allocator_t   alloc2;
     init_canard(&self2, &ctx2, &alloc2, 16U);
-    tx_frame_t* const contiguous = tx_spool(&self2, CRC_INITIAL, 8U, 3U, 10U, contig);
+    tx_frame_t* const contiguous = tx_spool(&self2, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 3U, 10U, &contig);
     TEST_ASSERT_NOT_NULL(contiguous);
 
     // Compare frame-by-frame.
@@ -1239,7 +1288,7 @@ static void test_tx_spool_scattered_with_empty_fragments(void)
     canard_bytes_chain_t c0       = { .bytes = { .size = 3U, .data = frag_a }, .next = &c1 };
     // Total = 7 bytes. 7 < 8 => single-frame.
 
-    tx_frame_t* const head = tx_spool(&self, CRC_INITIAL, 8U, 1U, 7U, c0);
+    tx_frame_t* const head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 1U, 7U, &c0);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
     TEST_ASSERT_EQUAL_size_t(8U, canard_dlc_to_len[head->dlc]); // tx_ceil(7+1)=8
@@ -1270,14 +1319,67 @@ static void test_tx_spool_oom_midway(void)
     }
     const canard_bytes_chain_t payload = { .bytes = { .size = 20U, .data = data }, .next = NULL };
     // 20 bytes with mtu=8 needs ceil((20+2)/7)=ceil(22/7)=4 frames.
-    // Allow only 2 frame allocations to cause OOM midway.
+    // Allow only 2 frame allocations to cause OOM midway. The byte limit also rules out the contiguous block.
     alloc.limit_fragments = 2U;
+    alloc.limit_bytes     = 2U * (sizeof(tx_frame_t) + 8U);
 
-    tx_frame_t* const head = tx_spool(&self, CRC_INITIAL, 8U, 0U, 20U, payload);
+    tx_frame_t* const head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 0U, 20U, &payload);
     TEST_ASSERT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
 }
 
+// The frames of a multi-frame transfer share one allocation if CANARD_TX_CONTIGUOUS_SPOOL is enabled.
+// The frames are reference-counted individually, and the memory is released with the last frame.
+static void test_tx_spool_contiguous(void)
+{
+    canard_t                 self;
+    test_context_t           ctx;
+    instrumented_allocator_t alloc;
+    init_canard(&self, &ctx, &alloc, 16U);
+
+    byte_t data[20];
+    for (size_t i = 0; i < 20U; i++) {
+        data[i] = (byte_t)i;
+    }
+    const canard_bytes_chain_t payload = { .bytes = { .size = 20U, .data = data }, .next = NULL };
+    tx_frame_t* const          head    = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 0U, 20U, &payload);
+    TEST_ASSERT_NOT_NULL(head);
+    tx_frame_t* frames[4] = { head, head->next, head->next->next, head->next->next->next };
+    TEST_ASSERT_NOT_NULL(frames[3]);
+    TEST_ASSERT_NULL(frames[3]->next);
+    TEST_ASSERT_EQUAL_size_t(4U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(CANARD_TX_CONTIGUOUS_SPOOL ? 1U : 4U, alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_UINT64(CANARD_TX_CONTIGUOUS_SPOOL ? 1U : 4U, alloc.count_alloc);
+    for (size_t i = 0; i < 4U; i++) {
+        TEST_ASSERT_EQUAL_size_t((i == 3U) ? 2U : 8U, tx_frame_view(frames[i]).size);
+    }
+
+    // Retain one frame as a driver would; release the others out of order.
+    canard_refcount_inc(tx_frame_view(frames[1]));
+    canard_refcount_dec(&self, tx_frame_view(frames[2]));
+    canard_refcount_dec(&self, tx_frame_view(frames[0]));
+    canard_refcount_dec(&self, tx_frame_view(frames[1]));
+    canard_refcount_dec(&self, tx_frame_view(frames[3]));
+    TEST_ASSERT_EQUAL_size_t(1U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(1U, alloc.allocated_fragments);
+    TEST_ASSERT_EQUAL_UINT8(7U, frames[1]->data[0]); // Still intact.
+    canard_refcount_dec(&self, tx_frame_view(frames[1]));
+    TEST_ASSERT_EQUAL_size_t(0U, self.tx.queue_size);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+
+    // If the block cannot be allocated, the frames are allocated individually.
+    alloc.limit_bytes = 4U * (sizeof(tx_frame_t) + 8U);
+    tx_frame_t* chain = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 8U, 0U, 20U, &payload);
+    TEST_ASSERT_NOT_NULL(chain);
+    TEST_ASSERT_EQUAL_size_t(4U, alloc.allocated_fragments);
+    while (chain != NULL) {
+        tx_frame_t* const next = chain->next;
+        canard_refcount_dec(&self, tx_frame_view(chain));
+        chain = next;
+    }
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+}
+
 // Large payload with CAN FD: verify frame count and tail byte progression.
 static void test_tx_spool_large_payload_fd(void)
 {
@@ -1292,7 +1394,7 @@ static void test_tx_spool_large_payload_fd(void)
     }
     const canard_bytes_chain_t payload = { .bytes = { .size = 300U, .data = data }, .next = NULL };
     // 300 >= 64 => multiframe. ceil((300+2)/63)=ceil(302/63)=5 frames.
-    tx_frame_t* const head = tx_spool(&self, CRC_INITIAL, 64U, 7U, 300U, payload);
+    tx_frame_t* const head = tx_spool(&self, NULL, canard_prio_nominal, CRC_INITIAL, 64U, 7U, 300U, &payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(5U, count_frames(head));
 
@@ -1348,7 +1450,7 @@ static void test_tx_spool_v0_single_frame(void)
 
     const byte_t               data[]  = { 0x10U, 0x20U, 0x30U, 0x40U, 0x50U, 0x60U };
     const canard_bytes_chain_t payload = { .bytes = { .size = 6U, .data = data }, .next = NULL };
-    tx_frame_t* const          head    = tx_spool_v0(&self, CRC_INITIAL, 4U, 6U, payload);
+    tx_frame_t* const          head    = tx_spool_v0(&self, NULL, canard_prio_nominal, CRC_INITIAL, 4U, 6U, payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
     // v0 single-frame: size = 6+1 = 7. No rounding in v0 single-frame path.
@@ -1375,7 +1477,7 @@ static void test_tx_spool_v0_boundary(void)
         init_canard(&self, &ctx, &alloc, 16U);
         const byte_t               data[]  = { 1U, 2U, 3U, 4U, 5U, 6U, 7U };
         const canard_bytes_chain_t payload = { .bytes = { .size = 7U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool_v0(&self, CRC_INITIAL, 0U, 7U, payload);
+        tx_frame_t* const          head = tx_spool_v0(&self, NULL, canard_prio_nominal, CRC_INITIAL, 0U, 7U, payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_EQUAL_size_t(1U, count_frames(head));
         TEST_ASSERT_EQUAL_size_t(8U, canard_dlc_to_len[head->dlc]);      // 7+1=8
@@ -1389,7 +1491,7 @@ static void test_tx_spool_v0_boundary(void)
         init_canard(&self, &ctx, &alloc, 16U);
         const byte_t               data[]  = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
         const canard_bytes_chain_t payload = { .bytes = { .size = 8U, .data = data }, .next = NULL };
-        tx_frame_t* const          head    = tx_spool_v0(&self, CRC_INITIAL, 0U, 8U, payload);
+        tx_frame_t* const          head = tx_spool_v0(&self, NULL, canard_prio_nominal, CRC_INITIAL, 0U, 8U, payload);
         TEST_ASSERT_NOT_NULL(head);
         TEST_ASSERT_TRUE(count_frames(head) >= 2U);
         // First frame has SOT set, toggle=0 for v0.
@@ -1414,7 +1516,7 @@ static void test_tx_spool_v0_crc_byte_order(void)
     // 8 >= 8 => multiframe. CRC is computed over payload and prepended in v0.
     const uint16_t crc = crc_add(CRC_INITIAL, 8U, data);
 
-    tx_frame_t* const head = tx_spool_v0(&self, CRC_INITIAL, 0U, 8U, payload);
+    tx_frame_t* const head = tx_spool_v0(&self, NULL, canard_prio_nominal, CRC_INITIAL, 0U, 8U, payload);
     TEST_ASSERT_NOT_NULL(head);
     // v0 prepends CRC in LE: the first 2 bytes of the stream are [crc_low, crc_high].
     // Frame 1 data[0..6] are the first 7 stream bytes. Stream = [crc_lo, crc_hi, payload...].
@@ -1441,7 +1543,7 @@ static void test_tx_spool_v0_toggle_alternation(void)
         data[i] = (byte_t)(i + 1U);
     }
     const canard_bytes_chain_t payload = { .bytes = { .size = 19U, .data = data }, .next = NULL };
-    tx_frame_t* const          head    = tx_spool_v0(&self, CRC_INITIAL, 5U, 19U, payload);
+    tx_frame_t* const          head    = tx_spool_v0(&self, NULL, canard_prio_nominal, CRC_INITIAL, 5U, 19U, payload);
     TEST_ASSERT_NOT_NULL(head);
     TEST_ASSERT_EQUAL_size_t(3U, count_frames(head));
 
@@ -1602,6 +1704,62 @@ static void test_tx_expire_boundary(void)
     TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
 }
 
+// Transfers pushed in arbitrary deadline order expire exactly when due, including across long time jumps
+// and deadlines that are already in the past when pushed. Covers both deadline index implementations.
+static void test_tx_expire_mixed_deadlines(void)
+{
+    canard_t                 self;
+    test_context_t           ctx;
+    instrumented_allocator_t alloc;
+    init_canard(&self, &ctx, &alloc, 64U);
+
+    const byte_t               data[]      = { 0x55U };
+    const canard_bytes_chain_t payload     = { .bytes = { .size = 1U, .data = data }, .next = NULL };
+    const canard_us_t          deadlines[] = { 50000, 1500, 9000, 1500, 200000, 1999, 2000 };
+    const size_t               count       = sizeof(deadlines) / sizeof(deadlines[0]);
+    ctx.now                                = 0U;
+    for (size_t i = 0; i < count; i++) {
+        tx_transfer_t* const tr =
+          tx_transfer_new(&self, deadlines[i], ((uint32_t)canard_prio_nominal) << PRIO_SHIFT, false, NULL);
+        TEST_ASSERT_NOT_NULL(tr);
+        TEST_ASSERT_TRUE(tx_push(&self, tr, false, 1U, (byte_t)i, payload, CRC_INITIAL));
+    }
+    TEST_ASSERT_EQUAL_size_t(count, count_enqueued_transfers(&self));
+
+    tx_expire(&self, 1500);
+    TEST_ASSERT_EQUAL_size_t(count, count_enqueued_transfers(&self));
+    tx_expire(&self, 1501);
+    TEST_ASSERT_EQUAL_size_t(count - 2U, count_enqueued_transfers(&self));
+    tx_expire(&self, 2000);
+    TEST_ASSERT_EQUAL_size_t(count - 3U, count_enqueued_transfers(&self));
+    tx_expire(&self, 2001);
+    TEST_ASSERT_EQUAL_size_t(count - 4U, count_enqueued_transfers(&self));
+    tx_expire(&self, 50000); // Skips over many ticks at once.
+    TEST_ASSERT_EQUAL_size_t(2U, count_enqueued_transfers(&self));
+    tx_expire(&self, 50001);
+    TEST_ASSERT_EQUAL_size_t(1U, count_enqueued_transfers(&self));
+    TEST_ASSERT_EQUAL_UINT64(count - 1U, self.err.tx_expiration);
+
+    // A deadline already in the past is honored on the next expiration pass.
+    ctx.now                   = 100000U;
+    tx_transfer_t* const late = tx_transfer_new(&self, 10, ((uint32_t)canard_prio_nominal) << PRIO_SHIFT, false, NULL);
+    TEST_ASSERT_NOT_NULL(late);
+    TEST_ASSERT_TRUE(tx_push(&self, late, false, 1U, 0U, payload, CRC_INITIAL));
+    TEST_ASSERT_EQUAL_size_t(2U, count_enqueued_transfers(&self));
+    tx_expire(&self, 100000);
+    TEST_ASSERT_EQUAL_size_t(1U, count_enqueued_transfers(&self));
+
+    // Time going backward expires nothing.
+    tx_expire(&self, 0);
+    TEST_ASSERT_EQUAL_size_t(1U, count_enqueued_transfers(&self));
+    tx_expire(&self, 1000000);
+    TEST_ASSERT_EQUAL_size_t(0U, count_enqueued_transfers(&self));
+    TEST_ASSERT_EQUAL_UINT64(count + 1U, self.err.tx_expiration);
+
+    free_all_transfers(&self);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+}
+
 // Exhaustive test of tx_predict_frame_count against a reference formula.
 static void test_tx_predict_frame_count_exhaustive(void)
 {
@@ -1719,7 +1877,9 @@ static void test_canard_v0_spool_oom_mid_chain(void)
     // Payload of 10 bytes => multiframe in v0 (10 >= 8). size_total = 10+2(CRC) = 12, ceil(12/7) = 2 frames.
     // tx_transfer_new uses 1 fragment, then tx_spool_v0 allocates frames.
     // Allow transfer + 1 frame = 2 fragments total, so the 2nd frame alloc fails.
+    // The byte limit also rules out the contiguous block.
     alloc.limit_fragments               = 2U;
+    alloc.limit_bytes                   = sizeof(tx_transfer_t) + sizeof(tx_frame_t) + 8U;
     const byte_t               data[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
     const canard_bytes_chain_t payload  = { .bytes = { .size = 10U, .data = data }, .next = NULL };
     TEST_ASSERT_FALSE(canard_v0_publish(&self, 1000, 1U, canard_prio_nominal, 11U, 0xFFFFU, 3U, payload, NULL));
@@ -1843,6 +2003,76 @@ static void test_tx_comparator_equal_can_id(void)
     TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
 }
 
+// Collects the transfer-IDs of the pending transfers of the given bucket in their order.
+static size_t collect_pending_transfer_ids(const canard_t* const self,
+                                           const byte_t          iface_index,
+                                           const canard_prio_t   prio,
+                                           byte_t* const         out,
+                                           const size_t          capacity)
+{
+    size_t                 count  = 0;
+    const canard_listed_t* member = self->tx.pending[iface_index][prio].head;
+    while ((member != NULL) && (count < capacity)) {
+        out[count++] = transfer_id_from_cursor(tx_pending_member_to_transfer(member, iface_index), iface_index);
+        member       = member->next;
+    }
+    return count;
+}
+
+// The last pending transfer of each CAN ID is indexed; the index is handed over when it leaves the queue.
+static void test_tx_pending_index_by_can_id(void)
+{
+    canard_t                 self;
+    test_context_t           ctx;
+    instrumented_allocator_t alloc;
+    init_canard(&self, &ctx, &alloc, 16U);
+    const canard_bytes_chain_t payload       = { .bytes = { .size = 0U, .data = NULL }, .next = NULL };
+    static const uint16_t      subject_ids[] = { 300U, 100U, 300U, 200U, 300U };
+    tx_transfer_t*             trs[5]        = { NULL };
+    for (byte_t i = 0; i < 5U; i++) {
+        TEST_ASSERT_TRUE(canard_publish_16b(&self, 1000, 1U, canard_prio_nominal, subject_ids[i], i, payload, NULL));
+        trs[i] = LIST_TAIL(self.tx.agewise, tx_transfer_t, list_agewise);
+    }
+    canard_tree_t* const* const index = &self.tx.pending_by_can_id[0][canard_prio_nominal];
+    byte_t                      ids[8];
+    {
+        const byte_t expected[] = { 1U, 3U, 0U, 2U, 4U };
+        TEST_ASSERT_EQUAL_size_t(5U, collect_pending_transfer_ids(&self, 0U, canard_prio_nominal, ids, 8U));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, ids, 5U);
+    }
+    TEST_ASSERT_TRUE(cavl2_is_inserted(*index, &trs[1]->index_pending[0]));
+    TEST_ASSERT_TRUE(cavl2_is_inserted(*index, &trs[3]->index_pending[0]));
+    TEST_ASSERT_TRUE(cavl2_is_inserted(*index, &trs[4]->index_pending[0]));
+    TEST_ASSERT_FALSE(cavl2_is_inserted(*index, &trs[0]->index_pending[0]));
+    TEST_ASSERT_FALSE(cavl2_is_inserted(*index, &trs[2]->index_pending[0]));
+
+    // The newest of a CAN ID leaves; the previous one of the same CAN ID takes over.
+    tx_retire(&self, trs[4], canard_tx_outcome_canceled);
+    TEST_ASSERT_TRUE(cavl2_is_inserted(*index, &trs[2]->index_pending[0]));
+    // The only one of a CAN ID leaves; the CAN ID is removed from the index.
+    tx_retire(&self, trs[1], canard_tx_outcome_canceled);
+    TEST_ASSERT_EQUAL_PTR(&trs[3]->index_pending[0], cavl2_min(*index));
+    TEST_ASSERT_EQUAL_PTR(&trs[2]->index_pending[0], cavl2_max(*index));
+    {
+        const byte_t expected[] = { 3U, 0U, 2U };
+        TEST_ASSERT_EQUAL_size_t(3U, collect_pending_transfer_ids(&self, 0U, canard_prio_nominal, ids, 8U));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, ids, 3U);
+    }
+    // Out-of-order insertions land after the last transfer with the same or the nearest smaller CAN ID.
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 1000, 1U, canard_prio_nominal, 100U, 5U, payload, NULL));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 1000, 1U, canard_prio_nominal, 250U, 6U, payload, NULL));
+    TEST_ASSERT_TRUE(canard_publish_16b(&self, 1000, 1U, canard_prio_nominal, 200U, 7U, payload, NULL));
+    {
+        const byte_t expected[] = { 5U, 3U, 7U, 6U, 0U, 2U };
+        TEST_ASSERT_EQUAL_size_t(6U, collect_pending_transfer_ids(&self, 0U, canard_prio_nominal, ids, 8U));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, ids, 6U);
+    }
+
+    free_all_transfers(&self);
+    TEST_ASSERT_NULL(*index);
+    TEST_ASSERT_EQUAL_size_t(0U, alloc.allocated_fragments);
+}
+
 void setUp(void) {}
 
 void tearDown(void) {}
@@ -1860,7 +2090,9 @@ int main(void)
     RUN_TEST(test_tx_push_basic);
     RUN_TEST(test_tx_push_capacity_reject);
     RUN_TEST(test_tx_push_oom);
+    RUN_TEST(test_tx_push_inline_frame);
     RUN_TEST(test_tx_comparator_equal_can_id);
+    RUN_TEST(test_tx_pending_index_by_can_id);
     RUN_TEST(test_tx_first_frame_departure_flag);
     RUN_TEST(test_tx_purge_continuations_keeps_unstarted_multi_frame);
     RUN_TEST(test_tx_purge_continuations_removes_started_multi_frame);
@@ -1903,6 +2135,7 @@ int main(void)
     RUN_TEST(test_tx_spool_scattered_many_fragments);
     RUN_TEST(test_tx_spool_scattered_with_empty_fragments);
     RUN_TEST(test_tx_spool_oom_midway);
+    RUN_TEST(test_tx_spool_contiguous);
     RUN_TEST(test_tx_spool_large_payload_fd);
 
     // tx_spool_v0 tests.
@@ -1917,6 +2150,7 @@ int main(void)
     RUN_TEST(test_tx_sacrifice_multiframe_all_frames);
     RUN_TEST(test_tx_ensure_queue_sacrifice_null);
     RUN_TEST(test_tx_expire_boundary);
+    RUN_TEST(test_tx_expire_mixed_deadlines);
     RUN_TEST(test_tx_predict_frame_count_exhaustive);
     RUN_TEST(test_tx_push_refcount_multi_iface);
     RUN_TEST(test_tx_push_iface_availability_partial_refcount);
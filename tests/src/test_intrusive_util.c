@@ -440,7 +440,7 @@ static void test_refcount_inc(void)
     self.mem.tx_frame = instrumented_allocator_make_resource(&alloc);
 
     // Create a frame and bump the refcount.
-    tx_frame_t* const frame = tx_frame_new(&self, 1);
+    tx_frame_t* const frame = tx_frame_new(&self, canard_prio_nominal, 1);
     TEST_ASSERT_NOT_NULL(frame);
     const canard_bytes_t view = tx_frame_view(frame);
     canard_refcount_inc(view);
@@ -659,6 +659,42 @@ static void test_crc_add_chain_empty_fragments(void)
     TEST_ASSERT_EQUAL_HEX16(flat_crc, chain_crc);
 }
 
+/// Bit-at-a-time reference implementation, independent of the backend selected by CANARD_CRC_BACKEND.
+static uint16_t crc_add_reference(uint16_t crc, const size_t size, const uint8_t* const data)
+{
+    for (size_t i = 0; i < size; i++) {
+        crc ^= (uint16_t)(data[i] << 8U);
+        for (size_t k = 0; k < 8; k++) {
+            crc = (uint16_t)(((crc & 0x8000U) != 0U) ? (((unsigned)crc << 1U) ^ 0x1021U) : ((unsigned)crc << 1U));
+        }
+    }
+    return crc;
+}
+
+static void test_crc_add_backend(void)
+{
+    // Cover every size class of every backend: the byte-wise tail, the slices, and the 16/64-byte folding blocks,
+    // at different alignments and with different initial values.
+    static uint8_t data[600];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)rand();
+    }
+    for (size_t size = 0; size <= 300; size++) {
+        for (size_t offset = 0; offset < 16; offset += 5) {
+            const uint16_t seed = (uint16_t)rand();
+            TEST_ASSERT_EQUAL_HEX16(crc_add_reference(seed, size, &data[offset]), crc_add(seed, size, &data[offset]));
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX16(crc_add_reference(CRC_INITIAL, sizeof(data), data),
+                            crc_add(CRC_INITIAL, sizeof(data), data));
+    // Splitting the input at arbitrary points must not affect the result.
+    for (size_t split = 0; split <= sizeof(data); split += 37) {
+        const uint16_t head = crc_add(CRC_INITIAL, split, data);
+        TEST_ASSERT_EQUAL_HEX16(crc_add(CRC_INITIAL, sizeof(data), data),
+                                crc_add(head, sizeof(data) - split, &data[split]));
+    }
+}
+
 static void test_bytes_chain_read_one_byte_at_a_time(void)
 {
     // 3-fragment chain: [2 bytes] -> [3 bytes] -> [1 byte]. Total 6 bytes.
@@ -715,6 +751,7 @@ int main(void)
     RUN_TEST(test_crc_add_empty);
     RUN_TEST(test_crc_residue_property);
     RUN_TEST(test_crc_add_chain_empty_fragments);
+    RUN_TEST(test_crc_add_backend);
     RUN_TEST(test_bytes_chain_read_one_byte_at_a_time);
     RUN_TEST(test_bytes_chain_valid_null_data);
     return UNITY_END();